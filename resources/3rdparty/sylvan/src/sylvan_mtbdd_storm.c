@@ -1046,3 +1046,57 @@ TASK_IMPL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, dd, mtbdd_uapply_op, op, size_t,
     // Caching would be done here, but is omitted (as this is the purpose of this function).
     return result;
 }
+
+/**
+ * Collects the locations of all protected MTBDDs that are neither leaves nor maps. The result needs to be freed by the caller.
+ */
+static MTBDD**
+mtbdd_collect_protected(size_t *count)
+{
+    size_t capacity = 1024;
+    MTBDD **result = (MTBDD**)malloc(sizeof(MTBDD*) * capacity);
+    *count = 0;
+
+    uint64_t *it = protect_iter(&mtbdd_protected, 0, mtbdd_protected.refs_size);
+    while (it != NULL) {
+        MTBDD *location = (MTBDD*)protect_next(&mtbdd_protected, &it, mtbdd_protected.refs_size);
+        if (mtbdd_isleaf(*location) || mtbddnode_ismapnode(MTBDD_GETNODE(*location))) continue;
+        if (*count == capacity) {
+            capacity *= 2;
+            result = (MTBDD**)realloc(result, sizeof(MTBDD*) * capacity);
+        }
+        result[(*count)++] = location;
+    }
+    return result;
+}
+
+VOID_TASK_IMPL_1(mtbdd_permute_protected, MTBDDMAP, map)
+{
+    size_t count;
+    MTBDD **locations = mtbdd_collect_protected(&count);
+
+    // Every result is protected by the location it is written to. The old MTBDDs that are still needed are in turn
+    // protected by the locations that have not been processed yet, so garbage collection may happen at any time.
+    mtbdd_refs_pushptr(&map);
+    for (size_t i = 0; i < count; ++i) {
+        *locations[i] = CALL(mtbdd_compose, *locations[i], map);
+    }
+    mtbdd_refs_popptr(1);
+
+    free(locations);
+}
+
+size_t
+mtbdd_protected_nodecount(void)
+{
+    size_t count;
+    MTBDD **locations = mtbdd_collect_protected(&count);
+    MTBDD *roots = (MTBDD*)malloc(sizeof(MTBDD) * (count == 0 ? 1 : count));
+    for (size_t i = 0; i < count; ++i) {
+        roots[i] = *locations[i];
+    }
+    size_t result = mtbdd_nodecount_more(roots, count);
+    free(roots);
+    free(locations);
+    return result;
+}
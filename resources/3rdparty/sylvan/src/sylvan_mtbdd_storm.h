@@ -169,6 +169,19 @@ TASK_DECL_3(BDD, mtbdd_max_abstract_representative, MTBDD, MTBDD, uint32_t);
 TASK_DECL_3(MTBDD, mtbdd_uapply_nocache, MTBDD, mtbdd_uapply_op, size_t);
 #define mtbdd_uapply_nocache(dd, op, param) (CALL(mtbdd_uapply_nocache, dd, op, param))
 
+/**
+ * Replaces every protected MTBDD (see mtbdd_protect) by its composition with the given map. If the map is a
+ * permutation of the variables, this effectively changes the variable order of all MTBDDs held by the user, which is
+ * how variable reordering is realized (Sylvan identifies variables with their levels). Protected maps are left as is.
+ */
+VOID_TASK_DECL_1(mtbdd_permute_protected, MTBDDMAP);
+#define mtbdd_permute_protected(map) (CALL(mtbdd_permute_protected, map))
+
+/**
+ * Counts the number of (shared) nodes of all protected MTBDDs.
+ */
+size_t mtbdd_protected_nodecount(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/models/symbolic/MarkovAutomaton.h"
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/ResourceSettings.h"
@@ -579,6 +580,10 @@ namespace storm {
                 }
                 return result;
             });
+            
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                model->as<storm::models::symbolic::Model<DdType, ValueType>>()->getExplicitRepresentationCache().printStatistics(std::cout);
+            }
         }
         
         template <storm::dd::DdType DdType, typename ValueType>
@@ -6,6 +6,10 @@
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
 
+#include "storm/logic/FormulaInformation.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
 
@@ -19,6 +23,7 @@ namespace storm {
                 options = typename storm::storage::DeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
             }
             options.setType(type);
+            options.setRefinementMethod(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMethod());
             
             storm::storage::DeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
             bisimulationDecomposition.computeBisimulationDecomposition();
@@ -32,20 +37,56 @@ namespace storm {
                 options = typename storm::storage::NondeterministicModelBisimulationDecomposition<ModelType>::Options(*model, formulas);
             }
             options.setType(type);
+            options.setRefinementMethod(storm::settings::getModule<storm::settings::modules::BisimulationSettings>().getSparseRefinementMethod());
             
             storm::storage::NondeterministicModelBisimulationDecomposition<ModelType> bisimulationDecomposition(*model, options);
             bisimulationDecomposition.computeBisimulationDecomposition();
             return bisimulationDecomposition.getQuotient();
         }
         
+        /*!
+         * Minimizes the given (closed) Markov automaton wrt. weak bisimulation with time-abstract observables. As the
+         * timing information is abstracted away, the quotient is the minimized embedded MDP, which only preserves untimed
+         * properties.
+         */
+        template <typename ValueType>
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> performTimeAbstractBisimulationMinimization(std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+            STORM_LOG_THROW(type == storm::storage::BisimulationType::Weak, storm::exceptions::NotSupportedException, "Only weak bisimulation minimization is supported for Markov automata.");
+            STORM_LOG_THROW(model->isClosed(), storm::exceptions::NotSupportedException, "Bisimulation minimization requires the Markov automaton to be closed.");
+            // Only untimed reachability properties are preserved. In particular, the fragment excludes (possibly nested)
+            // time operators, long-run averages, next and bounded formulas.
+            storm::logic::FragmentSpecification untimedFragment = storm::logic::propositional();
+            untimedFragment.setProbabilityOperatorsAllowed(true);
+            untimedFragment.setRewardOperatorsAllowed(true);
+            untimedFragment.setUntilFormulasAllowed(true);
+            untimedFragment.setGloballyFormulasAllowed(true);
+            untimedFragment.setReachabilityProbabilityFormulasAllowed(true);
+            untimedFragment.setReachabilityRewardFormulasAllowed(true);
+            untimedFragment.setTotalRewardFormulasAllowed(true);
+            for (auto const& formula : formulas) {
+                STORM_LOG_THROW(formula->isInFragment(untimedFragment), storm::exceptions::NotSupportedException, "Weak bisimulation of Markov automata does not preserve the property " << *formula << ".");
+            }
+            for (auto const& rewardModel : model->getRewardModels()) {
+                STORM_LOG_THROW(!rewardModel.second.hasStateRewards(), storm::exceptions::NotSupportedException, "Weak bisimulation of Markov automata does not preserve the state rewards of reward model '" << rewardModel.first << "'.");
+            }
+            
+            // The transition matrix of the MA already holds the probabilities of the embedded MDP.
+            auto embeddedMdp = std::make_shared<storm::models::sparse::Mdp<ValueType>>(model->getTransitionMatrix(), model->getStateLabeling(), model->getRewardModels());
+            return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(embeddedMdp, formulas, type);
+        }
+        
         template <typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
             
-            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs and MDPs.");
+            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp) || model->isOfType(storm::models::ModelType::MarkovAutomaton), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs, MDPs and MAs.");
 
             // Try to get rid of non state-rewards to easy bisimulation computation.
             model->reduceToStateBasedRewards();
 
+            if (model->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                return performTimeAbstractBisimulationMinimization(model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), formulas, type);
+            }
+            
             if (model->isOfType(storm::models::ModelType::Dtmc)) {
                 return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type);
             } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
@@ -2,6 +2,9 @@
 
 #include "storm/transformer/ContinuousToDiscreteTimeModelTransformer.h"
 #include "storm/transformer/SymbolicToSparseTransformer.h"
+#include "storm/transformer/StatePermuter.h"
+#include "storm/utility/permutation.h"
+#include "storm/utility/vector.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -58,6 +61,24 @@ namespace storm {
             
         }
         
+        /*!
+         * Renumbers the states of the given sparse model according to the given ordering. The target states are only
+         * relevant for orderings that depend on them (e.g. a backward search).
+         * The returned structure also contains the mapping between the states of the input and the output model, which
+         * can be used to map results obtained on the permuted model back to the original states.
+         */
+        template <typename ValueType>
+        typename storm::transformer::StatePermuter<ValueType>::ReturnType permuteModelStates(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::utility::permutation::OrderKind const& order, storm::storage::BitVector const& targetStates = storm::storage::BitVector()) {
+            STORM_LOG_THROW(order != storm::utility::permutation::OrderKind::BackwardBfs || targetStates.size() == model->getNumberOfStates(), storm::exceptions::InvalidOperationException, "Reordering states by a backward search requires a set of target states.");
+            std::vector<storm::storage::sparse::state_type> permutation;
+            if (order == storm::utility::permutation::OrderKind::None) {
+                permutation = storm::utility::vector::buildVectorForRange(0, model->getNumberOfStates());
+            } else {
+                permutation = storm::utility::permutation::createPermutation(order, model->getTransitionMatrix(), targetStates);
+            }
+            return storm::transformer::StatePermuter<ValueType>::transform(*model, permutation);
+        }
+        
         /*!
          * Transforms the given symbolic model to a sparse model.
          */
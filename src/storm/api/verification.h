@@ -11,13 +11,16 @@
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SymbolicMdpPrctlModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
+#include "storm/modelchecker/incremental/SparseVerificationSession.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/MarkovAutomaton.h"
 
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -200,6 +203,21 @@ namespace storm {
             return result;
         }
         
+        /*!
+         * Creates a session for checking several properties on the given model. The session reuses qualitative
+         * information and solutions of previous checks and may be supplied with models that only differ in the values
+         * of some constants (see SparseVerificationSession::updateModel).
+         */
+        template<typename SparseModelType>
+        std::shared_ptr<storm::modelchecker::SparseVerificationSession<SparseModelType>> createVerificationSession(std::shared_ptr<SparseModelType> const& model) {
+            return std::make_shared<storm::modelchecker::SparseVerificationSession<SparseModelType>>(model);
+        }
+        
+        template<typename SparseModelType>
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::modelchecker::SparseVerificationSession<SparseModelType>& session, storm::modelchecker::CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& task) {
+            return session.check(task);
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(std::shared_ptr<storm::models::symbolic::Dtmc<DdType, ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -235,6 +253,21 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Hybrid engine cannot verify MDPs with this data type.");
         }
         
+        template<storm::dd::DdType DdType, typename ValueType>
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithHybridEngine(std::shared_ptr<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>> const& ma, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+            std::unique_ptr<storm::modelchecker::CheckResult> result;
+            storm::modelchecker::HybridMarkovAutomatonCslModelChecker<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>> modelchecker(*ma);
+            if (modelchecker.canHandle(task)) {
+                result = modelchecker.check(task);
+            }
+            return result;
+        }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithHybridEngine(std::shared_ptr<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>> const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Hybrid engine cannot verify Markov automata with this data type.");
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> verifyWithHybridEngine(std::shared_ptr<storm::models::symbolic::Model<DdType, ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -244,6 +277,8 @@ namespace storm {
                 result = verifyWithHybridEngine(model->template as<storm::models::symbolic::Ctmc<DdType, ValueType>>(), task);
             } else if (model->getType() == storm::models::ModelType::Mdp) {
                 result = verifyWithHybridEngine(model->template as<storm::models::symbolic::Mdp<DdType, ValueType>>(), task);
+            } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
+                result = verifyWithHybridEngine(model->template as<storm::models::symbolic::MarkovAutomaton<DdType, ValueType>>(), task);
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type is not supported by the hybrid engine.");
             }
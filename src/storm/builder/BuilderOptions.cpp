@@ -1,6 +1,7 @@
 #include "storm/builder/BuilderOptions.h"
 
 #include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
@@ -36,7 +37,7 @@ namespace storm {
             return boost::get<storm::expressions::Expression>(labelOrExpression);
         }
         
-        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), explorationChecks(false), showProgress(false), showProgressDelay(0) {
+        BuilderOptions::BuilderOptions(bool buildAllRewardModels, bool buildAllLabels) : buildAllRewardModels(buildAllRewardModels), buildAllLabels(buildAllLabels), buildChoiceLabels(false), buildStateValuations(false), buildChoiceOrigins(false), explorationChecks(false), bytecode(false), symmetryReduction(false), partialOrderReduction(false), prob01Pruning(false), showProgress(false), showProgressDelay(0) {
             // Intentionally left empty.
         }
         
@@ -58,6 +59,10 @@ namespace storm {
             auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
             auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
             explorationChecks = buildSettings.isExplorationChecksSet();
+            bytecode = buildSettings.isBytecodeSet();
+            symmetryReduction = buildSettings.isSymmetryReductionSet();
+            partialOrderReduction = buildSettings.isPartialOrderReductionSet();
+            prob01Pruning = buildSettings.isProb01PruningSet();
             showProgress = generalSettings.isVerboseSet();
             showProgressDelay = generalSettings.getShowProgressDelay();
         }
@@ -88,30 +93,73 @@ namespace storm {
         }
         
         void BuilderOptions::setTerminalStatesFromFormula(storm::logic::Formula const& formula) {
+            // Terminal states are only derived if all operands of the path formula are propositional. Nested operators
+            // are evaluated on the whole model, so their value in a state may depend on paths through states that
+            // would otherwise not be expanded.
             if (formula.isAtomicExpressionFormula()) {
                 addTerminalExpression(formula.asAtomicExpressionFormula().getExpression(), true);
             } else if (formula.isAtomicLabelFormula()) {
                 addTerminalLabel(formula.asAtomicLabelFormula().getLabel(), true);
             } else if (formula.isEventuallyFormula()) {
-                storm::logic::Formula const& sub = formula.asEventuallyFormula().getSubformula();
-                if (sub.isAtomicExpressionFormula() || sub.isAtomicLabelFormula()) {
-                    this->setTerminalStatesFromFormula(sub);
+                // All states satisfying the subformula have probability one.
+                storm::logic::Formula const& subformula = formula.asEventuallyFormula().getSubformula();
+                if (subformula.isInFragment(storm::logic::propositional())) {
+                    this->addTerminalStatesFromStateFormula(subformula, true);
+                    terminalStateProbabilities.resize(terminalStates.size(), true);
+                }
+            } else if (formula.isGloballyFormula()) {
+                // All states violating the subformula have probability zero.
+                storm::logic::Formula const& subformula = formula.asGloballyFormula().getSubformula();
+                if (subformula.isInFragment(storm::logic::propositional())) {
+                    this->addTerminalStatesFromStateFormula(subformula, false);
+                    terminalStateProbabilities.resize(terminalStates.size(), false);
                 }
             } else if (formula.isUntilFormula()) {
-                storm::logic::Formula const& right = formula.asUntilFormula().getRightSubformula();
-                if (right.isAtomicExpressionFormula() || right.isAtomicLabelFormula()) {
-                    this->setTerminalStatesFromFormula(right);
+                storm::logic::UntilFormula const& untilFormula = formula.asUntilFormula();
+                if (untilFormula.getLeftSubformula().isInFragment(storm::logic::propositional()) && untilFormula.getRightSubformula().isInFragment(storm::logic::propositional())) {
+                    // The states satisfying the right subformula come first, so they take precedence.
+                    this->addTerminalStatesFromStateFormula(untilFormula.getRightSubformula(), true);
+                    terminalStateProbabilities.resize(terminalStates.size(), true);
+                    this->addTerminalStatesFromStateFormula(untilFormula.getLeftSubformula(), false);
+                    terminalStateProbabilities.resize(terminalStates.size(), false);
                 }
-                storm::logic::Formula const& left = formula.asUntilFormula().getLeftSubformula();
-                if (left.isAtomicExpressionFormula()) {
-                    addTerminalExpression(left.asAtomicExpressionFormula().getExpression(), false);
-                } else if (left.isAtomicLabelFormula()) {
-                    addTerminalLabel(left.asAtomicLabelFormula().getLabel(), false);
+            } else if (formula.isBoundedUntilFormula()) {
+                // With a lower bound, reaching the right subformula too early does not satisfy the formula, so we
+                // must not stop there.
+                storm::logic::BoundedUntilFormula const& boundedUntilFormula = formula.asBoundedUntilFormula();
+                if (!boundedUntilFormula.isMultiDimensional() && !boundedUntilFormula.hasLowerBound() && boundedUntilFormula.getLeftSubformula().isInFragment(storm::logic::propositional()) && boundedUntilFormula.getRightSubformula().isInFragment(storm::logic::propositional())) {
+                    this->addTerminalStatesFromStateFormula(boundedUntilFormula.getRightSubformula(), true);
+                    this->addTerminalStatesFromStateFormula(boundedUntilFormula.getLeftSubformula(), false);
                 }
             } else if (formula.isProbabilityOperatorFormula()) {
-                storm::logic::Formula const& sub = formula.asProbabilityOperatorFormula().getSubformula();
-                if (sub.isEventuallyFormula() || sub.isUntilFormula()) {
-                    this->setTerminalStatesFromFormula(sub);
+                storm::logic::ProbabilityOperatorFormula const& operatorFormula = formula.asProbabilityOperatorFormula();
+                if (operatorFormula.hasOptimalityType()) {
+                    optimizationDirection = operatorFormula.getOptimalityType();
+                } else if (operatorFormula.hasBound()) {
+                    optimizationDirection = storm::logic::isLowerBound(operatorFormula.getComparisonType()) ? storm::OptimizationDirection::Minimize : storm::OptimizationDirection::Maximize;
+                }
+                this->setTerminalStatesFromFormula(operatorFormula.getSubformula());
+            }
+        }
+        
+        void BuilderOptions::addTerminalStatesFromStateFormula(storm::logic::Formula const& formula, bool value) {
+            // Since a state is terminal as soon as one of the terminal expressions or labels has the required value,
+            // only disjunctions can be split into several entries. For all other formulas, we need an expression.
+            // Formulas that can not be handled are skipped, which is sound, because it only leads to more states
+            // being explored.
+            if (formula.isAtomicExpressionFormula()) {
+                addTerminalExpression(formula.asAtomicExpressionFormula().getExpression(), value);
+            } else if (formula.isAtomicLabelFormula()) {
+                addTerminalLabel(formula.asAtomicLabelFormula().getLabel(), value);
+            } else if (formula.isUnaryBooleanStateFormula() && formula.asUnaryBooleanStateFormula().isNot()) {
+                this->addTerminalStatesFromStateFormula(formula.asUnaryBooleanStateFormula().getSubformula(), !value);
+            } else if (formula.isBinaryBooleanStateFormula() && (value ? formula.asBinaryBooleanStateFormula().isOr() : formula.asBinaryBooleanStateFormula().isAnd())) {
+                this->addTerminalStatesFromStateFormula(formula.asBinaryBooleanStateFormula().getLeftSubformula(), value);
+                this->addTerminalStatesFromStateFormula(formula.asBinaryBooleanStateFormula().getRightSubformula(), value);
+            } else if (formula.isInFragment(storm::logic::propositional()) && formula.getAtomicLabelFormulas().empty()) {
+                std::vector<std::shared_ptr<storm::logic::AtomicExpressionFormula const>> atomicExpressionFormulas = formula.getAtomicExpressionFormulas();
+                if (!atomicExpressionFormulas.empty()) {
+                    addTerminalExpression(formula.toExpression(atomicExpressionFormulas.front()->getExpression().getManager()), value);
                 }
             }
         }
@@ -138,6 +186,21 @@ namespace storm {
         
         void BuilderOptions::clearTerminalStates() {
             terminalStates.clear();
+            terminalStateProbabilities.clear();
+            optimizationDirection = boost::none;
+        }
+        
+        bool BuilderOptions::hasTerminalStateProbabilities() const {
+            // Terminal states that were added afterwards have no known probability.
+            return hasTerminalStates() && terminalStateProbabilities.size() == terminalStates.size();
+        }
+        
+        std::vector<bool> const& BuilderOptions::getTerminalStateProbabilities() const {
+            return terminalStateProbabilities;
+        }
+        
+        boost::optional<storm::OptimizationDirection> const& BuilderOptions::getOptimizationDirection() const {
+            return optimizationDirection;
         }
         
         bool BuilderOptions::isBuildChoiceLabelsSet() const {
@@ -169,6 +232,22 @@ namespace storm {
             return explorationChecks;
         }
         
+        bool BuilderOptions::isBytecodeSet() const {
+            return bytecode;
+        }
+        
+        bool BuilderOptions::isSymmetryReductionSet() const {
+            return symmetryReduction;
+        }
+        
+        bool BuilderOptions::isPartialOrderReductionSet() const {
+            return partialOrderReduction;
+        }
+        
+        bool BuilderOptions::isProb01PruningSet() const {
+            return prob01Pruning;
+        }
+        
         bool BuilderOptions::isShowProgressSet() const {
             return showProgress;
         }
@@ -182,6 +261,26 @@ namespace storm {
             return *this;
         }
         
+        BuilderOptions& BuilderOptions::setBytecode(bool newValue) {
+            bytecode = newValue;
+            return *this;
+        }
+        
+        BuilderOptions& BuilderOptions::setSymmetryReduction(bool newValue) {
+            symmetryReduction = newValue;
+            return *this;
+        }
+        
+        BuilderOptions& BuilderOptions::setPartialOrderReduction(bool newValue) {
+            partialOrderReduction = newValue;
+            return *this;
+        }
+        
+        BuilderOptions& BuilderOptions::setProb01Pruning(bool newValue) {
+            prob01Pruning = newValue;
+            return *this;
+        }
+        
         BuilderOptions& BuilderOptions::addRewardModel(std::string const& rewardModelName) {
             STORM_LOG_THROW(!buildAllRewardModels, storm::exceptions::InvalidSettingsException, "Cannot add reward model, because all reward models are built anyway.");
             rewardModelNames.emplace_back(rewardModelName);
@@ -8,6 +8,7 @@
 #include <boost/optional.hpp>
 
 #include "storm/storage/expressions/Expression.h"
+#include "storm/solver/OptimizationDirection.h"
 
 namespace storm {
     namespace expressions {
@@ -74,8 +75,10 @@ namespace storm {
             
             /*!
              * Analyzes the given formula and sets an expression for the states states of the model that can be
-             * treated as terminal states. Note that this may interfere with checking properties different than the
-             * one provided.
+             * treated as terminal states, i.e. the states whose probability to satisfy the formula is known to be zero
+             * or one from their valuation alone. They are not expanded during exploration. Terminal states are only
+             * derived if the operands of the path formula are propositional. Note that this may interfere with
+             * checking properties different than the one provided.
              *
              * @param formula The formula used to (possibly) derive an expression for the terminal states of the
              * model.
@@ -100,12 +103,31 @@ namespace storm {
             std::vector<std::pair<LabelOrExpression, bool>> const& getTerminalStates() const;
             bool hasTerminalStates() const;
             void clearTerminalStates();
+            /*!
+             * Retrieves whether it is known for all terminal states whether their probability to satisfy the formula
+             * is zero or one. This is the case if the terminal states were derived from an unbounded path formula.
+             */
+            bool hasTerminalStateProbabilities() const;
+            /*!
+             * Retrieves for each entry of the terminal states whether the states it applies to satisfy the formula
+             * with probability one (true) or zero (false). If a state matches several entries, the first one counts.
+             */
+            std::vector<bool> const& getTerminalStateProbabilities() const;
+            /*!
+             * Retrieves how the nondeterminism is resolved in the formula from which the terminal states were derived
+             * (if this is known).
+             */
+            boost::optional<storm::OptimizationDirection> const& getOptimizationDirection() const;
             bool isBuildChoiceLabelsSet() const;
             bool isBuildStateValuationsSet() const;
             bool isBuildChoiceOriginsSet() const;
             bool isBuildAllRewardModelsSet() const;
             bool isBuildAllLabelsSet() const;
             bool isExplorationChecksSet() const;
+            bool isBytecodeSet() const;
+            bool isSymmetryReductionSet() const;
+            bool isPartialOrderReductionSet() const;
+            bool isProb01PruningSet() const;
             bool isShowProgressSet() const;
             uint64_t getShowProgressDelay() const;
 
@@ -155,8 +177,39 @@ namespace storm {
              * @return this
              */
             BuilderOptions& setExplorationChecks(bool newValue = true);
+            /**
+             * Should expressions be compiled to bytecode rather than evaluated by the generic expression evaluator?
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setBytecode(bool newValue = true);
+            /**
+             * Should the states of fully symmetric sets of processes be reduced to canonical representatives?
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setSymmetryReduction(bool newValue = true);
+            /**
+             * Should the interleavings of independent local commands be pruned when building MDPs?
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setPartialOrderReduction(bool newValue = true);
+            /**
+             * Should states that only states with probability zero or one reach be left unexpanded? This requires
+             * the probabilities of the terminal states to be known.
+             * @param newValue The new value (default true)
+             * @return this
+             */
+            BuilderOptions& setProb01Pruning(bool newValue = true);
             
         private:
+            /*!
+             * Adds terminal states for all states in which the given state formula evaluates to the given value. If
+             * the formula can not be translated, (some of) these states are not marked as terminal.
+             */
+            void addTerminalStatesFromStateFormula(storm::logic::Formula const& formula, bool value);
+            
             /// A flag that indicates whether all reward models are to be built. In this case, the reward model names are
             /// to be ignored.
             bool buildAllRewardModels;
@@ -176,6 +229,12 @@ namespace storm {
             /// If one of these labels/expressions evaluates to the given bool, the builder can abort the exploration.
             std::vector<std::pair<LabelOrExpression, bool>> terminalStates;
             
+            /// For each terminal state entry, whether the states it applies to have probability one (rather than zero).
+            std::vector<bool> terminalStateProbabilities;
+            
+            /// The optimization direction of the formula from which the terminal states were derived (if any).
+            boost::optional<storm::OptimizationDirection> optimizationDirection;
+            
             /// A flag indicating whether or not to build choice labels.
             bool buildChoiceLabels;
                          
@@ -189,6 +248,18 @@ namespace storm {
             /// A flag that stores whether exploration checks are to be performed.
             bool explorationChecks;
             
+            /// A flag that stores whether expressions are to be compiled to bytecode.
+            bool bytecode;
+            
+            /// A flag that stores whether symmetric states are to be merged.
+            bool symmetryReduction;
+            
+            /// A flag that stores whether a partial-order reduction is to be applied.
+            bool partialOrderReduction;
+            
+            /// A flag that stores whether states only reached by states with probability zero or one are left unexpanded.
+            bool prob01Pruning;
+            
             /// A flag that stores whether the progress of exploration is to be printed.
             bool showProgress;
             
@@ -17,6 +17,7 @@
 
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 #include "storm/adapters/AddExpressionAdapter.h"
 
 #include "storm/storage/expressions/ExpressionManager.h"
@@ -29,6 +30,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/jani.h"
@@ -46,18 +48,18 @@ namespace storm {
     namespace builder {
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(bool buildAllLabels, bool buildAllRewardModels) : buildAllLabels(buildAllLabels), buildAllRewardModels(buildAllRewardModels), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()), reachabilityStrategy(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy()), partitionTransitionRelation(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdPartitionSet()) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()), reachabilityStrategy(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy()), partitionTransitionRelation(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdPartitionSet()) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates() {
+        DdJaniModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllLabels(false), buildAllRewardModels(false), rewardModelsToBuild(), constantDefinitions(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()), reachabilityStrategy(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy()), partitionTransitionRelation(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdPartitionSet()) {
             if (!formulas.empty()) {
                 for (auto const& formula : formulas) {
                     this->preserveFormula(*formula);
@@ -261,7 +263,7 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class CompositionVariableCreator : public storm::jani::CompositionVisitor {
         public:
-            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation) : model(model), automata(), actionInformation(actionInformation) {
+            CompositionVariableCreator(storm::jani::Model const& model, storm::jani::CompositionInformation const& actionInformation, storm::builder::DdVariableOrdering const& variableOrdering = storm::builder::DdVariableOrdering::Declaration) : model(model), automata(), actionInformation(actionInformation), variableOrdering(variableOrdering) {
                 // Intentionally left empty.
             }
             
@@ -327,12 +329,15 @@ namespace storm {
                     result.allNondeterminismVariables.insert(result.probabilisticNondeterminismVariable);
                 }
                 
+                // Create the meta variables for the locations and the (non-transient) variables.
+                createMetaVariables(*result.manager);
+                
                 for (auto const& automatonName : this->automata) {
                     storm::jani::Automaton const& automaton =  this->model.getAutomaton(automatonName);
                     
-                    // Start by creating a meta variable for the location of the automaton.
+                    // Start by retrieving the meta variable for the location of the automaton.
                     storm::expressions::Variable locationExpressionVariable = automaton.getLocationExpressionVariable();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable("l_" + automaton.getName(), 0, automaton.getNumberOfLocations() - 1);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = variableToMetaVariablesMap.at(locationExpressionVariable);
                     result.automatonToLocationDdVariableMap[automaton.getName()] = variablePair;
                     result.rowColumnMetaVariablePairs.push_back(variablePair);
 
@@ -397,6 +402,96 @@ namespace storm {
                 return result;
             }
             
+            /*!
+             * Creates the meta variables for the locations of the automata and the non-transient variables. The order
+             * in which they are created (and thereby the order of the DD variables) is determined by the heuristic.
+             */
+            void createMetaVariables(storm::dd::DdManager<Type>& manager) {
+                std::vector<storm::expressions::Variable> order;
+                std::map<storm::expressions::Variable, std::string> variableToNameMap;
+                std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> variableToBoundsMap;
+                
+                auto addVariable = [&] (storm::jani::Variable const& variable, std::vector<storm::expressions::Variable>& variables) {
+                    variables.push_back(variable.getExpressionVariable());
+                    variableToNameMap[variable.getExpressionVariable()] = variable.getExpressionVariable().getName();
+                    if (variable.isBoundedIntegerVariable()) {
+                        variableToBoundsMap[variable.getExpressionVariable()] = std::make_pair(variable.asBoundedIntegerVariable().getLowerBound().evaluateAsInt(), variable.asBoundedIntegerVariable().getUpperBound().evaluateAsInt());
+                    }
+                };
+                
+                for (auto const& automatonName : this->automata) {
+                    storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                    variableToNameMap[automaton.getLocationExpressionVariable()] = "l_" + automaton.getName();
+                    variableToBoundsMap[automaton.getLocationExpressionVariable()] = std::make_pair(0, automaton.getNumberOfLocations() - 1);
+                }
+                
+                if (variableOrdering == storm::builder::DdVariableOrdering::Declaration) {
+                    // Create all location variables first, then the global variables and then the automata's variables.
+                    for (auto const& automatonName : this->automata) {
+                        order.push_back(this->model.getAutomaton(automatonName).getLocationExpressionVariable());
+                    }
+                    for (auto const& variable : this->model.getGlobalVariables()) {
+                        if (!variable.isTransient()) {
+                            addVariable(variable, order);
+                        }
+                    }
+                    for (auto const& automatonName : this->automata) {
+                        for (auto const& variable : this->model.getAutomaton(automatonName).getVariables()) {
+                            if (!variable.isTransient()) {
+                                addVariable(variable, order);
+                            }
+                        }
+                    }
+                } else {
+                    std::vector<std::vector<storm::expressions::Variable>> clusters;
+                    for (auto const& variable : this->model.getGlobalVariables()) {
+                        if (!variable.isTransient()) {
+                            clusters.emplace_back();
+                            addVariable(variable, clusters.back());
+                        }
+                    }
+                    
+                    // Every edge induces a dependency between the variables it reads and writes.
+                    std::vector<std::set<storm::expressions::Variable>> dependencies;
+                    for (auto const& automatonName : this->automata) {
+                        storm::jani::Automaton const& automaton = this->model.getAutomaton(automatonName);
+                        clusters.emplace_back();
+                        clusters.back().push_back(automaton.getLocationExpressionVariable());
+                        for (auto const& variable : automaton.getVariables()) {
+                            if (!variable.isTransient()) {
+                                addVariable(variable, clusters.back());
+                            }
+                        }
+                        
+                        for (auto const& edge : automaton.getEdges()) {
+                            std::set<storm::expressions::Variable> dependency = edge.getGuard().getVariables();
+                            dependency.insert(automaton.getLocationExpressionVariable());
+                            for (auto const& destination : edge.getDestinations()) {
+                                std::set<storm::expressions::Variable> probabilityVariables = destination.getProbability().getVariables();
+                                dependency.insert(probabilityVariables.begin(), probabilityVariables.end());
+                                for (auto const& assignment : destination.getOrderedAssignments().getNonTransientAssignments()) {
+                                    dependency.insert(assignment.getExpressionVariable());
+                                    std::set<storm::expressions::Variable> assignmentVariables = assignment.getAssignedExpression().getVariables();
+                                    dependency.insert(assignmentVariables.begin(), assignmentVariables.end());
+                                }
+                            }
+                            dependencies.push_back(std::move(dependency));
+                        }
+                    }
+                    order = storm::builder::computeDdVariableOrder(variableOrdering, clusters, dependencies);
+                    STORM_LOG_DEBUG("Creating meta variables using the DD variable ordering '" << variableOrdering << "'.");
+                }
+                
+                for (auto const& variable : order) {
+                    auto boundsIt = variableToBoundsMap.find(variable);
+                    if (boundsIt != variableToBoundsMap.end()) {
+                        variableToMetaVariablesMap[variable] = manager.addMetaVariable(variableToNameMap.at(variable), boundsIt->second.first, boundsIt->second.second);
+                    } else {
+                        variableToMetaVariablesMap[variable] = manager.addMetaVariable(variableToNameMap.at(variable));
+                    }
+                }
+            }
+            
             void createVariable(storm::jani::Variable const& variable, CompositionVariables<Type, ValueType>& result) {
                 if (variable.isBooleanVariable()) {
                     createVariable(variable.asBooleanVariable(), result);
@@ -408,9 +503,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BoundedIntegerVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                int_fast64_t low = variable.getLowerBound().evaluateAsInt();
-                int_fast64_t high = variable.getUpperBound().evaluateAsInt();
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName(), low, high);
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = variableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -430,7 +523,7 @@ namespace storm {
             }
             
             void createVariable(storm::jani::BooleanVariable const& variable, CompositionVariables<Type, ValueType>& result) {
-                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = result.manager->addMetaVariable(variable.getExpressionVariable().getName());
+                std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = variableToMetaVariablesMap.at(variable.getExpressionVariable());
                 
                 STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << " and " << variablePair.second.getName() << ".");
                 
@@ -453,6 +546,10 @@ namespace storm {
             storm::jani::Model const& model;
             std::set<std::string> automata;
             storm::jani::CompositionInformation actionInformation;
+            storm::builder::DdVariableOrdering variableOrdering;
+            
+            // The meta variables of the locations and the (non-transient) variables.
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> variableToMetaVariablesMap;
         };
         
         template <storm::dd::DdType Type, typename ValueType>
@@ -466,6 +563,9 @@ namespace storm {
             std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
             storm::dd::Bdd<Type> illegalFragment;
             uint64_t numberOfNondeterminismVariables;
+            
+            // The partitions of the transition relation (one per action) that may be used to compute the reachable states.
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
         };
         
         // A class that is responsible for performing the actual composition. This
@@ -1628,6 +1728,16 @@ namespace storm {
                 action.transitions *= missingIdentities;
             }
             
+            storm::dd::Bdd<Type> createTransitionPartition(ActionDd const& action) {
+                storm::dd::Bdd<Type> result = action.transitions.notZero();
+                std::set<storm::expressions::Variable> nondeterminismVariables;
+                std::set_intersection(result.getContainedMetaVariables().begin(), result.getContainedMetaVariables().end(), this->variables.allNondeterminismVariables.begin(), this->variables.allNondeterminismVariables.end(), std::inserter(nondeterminismVariables, nondeterminismVariables.begin()));
+                if (!nondeterminismVariables.empty()) {
+                    result = result.existsAbstract(nondeterminismVariables);
+                }
+                return result;
+            }
+            
             ComposerResult<Type, ValueType> buildSystemFromAutomaton(AutomatonDd& automaton) {
                 STORM_LOG_TRACE("Building system from final automaton.");
 
@@ -1646,6 +1756,7 @@ namespace storm {
                     // Add missing global variable identities, action and nondeterminism encodings.
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::unordered_set<ActionIdentification, ActionIdentificationHash> containedActions;
+                    std::vector<storm::dd::Bdd<Type>> transitionPartitions;
                     for (auto& action : automaton.actions) {
                         STORM_LOG_TRACE("Treating action with index " << action.first.actionIndex << (action.first.isMarkovian() ? " (Markovian)" : "") << ".");
 
@@ -1666,9 +1777,12 @@ namespace storm {
                         }
                         
                         result += extendedTransitions;
+                        transitionPartitions.push_back(createTransitionPartition(action.second));
                     }
                                         
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
+                    ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, numberOfUsedNondeterminismVariables);
+                    composerResult.transitionPartitions = std::move(transitionPartitions);
+                    return composerResult;
                 } else if (modelType == storm::jani::ModelType::DTMC || modelType == storm::jani::ModelType::CTMC) {
                     // Simply add all actions, but make sure to include the missing global variable identities.
 
@@ -1676,6 +1790,7 @@ namespace storm {
                     storm::dd::Bdd<Type> illegalFragment = this->variables.manager->getBddZero();
                     std::map<storm::expressions::Variable, storm::dd::Add<Type, ValueType>> transientEdgeAssignments;
                     std::unordered_set<uint64_t> actionIndices;
+                    std::vector<storm::dd::Bdd<Type>> transitionPartitions;
                     for (auto& action : automaton.actions) {
                         STORM_LOG_THROW(actionIndices.find(action.first.actionIndex) == actionIndices.end(), storm::exceptions::WrongFormatException, "Duplication action " << actionInformation.getActionName(action.first.actionIndex));
                         actionIndices.insert(action.first.actionIndex);
@@ -1683,9 +1798,12 @@ namespace storm {
                         addMissingGlobalVariableIdentities(action.second);
                         addToTransientAssignmentMap(transientEdgeAssignments, action.second.transientEdgeAssignments);
                         result += action.second.transitions;
+                        transitionPartitions.push_back(createTransitionPartition(action.second));
                     }
 
-                    return ComposerResult<Type, ValueType>(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+                    ComposerResult<Type, ValueType> composerResult(result, automaton.transientLocationAssignments, transientEdgeAssignments, illegalFragment, 0);
+                    composerResult.transitionPartitions = std::move(transitionPartitions);
+                    return composerResult;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Model type '" << this->model.getModelType() << "' not supported.");
                 }
@@ -1958,7 +2076,7 @@ namespace storm {
             storm::jani::CompositionInformation actionInformation = visitor.getInformation();
             
             // Create all necessary variables.
-            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation);
+            CompositionVariableCreator<Type, ValueType> variableCreator(preparedModel, actionInformation, options.variableOrdering);
             CompositionVariables<Type, ValueType> variables = variableCreator.create();
             
             // Determine which transient assignments need to be considered in the building process.
@@ -1968,6 +2086,9 @@ namespace storm {
             CombinedEdgesSystemComposer<Type, ValueType> composer(preparedModel, actionInformation, variables, rewardVariables);
             ComposerResult<Type, ValueType> system = composer.compose();
             
+            // Now that the system is built, the DDs are typically largest, so this is a good point to reorder (if requested).
+            variables.manager->reorderIfNecessary();
+            
             // Postprocess the variables in place.
             postprocessVariables(preparedModel.getModelType(), system, variables);
             
@@ -1985,7 +2106,15 @@ namespace storm {
             if (preparedModel.getModelType() == storm::jani::ModelType::MDP || preparedModel.getModelType() == storm::jani::ModelType::LTS || preparedModel.getModelType() == storm::jani::ModelType::MA) {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(variables.allNondeterminismVariables);
             }
-            modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables);
+            if (options.reachabilityStrategy == storm::utility::dd::ReachabilityStrategy::Chaining) {
+                for (auto& partition : system.transitionPartitions) {
+                    partition &= !terminalStates;
+                }
+                modelComponents.reachableStates = storm::utility::dd::computeReachableStatesByChaining(modelComponents.initialStates, system.transitionPartitions, variables.rowMetaVariables, variables.columnMetaVariables, variables.rowColumnMetaVariablePairs);
+            } else {
+                modelComponents.reachableStates = storm::utility::dd::computeReachableStates(modelComponents.initialStates, transitionMatrixBdd, variables.rowMetaVariables, variables.columnMetaVariables);
+            }
+            variables.manager->reorderIfNecessary();
             
             // Check that the reachable fragment does not overlap with the illegal fragment.
             storm::dd::Bdd<Type> reachableIllegalFragment = modelComponents.reachableStates && system.illegalFragment;
@@ -1998,6 +2127,16 @@ namespace storm {
             // Fix deadlocks if existing.
             modelComponents.deadlockStates = fixDeadlocks(preparedModel.getModelType(), modelComponents.transitionMatrix, transitionMatrixBdd, modelComponents.reachableStates, variables);
             
+            // If requested, keep the transition relation partitioned. The self-loops of the fixed deadlock states form
+            // a partition of their own.
+            bool partitionTransitionRelation = options.partitionTransitionRelation && preparedModel.getModelType() != storm::jani::ModelType::MA;
+            if (partitionTransitionRelation) {
+                for (auto& partition : system.transitionPartitions) {
+                    partition &= modelComponents.reachableStates && !terminalStates;
+                }
+                system.transitionPartitions.push_back(modelComponents.deadlockStates && variables.manager->getIdentity(variables.rowColumnMetaVariablePairs));
+            }
+            
             // Cut the deadlock states by removing all states that we 'converted' to deadlock states by making them terminal.
             modelComponents.deadlockStates = modelComponents.deadlockStates && !terminalStates;
             
@@ -2008,7 +2147,11 @@ namespace storm {
             modelComponents.labelToExpressionMap = buildLabelExpressions(preparedModel, variables, options);
             
             // Finally, create the model.
-            return createModel(preparedModel.getModelType(), variables, modelComponents);
+            std::shared_ptr<storm::models::symbolic::Model<Type, ValueType>> result = createModel(preparedModel.getModelType(), variables, modelComponents);
+            if (partitionTransitionRelation) {
+                result->setPartitionedTransitionRelation(std::make_shared<storm::dd::PartitionedTransitionRelation<Type>>(result->getQualitativeTransitionMatrix(), system.transitionPartitions, variables.rowColumnMetaVariablePairs));
+            }
+            return result;
         }
         
         template class DdJaniModelBuilder<storm::dd::DdType::CUDD, double>;
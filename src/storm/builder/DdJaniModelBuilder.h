@@ -5,6 +5,8 @@
 #include "storm/storage/dd/DdType.h"
 
 #include "storm/logic/Formula.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/utility/dd.h"
 
 
 namespace storm {
@@ -103,6 +105,15 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<storm::expressions::Expression> negatedTerminalStates;
+                
+                // The heuristic that determines the order of the DD variables.
+                storm::builder::DdVariableOrdering variableOrdering;
+                
+                // The strategy that is used to compute the reachable states.
+                storm::utility::dd::ReachabilityStrategy reachabilityStrategy;
+                
+                // A flag that indicates whether the model is to keep a partitioned representation of its transition relation.
+                bool partitionTransitionRelation;
             };
                         
             /*!
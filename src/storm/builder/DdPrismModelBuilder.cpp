@@ -23,8 +23,10 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 
 #include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/BuildSettings.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -92,10 +94,10 @@ namespace storm {
         template <storm::dd::DdType Type, typename ValueType>
         class DdPrismModelBuilder<Type, ValueType>::GenerationInformation {
         public:
-            GenerationInformation(storm::prism::Program const& program) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
+            GenerationInformation(storm::prism::Program const& program, storm::builder::DdVariableOrdering const& variableOrdering = storm::builder::DdVariableOrdering::Declaration) : program(program), manager(std::make_shared<storm::dd::DdManager<Type>>()), rowMetaVariables(), variableToRowMetaVariableMap(std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>()), rowExpressionAdapter(std::make_shared<storm::adapters::AddExpressionAdapter<Type, ValueType>>(manager, variableToRowMetaVariableMap)), columnMetaVariables(), variableToColumnMetaVariableMap((std::make_shared<std::map<storm::expressions::Variable, storm::expressions::Variable>>())), rowColumnMetaVariablePairs(), nondeterminismMetaVariables(), variableToIdentityMap(), allGlobalVariables(), moduleToIdentityMap(), parameters() {
                 
                 // Initializes variables and identity DDs.
-                createMetaVariablesAndIdentities();
+                createMetaVariablesAndIdentities(variableOrdering);
                 
                 // Initialize the parameters (if any).
                 ParameterCreator<Type, ValueType> parameterCreator;
@@ -152,10 +154,71 @@ namespace storm {
             std::set<storm::RationalFunctionVariable> parameters;
             
         private:
+            /*!
+             * Creates the meta variables for the variables of the program. The order in which they are created (and
+             * thereby the order of the DD variables) is determined by the given heuristic.
+             *
+             * @return A mapping from the program variables to their row and column meta variables.
+             */
+            std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> createProgramVariableMetaVariables(storm::builder::DdVariableOrdering const& variableOrdering) {
+                std::vector<std::vector<storm::expressions::Variable>> clusters;
+                std::map<storm::expressions::Variable, std::pair<int_fast64_t, int_fast64_t>> integerVariableToBoundsMap;
+                for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
+                    clusters.push_back({integerVariable.getExpressionVariable()});
+                    integerVariableToBoundsMap[integerVariable.getExpressionVariable()] = std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt());
+                }
+                for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
+                    clusters.push_back({booleanVariable.getExpressionVariable()});
+                }
+                
+                // Every command induces a dependency between the variables it reads and writes.
+                std::vector<std::set<storm::expressions::Variable>> dependencies;
+                for (storm::prism::Module const& module : program.getModules()) {
+                    clusters.emplace_back();
+                    for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
+                        clusters.back().push_back(integerVariable.getExpressionVariable());
+                        integerVariableToBoundsMap[integerVariable.getExpressionVariable()] = std::make_pair(integerVariable.getLowerBoundExpression().evaluateAsInt(), integerVariable.getUpperBoundExpression().evaluateAsInt());
+                    }
+                    for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
+                        clusters.back().push_back(booleanVariable.getExpressionVariable());
+                    }
+                    
+                    if (variableOrdering != storm::builder::DdVariableOrdering::Declaration) {
+                        for (storm::prism::Command const& command : module.getCommands()) {
+                            std::set<storm::expressions::Variable> dependency = command.getGuardExpression().getVariables();
+                            for (storm::prism::Update const& update : command.getUpdates()) {
+                                std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                                dependency.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                                for (storm::prism::Assignment const& assignment : update.getAssignments()) {
+                                    dependency.insert(assignment.getVariable());
+                                    std::set<storm::expressions::Variable> assignmentVariables = assignment.getExpression().getVariables();
+                                    dependency.insert(assignmentVariables.begin(), assignmentVariables.end());
+                                }
+                            }
+                            dependencies.push_back(std::move(dependency));
+                        }
+                    }
+                }
+                
+                std::vector<storm::expressions::Variable> order = storm::builder::computeDdVariableOrder(variableOrdering, clusters, dependencies);
+                STORM_LOG_DEBUG("Creating meta variables using the DD variable ordering '" << variableOrdering << "'.");
+                
+                std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> result;
+                for (auto const& variable : order) {
+                    auto boundsIt = integerVariableToBoundsMap.find(variable);
+                    if (boundsIt != integerVariableToBoundsMap.end()) {
+                        result[variable] = manager->addMetaVariable(variable.getName(), boundsIt->second.first, boundsIt->second.second);
+                    } else {
+                        result[variable] = manager->addMetaVariable(variable.getName());
+                    }
+                }
+                return result;
+            }
+            
             /*!
              * Creates the required meta variables and variable/module identities.
              */
-            void createMetaVariablesAndIdentities() {
+            void createMetaVariablesAndIdentities(storm::builder::DdVariableOrdering const& variableOrdering) {
                 // Add synchronization variables.
                 for (auto const& actionIndex : program.getSynchronizingActionIndices()) {
                     std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(program.getActionName(actionIndex));
@@ -175,11 +238,12 @@ namespace storm {
                     allNondeterminismVariables.insert(variablePair.first);
                 }
                 
-                // Create meta variables for global program variables.
+                // Create meta variables for all program variables.
+                std::map<storm::expressions::Variable, std::pair<storm::expressions::Variable, storm::expressions::Variable>> programVariableToMetaVariablesMap = createProgramVariableMetaVariables(variableOrdering);
+                
+                // Create the identities for global program variables.
                 for (storm::prism::IntegerVariable const& integerVariable : program.getGlobalIntegerVariables()) {
-                    int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                    int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = programVariableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                     
                     STORM_LOG_TRACE("Created meta variables for global integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -196,7 +260,7 @@ namespace storm {
                     allGlobalVariables.insert(integerVariable.getExpressionVariable());
                 }
                 for (storm::prism::BooleanVariable const& booleanVariable : program.getGlobalBooleanVariables()) {
-                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                    std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = programVariableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                     
                     STORM_LOG_TRACE("Created meta variables for global boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                     
@@ -219,9 +283,7 @@ namespace storm {
                     storm::dd::Bdd<Type> moduleRange = manager->getBddOne();
                     
                     for (storm::prism::IntegerVariable const& integerVariable : module.getIntegerVariables()) {
-                        int_fast64_t low = integerVariable.getLowerBoundExpression().evaluateAsInt();
-                        int_fast64_t high = integerVariable.getUpperBoundExpression().evaluateAsInt();
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(integerVariable.getName(), low, high);
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = programVariableToMetaVariablesMap.at(integerVariable.getExpressionVariable());
                         STORM_LOG_TRACE("Created meta variables for integer variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -238,7 +300,7 @@ namespace storm {
                         rowColumnMetaVariablePairs.push_back(variablePair);
                     }
                     for (storm::prism::BooleanVariable const& booleanVariable : module.getBooleanVariables()) {
-                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = manager->addMetaVariable(booleanVariable.getName());
+                        std::pair<storm::expressions::Variable, storm::expressions::Variable> variablePair = programVariableToMetaVariablesMap.at(booleanVariable.getExpressionVariable());
                         STORM_LOG_TRACE("Created meta variables for boolean variable: " << variablePair.first.getName() << "[" << variablePair.first.getIndex() << "] and " << variablePair.second.getName() << "[" << variablePair.second.getIndex() << "]");
                         
                         rowMetaVariables.insert(variablePair.first);
@@ -540,18 +602,18 @@ namespace storm {
         };
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options() : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()), reachabilityStrategy(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy()), partitionTransitionRelation(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdPartitionSet()) {
             // Intentionally left empty.
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(storm::logic::Formula const& formula) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(std::set<std::string>()), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()), reachabilityStrategy(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy()), partitionTransitionRelation(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdPartitionSet()) {
             this->preserveFormula(formula);
             this->setTerminalStatesFromFormula(formula);
         }
         
         template <storm::dd::DdType Type, typename ValueType>
-        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates() {
+        DdPrismModelBuilder<Type, ValueType>::Options::Options(std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas) : buildAllRewardModels(false), rewardModelsToBuild(), buildAllLabels(false), labelsToBuild(), terminalStates(), negatedTerminalStates(), variableOrdering(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdVariableOrdering()), reachabilityStrategy(storm::settings::getModule<storm::settings::modules::BuildSettings>().getDdReachabilityStrategy()), partitionTransitionRelation(storm::settings::getModule<storm::settings::modules::BuildSettings>().isDdPartitionSet()) {
             for (auto const& formula : formulas) {
                 this->preserveFormula(*formula);
             }
@@ -1155,6 +1217,33 @@ namespace storm {
             return result;
         }
         
+        template <storm::dd::DdType Type, typename ValueType>
+        std::vector<storm::dd::Bdd<Type>> DdPrismModelBuilder<Type, ValueType>::createTransitionPartitions(GenerationInformation& generationInfo, ModuleDecisionDiagram const& module) {
+            std::vector<ActionDecisionDiagram const*> actions = {&module.independentAction};
+            for (auto const& synchronizingAction : module.synchronizingActionToDecisionDiagramMap) {
+                actions.push_back(&synchronizingAction.second);
+            }
+            
+            // Every action yields one partition of the transition relation (without the nondeterminism encoding).
+            std::vector<storm::dd::Bdd<Type>> result;
+            for (auto const& action : actions) {
+                storm::dd::Bdd<Type> partition = action->transitionsDd.notZero();
+                for (auto const& variable : generationInfo.allGlobalVariables) {
+                    if (action->assignedGlobalVariables.find(variable) == action->assignedGlobalVariables.end()) {
+                        partition &= generationInfo.variableToIdentityMap.at(variable).notZero();
+                    }
+                }
+                
+                std::set<storm::expressions::Variable> nondeterminismVariables;
+                std::set_intersection(partition.getContainedMetaVariables().begin(), partition.getContainedMetaVariables().end(), generationInfo.allNondeterminismVariables.begin(), generationInfo.allNondeterminismVariables.end(), std::inserter(nondeterminismVariables, nondeterminismVariables.begin()));
+                if (!nondeterminismVariables.empty()) {
+                    partition = partition.existsAbstract(nondeterminismVariables);
+                }
+                result.push_back(partition);
+            }
+            return result;
+        }
+        
         template <storm::dd::DdType Type, typename ValueType>
         typename DdPrismModelBuilder<Type, ValueType>::SystemResult DdPrismModelBuilder<Type, ValueType>::createSystemDecisionDiagram(GenerationInformation& generationInfo) {
             ModuleComposer<Type, ValueType> composer(generationInfo);
@@ -1342,9 +1431,12 @@ namespace storm {
             
             // Start by initializing the structure used for storing all information needed during the model generation.
             // In particular, this creates the meta variables used to encode the model.
-            GenerationInformation generationInfo(program);
+            GenerationInformation generationInfo(program, options.variableOrdering);
             
             SystemResult system = createSystemDecisionDiagram(generationInfo);
+            
+            // Now that the system is built, the DDs are typically largest, so this is a good point to reorder (if requested).
+            generationInfo.manager->reorderIfNecessary();
             storm::dd::Add<Type, ValueType> transitionMatrix = system.allTransitionsDd;
             
             ModuleDecisionDiagram const& globalModule = system.globalModule;
@@ -1408,7 +1500,21 @@ namespace storm {
                 transitionMatrixBdd = transitionMatrixBdd.existsAbstract(generationInfo.allNondeterminismVariables);
             }
             
-            storm::dd::Bdd<Type> reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
+            std::vector<storm::dd::Bdd<Type>> transitionPartitions;
+            if (options.reachabilityStrategy == storm::utility::dd::ReachabilityStrategy::Chaining || options.partitionTransitionRelation) {
+                transitionPartitions = createTransitionPartitions(generationInfo, system.globalModule);
+                for (auto& partition : transitionPartitions) {
+                    partition &= !terminalStatesBdd;
+                }
+            }
+            
+            storm::dd::Bdd<Type> reachableStates;
+            if (options.reachabilityStrategy == storm::utility::dd::ReachabilityStrategy::Chaining) {
+                reachableStates = storm::utility::dd::computeReachableStatesByChaining<Type>(initialStates, transitionPartitions, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables, generationInfo.rowColumnMetaVariablePairs);
+            } else {
+                reachableStates = storm::utility::dd::computeReachableStates<Type>(initialStates, transitionMatrixBdd, generationInfo.rowMetaVariables, generationInfo.columnMetaVariables);
+            }
+            generationInfo.manager->reorderIfNecessary();
             storm::dd::Add<Type, ValueType> reachableStatesAdd = reachableStates.template toAdd<ValueType>();
             transitionMatrix *= reachableStatesAdd;
             if (system.stateActionDd) {
@@ -1454,6 +1560,11 @@ namespace storm {
                         }
                         transitionMatrix += deadlockStatesAdd * globalModule.identity * action;
                     }
+                    
+                    // The self-loops of the deadlock states form a partition of their own.
+                    if (options.partitionTransitionRelation) {
+                        transitionPartitions.push_back(deadlockStates && generationInfo.manager->getIdentity(generationInfo.rowColumnMetaVariablePairs));
+                    }
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The model contains " << deadlockStates.getNonZeroCount() << " deadlock states. Please unset the option to not fix deadlocks, if you want to fix them automatically.");
                 }
@@ -1504,6 +1615,13 @@ namespace storm {
                 result->addParameters(generationInfo.parameters);
             }
             
+            if (options.partitionTransitionRelation) {
+                for (auto& partition : transitionPartitions) {
+                    partition &= reachableStates;
+                }
+                result->setPartitionedTransitionRelation(std::make_shared<storm::dd::PartitionedTransitionRelation<Type>>(result->getQualitativeTransitionMatrix(), transitionPartitions, generationInfo.rowColumnMetaVariablePairs));
+            }
+            
             return result;
         }
         
@@ -5,6 +5,8 @@
 #include <boost/optional.hpp>
 
 #include "storm/storage/prism/Program.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/utility/dd.h"
 
 #include "storm/logic/Formulas.h"
 #include "storm/adapters/AddExpressionAdapter.h"
@@ -87,6 +89,15 @@ namespace storm {
                 // An optional expression or label whose negation characterizes (a subset of) the terminal states of the
                 // model. If this is set, the outgoing transitions of these states are replaced with a self-loop.
                 boost::optional<boost::variant<storm::expressions::Expression, std::string>> negatedTerminalStates;
+                
+                // The heuristic that determines the order of the DD variables.
+                storm::builder::DdVariableOrdering variableOrdering;
+                
+                // The strategy that is used to compute the reachable states.
+                storm::utility::dd::ReachabilityStrategy reachabilityStrategy;
+                
+                // A flag that indicates whether the model is to keep a partitioned representation of its transition relation.
+                bool partitionTransitionRelation;
             };
             
             /*!
@@ -236,6 +247,8 @@ namespace storm {
             
             static storm::dd::Add<Type, ValueType> createSystemFromModule(GenerationInformation& generationInfo, ModuleDecisionDiagram& module);
             
+            static std::vector<storm::dd::Bdd<Type>> createTransitionPartitions(GenerationInformation& generationInfo, ModuleDecisionDiagram const& module);
+            
             static std::unordered_map<std::string, storm::models::symbolic::StandardRewardModel<Type, ValueType>> createRewardModelDecisionDiagrams(std::vector<std::reference_wrapper<storm::prism::RewardModel const>> const& selectedRewardModels, SystemResult& system, GenerationInformation& generationInfo, ModuleDecisionDiagram const& globalModule, storm::dd::Add<Type, ValueType> const& reachableStatesAdd, storm::dd::Add<Type, ValueType> const& transitionMatrix);
 
             static storm::models::symbolic::StandardRewardModel<Type, ValueType> createRewardModelDecisionDiagrams(GenerationInformation& generationInfo, storm::prism::RewardModel const& rewardModel, ModuleDecisionDiagram const& globalModule, storm::dd::Add<Type, ValueType> const& reachableStatesAdd, storm::dd::Add<Type, ValueType> const& transitionMatrix, boost::optional<storm::dd::Add<Type, ValueType>>& stateActionDd);
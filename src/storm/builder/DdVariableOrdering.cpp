@@ -0,0 +1,190 @@
+#include "storm/builder/DdVariableOrdering.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace builder {
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering) {
+            switch (ordering) {
+                case DdVariableOrdering::Declaration:
+                    out << "declaration";
+                    break;
+                case DdVariableOrdering::Force:
+                    out << "force";
+                    break;
+                case DdVariableOrdering::ModuleForce:
+                    out << "module-force";
+                    break;
+                default:
+                    out << "undefined";
+                    break;
+            }
+            return out;
+        }
+
+        uint64_t computeTotalSpan(std::vector<uint64_t> const& order, std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t>& positions) {
+            for (uint64_t position = 0; position < order.size(); ++position) {
+                positions[order[position]] = position;
+            }
+
+            uint64_t result = 0;
+            for (auto const& hyperedge : hyperedges) {
+                if (hyperedge.empty()) {
+                    continue;
+                }
+                uint64_t minimalPosition = positions[hyperedge.front()];
+                uint64_t maximalPosition = minimalPosition;
+                for (auto const& item : hyperedge) {
+                    minimalPosition = std::min(minimalPosition, positions[item]);
+                    maximalPosition = std::max(maximalPosition, positions[item]);
+                }
+                result += maximalPosition - minimalPosition;
+            }
+            return result;
+        }
+
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfItems, std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t> const& initialOrder) {
+            std::vector<uint64_t> order = initialOrder;
+            if (order.empty()) {
+                order.resize(numberOfItems);
+                std::iota(order.begin(), order.end(), 0);
+            }
+            STORM_LOG_ASSERT(order.size() == numberOfItems, "Initial order has wrong size.");
+            if (numberOfItems <= 2 || hyperedges.empty()) {
+                return order;
+            }
+
+            std::vector<std::vector<uint64_t>> itemToHyperedges(numberOfItems);
+            for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                for (auto const& item : hyperedges[hyperedgeIndex]) {
+                    itemToHyperedges[item].push_back(hyperedgeIndex);
+                }
+            }
+
+            std::vector<uint64_t> positions(numberOfItems);
+            std::vector<double> centersOfGravity(hyperedges.size());
+            std::vector<double> newPositions(numberOfItems);
+
+            std::vector<uint64_t> bestOrder = order;
+            uint64_t bestSpan = computeTotalSpan(order, hyperedges, positions);
+            uint64_t lastSpan = bestSpan;
+
+            // The original paper suggests a logarithmic number of iterations.
+            uint64_t maximalIterations = 10 * static_cast<uint64_t>(std::ceil(std::log2(numberOfItems)));
+            for (uint64_t iteration = 0; iteration < maximalIterations; ++iteration) {
+                // Compute the centers of gravity of the hyperedges (the positions are set by computing the span).
+                for (uint64_t hyperedgeIndex = 0; hyperedgeIndex < hyperedges.size(); ++hyperedgeIndex) {
+                    auto const& hyperedge = hyperedges[hyperedgeIndex];
+                    double sum = 0;
+                    for (auto const& item : hyperedge) {
+                        sum += positions[item];
+                    }
+                    centersOfGravity[hyperedgeIndex] = hyperedge.empty() ? 0 : sum / hyperedge.size();
+                }
+
+                // Move every item to the average of the centers of gravity of its hyperedges.
+                for (uint64_t item = 0; item < numberOfItems; ++item) {
+                    if (itemToHyperedges[item].empty()) {
+                        newPositions[item] = positions[item];
+                    } else {
+                        double sum = 0;
+                        for (auto const& hyperedgeIndex : itemToHyperedges[item]) {
+                            sum += centersOfGravity[hyperedgeIndex];
+                        }
+                        newPositions[item] = sum / itemToHyperedges[item].size();
+                    }
+                }
+                std::stable_sort(order.begin(), order.end(), [&newPositions] (uint64_t const& first, uint64_t const& second) { return newPositions[first] < newPositions[second]; });
+
+                uint64_t span = computeTotalSpan(order, hyperedges, positions);
+                if (span < bestSpan) {
+                    bestSpan = span;
+                    bestOrder = order;
+                }
+                if (span >= lastSpan) {
+                    break;
+                }
+                lastSpan = span;
+            }
+
+            return bestOrder;
+        }
+
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(DdVariableOrdering const& ordering, std::vector<std::vector<storm::expressions::Variable>> const& clusters, std::vector<std::set<storm::expressions::Variable>> const& dependencies) {
+            std::vector<storm::expressions::Variable> variables;
+            std::vector<uint64_t> variableToCluster;
+            for (uint64_t clusterIndex = 0; clusterIndex < clusters.size(); ++clusterIndex) {
+                for (auto const& variable : clusters[clusterIndex]) {
+                    variables.push_back(variable);
+                    variableToCluster.push_back(clusterIndex);
+                }
+            }
+            if (ordering == DdVariableOrdering::Declaration) {
+                return variables;
+            }
+
+            std::unordered_map<storm::expressions::Variable, uint64_t> variableToIndex;
+            for (uint64_t index = 0; index < variables.size(); ++index) {
+                variableToIndex[variables[index]] = index;
+            }
+
+            // Translate the dependencies to hyperedges over the variable indices. Variables that are not to be ordered
+            // (e.g. constants) are ignored.
+            std::vector<std::vector<uint64_t>> hyperedges;
+            for (auto const& dependency : dependencies) {
+                std::vector<uint64_t> hyperedge;
+                for (auto const& variable : dependency) {
+                    auto it = variableToIndex.find(variable);
+                    if (it != variableToIndex.end()) {
+                        hyperedge.push_back(it->second);
+                    }
+                }
+                if (hyperedge.size() > 1) {
+                    hyperedges.push_back(std::move(hyperedge));
+                }
+            }
+
+            std::vector<uint64_t> variableOrder = computeForceOrder(variables.size(), hyperedges);
+            std::vector<storm::expressions::Variable> result;
+            result.reserve(variables.size());
+            if (ordering == DdVariableOrdering::Force) {
+                for (auto const& index : variableOrder) {
+                    result.push_back(variables[index]);
+                }
+                return result;
+            }
+
+            // Otherwise, the variables of a cluster are kept together. We order the clusters using the dependencies
+            // between them and order the variables within each cluster according to the variable order.
+            std::vector<std::vector<uint64_t>> clusterHyperedges;
+            for (auto const& hyperedge : hyperedges) {
+                std::set<uint64_t> clustersOfHyperedge;
+                for (auto const& index : hyperedge) {
+                    clustersOfHyperedge.insert(variableToCluster[index]);
+                }
+                if (clustersOfHyperedge.size() > 1) {
+                    clusterHyperedges.emplace_back(clustersOfHyperedge.begin(), clustersOfHyperedge.end());
+                }
+            }
+            std::vector<uint64_t> clusterOrder = computeForceOrder(clusters.size(), clusterHyperedges);
+
+            std::vector<std::vector<uint64_t>> clusterToVariables(clusters.size());
+            for (auto const& index : variableOrder) {
+                clusterToVariables[variableToCluster[index]].push_back(index);
+            }
+            for (auto const& clusterIndex : clusterOrder) {
+                for (auto const& index : clusterToVariables[clusterIndex]) {
+                    result.push_back(variables[index]);
+                }
+            }
+            return result;
+        }
+
+    }
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <ostream>
+#include <set>
+#include <vector>
+
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace builder {
+
+        // An enum that contains all currently supported heuristics for the static order of DD variables.
+        enum class DdVariableOrdering { Declaration, Force, ModuleForce };
+
+        std::ostream& operator<<(std::ostream& out, DdVariableOrdering const& ordering);
+
+        /*!
+         * Computes an order of items based on the FORCE heuristic (Aloul et al., GLSVLSI'03). Items that are connected
+         * by a hyperedge are iteratively moved towards the center of gravity of this hyperedge, which tends to place
+         * related items close to each other. The order with the smallest total span of the hyperedges is returned.
+         *
+         * @param numberOfItems The number of items to order.
+         * @param hyperedges The hyperedges connecting the items.
+         * @param initialOrder The order from which to start. If empty, the items are initially ordered by their index.
+         * @return The order, i.e. the i-th entry is the item that is placed at position i.
+         */
+        std::vector<uint64_t> computeForceOrder(uint64_t numberOfItems, std::vector<std::vector<uint64_t>> const& hyperedges, std::vector<uint64_t> const& initialOrder = std::vector<uint64_t>());
+
+        /*!
+         * Computes the order in which the DD variables of the given (program) variables are to be created.
+         *
+         * @param ordering The heuristic to use.
+         * @param clusters The variables in declaration order, grouped by the modules/automata they belong to. Global
+         * variables are expected to form clusters of their own.
+         * @param dependencies Sets of variables that depend on each other, e.g. the variables read or written by a command.
+         * @return The order of the variables.
+         */
+        std::vector<storm::expressions::Variable> computeDdVariableOrder(DdVariableOrdering const& ordering, std::vector<std::vector<storm::expressions::Variable>> const& clusters, std::vector<std::set<storm::expressions::Variable>> const& dependencies);
+
+    }
+}
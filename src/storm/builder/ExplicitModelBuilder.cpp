@@ -1,5 +1,6 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <algorithm>
 #include <map>
 
 #include "storm/models/sparse/Dtmc.h"
@@ -43,12 +44,14 @@ namespace storm {
     namespace builder {
                         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()) {
-            // Intentionally left empty.
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::Options::Options() : explorationOrder(storm::settings::getModule<storm::settings::modules::BuildSettings>().getExplorationOrder()), spillThreshold(storm::settings::getModule<storm::settings::modules::BuildSettings>().getSpillThreshold()) {
+            if (storm::settings::getModule<storm::settings::modules::BuildSettings>().isSpillDirectorySet()) {
+                spillDirectory = storm::settings::getModule<storm::settings::modules::BuildSettings>().getSpillDirectory();
+            }
         }
         
         template <typename ValueType, typename RewardModelType, typename StateType>
-        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize()) {
+        ExplicitModelBuilder<ValueType, RewardModelType, StateType>::ExplicitModelBuilder(std::shared_ptr<storm::generator::NextStateGenerator<ValueType, StateType>> const& generator, Options const& options) : generator(generator), options(options), stateStorage(generator->getStateSize(), options.spillDirectory) {
             // Intentionally left empty.
         }
         
@@ -92,21 +95,91 @@ namespace storm {
             StateType actualIndex = actualIndexBucketPair.first;
             
             if (actualIndex == newIndex) {
-                if (options.explorationOrder == ExplorationOrder::Dfs) {
-                    statesToExplore.emplace_front(state, actualIndex);
-
-                    // Reserve one slot for the new state in the remapping.
+                // Reserve one slot for the new state in the remapping.
+                if (stateRemapping) {
                     stateRemapping.get().push_back(storm::utility::zero<StateType>());
-                } else if (options.explorationOrder == ExplorationOrder::Bfs) {
-                    statesToExplore.emplace_back(state, actualIndex);
-                } else {
-                    STORM_LOG_ASSERT(false, "Invalid exploration order.");
                 }
+                
+                if (prob01Analysis) {
+                    newStates.emplace_back(state, actualIndex);
+                }
+                addStateToExplore(state, actualIndex);
             }
             
             return actualIndex;
         }
         
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addStateToExplore(CompressedState const& state, StateType index) {
+            if (options.explorationOrder == ExplorationOrder::Dfs) {
+                statesToExplore.emplace_front(state, index);
+            } else if (options.explorationOrder == ExplorationOrder::Bfs) {
+                if (spillingStatesToExplore) {
+                    spillingStatesToExplore->push(state, index);
+                } else {
+                    statesToExplore.emplace_back(state, index);
+                }
+            } else {
+                STORM_LOG_ASSERT(false, "Invalid exploration order.");
+            }
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        bool ExplicitModelBuilder<ValueType, RewardModelType, StateType>::hasStatesToExplore() const {
+            return spillingStatesToExplore ? !spillingStatesToExplore->empty() : !statesToExplore.empty();
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        std::pair<CompressedState, StateType> ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getNextStateToExplore() {
+            if (spillingStatesToExplore) {
+                return spillingStatesToExplore->pop();
+            }
+            std::pair<CompressedState, StateType> result = std::move(statesToExplore.front());
+            statesToExplore.pop_front();
+            return result;
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::classifyNewStates() {
+            // Since the generator has to load the states, this must not be done while a state is expanded.
+            std::vector<bool> const& terminalStateProbabilities = generator->getOptions().getTerminalStateProbabilities();
+            for (auto const& stateIndexPair : newStates) {
+                generator->load(stateIndexPair.first);
+                boost::optional<uint64_t> terminalStateIndex = generator->getTerminalStateIndex();
+                if (terminalStateIndex) {
+                    prob01Analysis->setTerminalState(stateIndexPair.second, terminalStateProbabilities[terminalStateIndex.get()]);
+                }
+            }
+            newStates.clear();
+        }
+        
+        template <typename ValueType, typename RewardModelType, typename StateType>
+        void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::addSelfLoop(StateType index, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<storm::storage::BitVector>& markovianStates) {
+            if (markovianStates) {
+                markovianStates.get().grow(currentRowGroup + 1, false);
+                markovianStates.get().set(currentRowGroup);
+            }
+            
+            if (!generator->isDeterministicModel()) {
+                transitionMatrixBuilder.newRowGroup(currentRow);
+            }
+            
+            transitionMatrixBuilder.addNextValue(currentRow, index, storm::utility::one<ValueType>());
+            
+            for (auto& rewardModelBuilder : rewardModelBuilders) {
+                if (rewardModelBuilder.hasStateRewards()) {
+                    rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
+                }
+                
+                if (rewardModelBuilder.hasStateActionRewards()) {
+                    rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
+                }
+            }
+            
+            ++currentRow;
+            ++currentRowGroup;
+        }
+        
         template <typename ValueType, typename RewardModelType, typename StateType>
         void ExplicitModelBuilder<ValueType, RewardModelType, StateType>::buildMatrices(storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, ChoiceInformationBuilder& choiceInformationBuilder, boost::optional<storm::storage::BitVector>& markovianStates) {
             
@@ -119,15 +192,38 @@ namespace storm {
             // Create a callback for the next-state generator to enable it to request the index of states.
             std::function<StateType (CompressedState const&)> stateToIdCallback = std::bind(&ExplicitModelBuilder<ValueType, RewardModelType, StateType>::getOrAddStateIndex, this, std::placeholders::_1);
             
-            // If the exploration order is something different from breadth-first, we need to keep track of the remapping
-            // from state ids to row groups. For this, we actually store the reversed mapping of row groups to state-ids
-            // and later reverse it.
-            if (options.explorationOrder != ExplorationOrder::Bfs) {
+            // If requested, find the states with probability zero or one for the property during the exploration.
+            // This requires to know the probabilities of the terminal states.
+            if (generator->getOptions().isProb01PruningSet()) {
+                if (generator->getOptions().hasTerminalStateProbabilities()) {
+                    prob01Analysis = std::make_unique<IncrementalProb01Analysis<StateType>>(generator->getOptions().getOptimizationDirection());
+                } else {
+                    STORM_LOG_WARN("Pruning states with probability zero or one requires an unbounded reachability, until or globally formula and is disabled.");
+                }
+            }
+            
+            // If the exploration order is something different from breadth-first or states may be deferred, we need to
+            // keep track of the remapping from state ids to row groups. For this, we actually store the reversed
+            // mapping of row groups to state-ids and later reverse it.
+            if (options.explorationOrder != ExplorationOrder::Bfs || prob01Analysis) {
                 stateRemapping = std::vector<uint_fast64_t>();
             }
             
+            // If requested, the states to explore are partly kept on disk. This relies on the order in which the
+            // states are taken from the queue being the one in which they are added.
+            if (options.spillDirectory) {
+                if (options.explorationOrder == ExplorationOrder::Bfs) {
+                    spillingStatesToExplore = std::make_unique<storm::storage::sparse::SpillingStateQueue<StateType>>(options.spillThreshold, options.spillDirectory.get());
+                } else {
+                    STORM_LOG_WARN("Writing the states to explore to disk requires breadth-first exploration and is disabled.");
+                }
+            }
+            
             // Let the generator create all initial states.
             this->stateStorage.initialStateIndices = generator->getInitialStates(stateToIdCallback);
+            if (prob01Analysis) {
+                classifyNewStates();
+            }
             
             // Now explore the current state until there is no more reachable state.
             uint_fast64_t currentRowGroup = 0;
@@ -139,15 +235,22 @@ namespace storm {
             uint64_t numberOfExploredStatesSinceLastMessage = 0;
             
             // Perform a search through the model.
-            while (!statesToExplore.empty()) {
+            while (hasStatesToExplore()) {
                 // Get the first state in the queue.
-                CompressedState currentState = statesToExplore.front().first;
-                StateType currentIndex = statesToExplore.front().second;
-                statesToExplore.pop_front();
+                std::pair<CompressedState, StateType> currentStateIndexPair = getNextStateToExplore();
+                StateType currentIndex = currentStateIndexPair.second;
+                
+                // If only decided states reach the state, its behavior cannot influence their probability, so its
+                // exploration is deferred until an undecided state reaches it.
+                if (prob01Analysis && !prob01Analysis->isDecided(currentIndex) && !prob01Analysis->hasUndecidedPredecessor(currentIndex) && std::find(this->stateStorage.initialStateIndices.begin(), this->stateStorage.initialStateIndices.end(), currentIndex) == this->stateStorage.initialStateIndices.end()) {
+                    deferredStates.emplace(currentIndex, std::move(currentStateIndexPair.first));
+                    continue;
+                }
+                CompressedState const& currentState = currentStateIndexPair.first;
                 
                 // If the exploration order differs from breadth-first, we remember that this row group was actually
                 // filled with the transitions of a different state.
-                if (options.explorationOrder != ExplorationOrder::Bfs) {
+                if (stateRemapping) {
                     stateRemapping.get()[currentIndex] = currentRowGroup;
                 }
                 
@@ -166,29 +269,7 @@ namespace storm {
                             this->stateStorage.deadlockStateIndices.push_back(currentIndex);
                         }
                         
-                        if (markovianStates) {
-                            markovianStates.get().grow(currentRowGroup + 1, false);
-                            markovianStates.get().set(currentRowGroup);
-                        }
-                        
-                        if (!generator->isDeterministicModel()) {
-                            transitionMatrixBuilder.newRowGroup(currentRow);
-                        }
-                        
-                        transitionMatrixBuilder.addNextValue(currentRow, currentIndex, storm::utility::one<ValueType>());
-                        
-                        for (auto& rewardModelBuilder : rewardModelBuilders) {
-                            if (rewardModelBuilder.hasStateRewards()) {
-                                rewardModelBuilder.addStateReward(storm::utility::zero<ValueType>());
-                            }
-                            
-                            if (rewardModelBuilder.hasStateActionRewards()) {
-                                rewardModelBuilder.addStateActionReward(storm::utility::zero<ValueType>());
-                            }
-                        }
-                        
-                        ++currentRow;
-                        ++currentRowGroup;
+                        addSelfLoop(currentIndex, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, markovianStates);
                     } else {
                         STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Error while creating sparse matrix from probabilistic program: found deadlock state (" << generator->toValuation(currentState).toString(true) << "). For fixing these, please provide the appropriate option.");
                     }
@@ -242,6 +323,35 @@ namespace storm {
                         ++currentRow;
                     }
                     ++currentRowGroup;
+                    
+                    if (prob01Analysis) {
+                        std::vector<std::vector<StateType>> choices;
+                        for (auto const& choice : behavior) {
+                            choices.emplace_back();
+                            for (auto const& stateProbabilityPair : choice) {
+                                choices.back().push_back(stateProbabilityPair.first);
+                            }
+                        }
+                        
+                        // The terminal successors need to be known to decide the state, and the state has to be decided
+                        // before its successors are explored.
+                        classifyNewStates();
+                        prob01Analysis->setExpandedState(currentIndex, std::move(choices));
+                        
+                        // If the state is not decided, the states it reaches may influence its probability, so they
+                        // need to be explored.
+                        if (!prob01Analysis->isDecided(currentIndex)) {
+                            for (auto const& choice : behavior) {
+                                for (auto const& stateProbabilityPair : choice) {
+                                    auto deferredStateIt = deferredStates.find(stateProbabilityPair.first);
+                                    if (deferredStateIt != deferredStates.end()) {
+                                        addStateToExplore(deferredStateIt->second, deferredStateIt->first);
+                                        deferredStates.erase(deferredStateIt);
+                                    }
+                                }
+                            }
+                        }
+                    }
                 }
                 
                 if (generator->getOptions().isShowProgressSet()) {
@@ -260,14 +370,30 @@ namespace storm {
                 }
             }
             
+            // The states that are still deferred are only reached by decided states and become absorbing.
+            if (prob01Analysis) {
+                STORM_LOG_INFO("Found " << prob01Analysis->getNumberOfDecidedStates() << " states with probability zero or one during the exploration and did not expand " << deferredStates.size() << " states.");
+                for (auto const& indexStatePair : deferredStates) {
+                    stateRemapping.get()[indexStatePair.first] = currentRowGroup;
+                    addSelfLoop(indexStatePair.first, currentRow, currentRowGroup, transitionMatrixBuilder, rewardModelBuilders, markovianStates);
+                }
+                deferredStates.clear();
+                prob01Analysis.reset();
+            }
+            
+            if (spillingStatesToExplore) {
+                STORM_LOG_INFO("At most " << spillingStatesToExplore->getMaximalNumberOfSpilledStates() << " states to explore were stored on disk.");
+                spillingStatesToExplore.reset();
+            }
+            
             if (markovianStates) {
                 // Since we now know the correct size, cut the bit vector to the correct length.
                 markovianStates->resize(currentRowGroup, false);
             }
 
-            // If the exploration order was not breadth-first, we need to fix the entries in the matrix according to
-            // (reversed) mapping of row groups to indices.
-            if (options.explorationOrder != ExplorationOrder::Bfs) {
+            // If the exploration order was not breadth-first or states were deferred, we need to fix the entries in the
+            // matrix according to (reversed) mapping of row groups to indices.
+            if (stateRemapping) {
                 STORM_LOG_ASSERT(stateRemapping, "Unable to fix columns without mapping.");
                 std::vector<uint_fast64_t> const& remapping = stateRemapping.get();
                 
@@ -287,6 +413,7 @@ namespace storm {
                 
                 // Fix (c).
                 this->stateStorage.stateToId.remap([&remapping] (StateType const& state) { return remapping[state]; } );
+                stateRemapping = boost::none;
             }
         }
         
@@ -308,8 +435,22 @@ namespace storm {
             
             buildMatrices(transitionMatrixBuilder, rewardModelBuilders, choiceInformationBuilder, markovianStates);
             
+            // First build the components that refer to the states themselves. Afterwards, the state storage is not
+            // needed anymore and is released before the remaining components are built.
+            storm::models::sparse::StateLabeling stateLabeling = buildStateLabeling();
+            boost::optional<storm::storage::sparse::StateValuations> stateValuations;
+            if (generator->getOptions().isBuildStateValuationsSet()) {
+                stateValuations = generator->createStateValuations(transitionMatrixBuilder.getCurrentRowGroupCount());
+                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
+                    stateValuations->setStateValuation(bitVectorIndexPair.second, bitVectorIndexPair.first);
+                }
+            }
+            
+            stateStorage.stateToId = storm::storage::BitVectorHashMap<StateType>(stateStorage.bitsPerState, 0);
+            
             // Initialize the model components with the obtained information.
-            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), buildStateLabeling(), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> modelComponents(transitionMatrixBuilder.build(0, transitionMatrixBuilder.getCurrentRowGroupCount()), std::move(stateLabeling), std::unordered_map<std::string, RewardModelType>(), !generator->isDiscreteTimeModel(), std::move(markovianStates));
+            modelComponents.stateValuations = std::move(stateValuations);
             
             // Now finalize all reward models.
             for (auto& rewardModelBuilder : rewardModelBuilders) {
@@ -318,14 +459,7 @@ namespace storm {
             // Build the choice labeling
             modelComponents.choiceLabeling = choiceInformationBuilder.buildChoiceLabeling(modelComponents.transitionMatrix.getRowCount());
             
-            // If requested, build the state valuations and choice origins
-            if (generator->getOptions().isBuildStateValuationsSet()) {
-                std::vector<storm::expressions::SimpleValuation> valuations(modelComponents.transitionMatrix.getRowGroupCount());
-                for (auto const& bitVectorIndexPair : stateStorage.stateToId) {
-                    valuations[bitVectorIndexPair.second] = generator->toValuation(bitVectorIndexPair.first);
-                }
-                modelComponents.stateValuations = storm::storage::sparse::StateValuations(std::move(valuations));
-            }
+            // If requested, build the choice origins.
             if (generator->getOptions().isBuildChoiceOriginsSet()) {
                 auto originData = choiceInformationBuilder.buildDataOfChoiceOrigins(modelComponents.transitionMatrix.getRowCount());
                 modelComponents.choiceOrigins = generator->generateChoiceOrigins(originData);
@@ -5,6 +5,7 @@
 #include <utility>
 #include <vector>
 #include <deque>
+#include <map>
 #include <cstdint>
 #include <boost/functional/hash.hpp>
 #include <boost/container/flat_set.hpp>
@@ -22,11 +23,13 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ModelComponents.h"
 #include "storm/storage/sparse/StateStorage.h"
+#include "storm/storage/sparse/SpillingStateQueue.h"
 #include "storm/settings/SettingsManager.h"
 
 #include "storm/utility/prism.h"
 
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/IncrementalProb01Analysis.h"
 
 #include "storm/generator/NextStateGenerator.h"
 #include "storm/generator/CompressedState.h"
@@ -58,6 +61,13 @@ namespace storm {
                 
                 // The order in which to explore the model.
                 ExplorationOrder explorationOrder;
+                
+                // If set, the states that are still to be explored are partly written to a file in this directory and the
+                // explored states are held in a memory-mapped file in it.
+                boost::optional<std::string> spillDirectory;
+                
+                // The number of states to explore that are kept in memory if states are written to disk.
+                uint64_t spillThreshold;
             };
             
             /*!
@@ -101,6 +111,31 @@ namespace storm {
              * @return A pair indicating whether the state was already discovered before and the state id of the state.
              */
             StateType getOrAddStateIndex(CompressedState const& state);
+            
+            /*!
+             * Adds the given state to the states that still need to be explored.
+             */
+            void addStateToExplore(CompressedState const& state, StateType index);
+            
+            /*!
+             * Retrieves whether there are states left to explore.
+             */
+            bool hasStatesToExplore() const;
+            
+            /*!
+             * Removes the next state to explore from the queue of states to explore and returns it along with its id.
+             */
+            std::pair<CompressedState, StateType> getNextStateToExplore();
+            
+            /*!
+             * Declares all states that were found since the last call and that are terminal as decided.
+             */
+            void classifyNewStates();
+            
+            /*!
+             * Adds a self-loop for the given state, which is not expanded (further), to the matrix.
+             */
+            void addSelfLoop(StateType index, uint_fast64_t& currentRow, uint_fast64_t& currentRowGroup, storm::storage::SparseMatrixBuilder<ValueType>& transitionMatrixBuilder, std::vector<RewardModelBuilder<typename RewardModelType::ValueType>>& rewardModelBuilders, boost::optional<storm::storage::BitVector>& markovianStates);
     
             /*!
              * Builds the transition matrix and the transition reward matrix based for the given program.
@@ -138,9 +173,21 @@ namespace storm {
             /// A set of states that still need to be explored.
             std::deque<std::pair<CompressedState, StateType>> statesToExplore;
             
+            /// If set, the queue that replaces the set of states to explore when states are written to disk.
+            std::unique_ptr<storm::storage::sparse::SpillingStateQueue<StateType>> spillingStatesToExplore;
+            
             /// An optional mapping from state indices to the row groups in which they actually reside. This needs to be
-            /// built in case the exploration order is not BFS.
+            /// built in case the exploration order is not BFS or states are deferred.
             boost::optional<std::vector<uint_fast64_t>> stateRemapping;
+            
+            /// If set, the analysis that finds the states with probability zero or one during the exploration.
+            std::unique_ptr<IncrementalProb01Analysis<StateType>> prob01Analysis;
+            
+            /// The states that were found since the new states were last classified.
+            std::vector<std::pair<CompressedState, StateType>> newStates;
+            
+            /// The states whose exploration is deferred, because only decided states reach them.
+            std::map<StateType, CompressedState> deferredStates;
 
         };
         
@@ -0,0 +1,145 @@
+#include "storm/builder/IncrementalProb01Analysis.h"
+
+#include <algorithm>
+
+namespace storm {
+    namespace builder {
+
+        template<typename StateType>
+        IncrementalProb01Analysis<StateType>::IncrementalProb01Analysis(boost::optional<storm::OptimizationDirection> const& optimizationDirection) : optimizationDirection(optimizationDirection) {
+            // Intentionally left empty.
+        }
+
+        template<typename StateType>
+        void IncrementalProb01Analysis<StateType>::setTerminalState(StateType state, bool probabilityOne) {
+            if (!isDecided(state)) {
+                decide(state, probabilityOne);
+            }
+        }
+
+        template<typename StateType>
+        void IncrementalProb01Analysis<StateType>::setExpandedState(StateType state, std::vector<std::vector<StateType>>&& choices) {
+            grow(state);
+
+            // Register the state as a predecessor of each of its successors (once).
+            std::vector<StateType> successors;
+            for (auto const& choice : choices) {
+                successors.insert(successors.end(), choice.begin(), choice.end());
+            }
+            std::sort(successors.begin(), successors.end());
+            successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+            for (auto const& successor : successors) {
+                grow(successor);
+                predecessors[successor].push_back(state);
+            }
+
+            boost::optional<bool> probabilityOne = getImpliedProbability(choices);
+            if (probabilityOne) {
+                decide(state, probabilityOne.get());
+            } else {
+                undecidedChoices[state] = std::move(choices);
+            }
+        }
+
+        template<typename StateType>
+        bool IncrementalProb01Analysis<StateType>::isDecided(StateType state) const {
+            return state < decidedStates.size() && decidedStates.get(state);
+        }
+
+        template<typename StateType>
+        bool IncrementalProb01Analysis<StateType>::hasUndecidedPredecessor(StateType state) const {
+            if (state >= predecessors.size()) {
+                return false;
+            }
+            return std::any_of(predecessors[state].begin(), predecessors[state].end(), [this] (StateType const& predecessor) { return !this->isDecided(predecessor); });
+        }
+
+        template<typename StateType>
+        uint64_t IncrementalProb01Analysis<StateType>::getNumberOfDecidedStates() const {
+            return decidedStates.getNumberOfSetBits();
+        }
+
+        template<typename StateType>
+        boost::optional<bool> IncrementalProb01Analysis<StateType>::getImpliedProbability(std::vector<std::vector<StateType>> const& choices) const {
+            if (choices.empty()) {
+                return boost::none;
+            }
+
+            bool allChoicesOne = true;
+            bool allChoicesZero = true;
+            for (auto const& choice : choices) {
+                bool choiceOne = true;
+                bool choiceZero = true;
+                for (auto const& successor : choice) {
+                    if (!isDecided(successor)) {
+                        choiceOne = false;
+                        choiceZero = false;
+                        break;
+                    } else if (probabilityOneStates.get(successor)) {
+                        choiceZero = false;
+                    } else {
+                        choiceOne = false;
+                    }
+                }
+
+                // If the nondeterminism is resolved in a known way, a single choice may already imply the probability.
+                if (optimizationDirection) {
+                    if (choiceOne && storm::solver::maximize(optimizationDirection.get())) {
+                        return true;
+                    } else if (choiceZero && storm::solver::minimize(optimizationDirection.get())) {
+                        return false;
+                    }
+                }
+                allChoicesOne &= choiceOne;
+                allChoicesZero &= choiceZero;
+            }
+
+            if (allChoicesOne) {
+                return true;
+            } else if (allChoicesZero) {
+                return false;
+            }
+            return boost::none;
+        }
+
+        template<typename StateType>
+        void IncrementalProb01Analysis<StateType>::decide(StateType state, bool probabilityOne) {
+            grow(state);
+            decidedStates.set(state);
+            probabilityOneStates.set(state, probabilityOne);
+            undecidedChoices.erase(state);
+
+            std::vector<StateType> stack = {state};
+            while (!stack.empty()) {
+                StateType currentState = stack.back();
+                stack.pop_back();
+
+                // Check whether the probability of the undecided predecessors is now implied.
+                for (auto const& predecessor : predecessors[currentState]) {
+                    auto choicesIt = undecidedChoices.find(predecessor);
+                    if (choicesIt != undecidedChoices.end()) {
+                        boost::optional<bool> predecessorProbabilityOne = getImpliedProbability(choicesIt->second);
+                        if (predecessorProbabilityOne) {
+                            undecidedChoices.erase(choicesIt);
+                            decidedStates.set(predecessor);
+                            probabilityOneStates.set(predecessor, predecessorProbabilityOne.get());
+                            stack.push_back(predecessor);
+                        }
+                    }
+                }
+            }
+        }
+
+        template<typename StateType>
+        void IncrementalProb01Analysis<StateType>::grow(StateType state) {
+            if (state >= predecessors.size()) {
+                predecessors.resize(state + 1);
+            }
+            decidedStates.grow(state + 1);
+            probabilityOneStates.grow(state + 1);
+        }
+
+        template class IncrementalProb01Analysis<uint32_t>;
+
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+    namespace builder {
+
+        /*!
+         * This class finds states whose probability to satisfy a reachability, until or globally formula is zero or
+         * one while the model is explored. A state is decided once it is terminal or once its choices imply its
+         * probability given the probabilities of the decided successors, e.g. if all its successors are decided and
+         * have probability one. Cyclic dependencies are not resolved, so not all states with probability zero or one
+         * are found.
+         */
+        template<typename StateType>
+        class IncrementalProb01Analysis {
+        public:
+            /*!
+             * Creates an analysis in which no state is decided yet.
+             *
+             * @param optimizationDirection If given, the nondeterminism is resolved in this way, so a single choice
+             * can decide the probability of a state.
+             */
+            IncrementalProb01Analysis(boost::optional<storm::OptimizationDirection> const& optimizationDirection);
+
+            /*!
+             * Declares the given state as a terminal state with the given probability.
+             */
+            void setTerminalState(StateType state, bool probabilityOne);
+
+            /*!
+             * Declares the given state as expanded. If its successors imply its probability, it is decided and so
+             * are all its predecessors whose probability is then implied.
+             *
+             * @param state The expanded state.
+             * @param choices For each choice of the state, the successor states.
+             */
+            void setExpandedState(StateType state, std::vector<std::vector<StateType>>&& choices);
+
+            /*!
+             * Retrieves whether the probability of the given state is known to be zero or one.
+             */
+            bool isDecided(StateType state) const;
+
+            /*!
+             * Retrieves whether the given state is the successor of an expanded state that is not decided.
+             */
+            bool hasUndecidedPredecessor(StateType state) const;
+
+            /*!
+             * Retrieves the number of states whose probability is known to be zero or one.
+             */
+            uint64_t getNumberOfDecidedStates() const;
+
+        private:
+            /*!
+             * Retrieves the probability (one if true, zero if false) that the given choices imply, if any.
+             */
+            boost::optional<bool> getImpliedProbability(std::vector<std::vector<StateType>> const& choices) const;
+
+            /*!
+             * Decides the given state and all predecessors whose probability is then implied.
+             */
+            void decide(StateType state, bool probabilityOne);
+
+            /*!
+             * Makes sure that the given state can be stored.
+             */
+            void grow(StateType state);
+
+            /// If set, the nondeterminism is resolved in this way.
+            boost::optional<storm::OptimizationDirection> optimizationDirection;
+
+            /// The states whose probability is known to be zero or one.
+            storm::storage::BitVector decidedStates;
+
+            /// The decided states whose probability is one.
+            storm::storage::BitVector probabilityOneStates;
+
+            /// For each state, the expanded states of which it is a successor.
+            std::vector<std::vector<StateType>> predecessors;
+
+            /// The choices of the expanded states that are not decided.
+            std::unordered_map<StateType, std::vector<std::vector<StateType>>> undecidedChoices;
+        };
+
+    }
+}
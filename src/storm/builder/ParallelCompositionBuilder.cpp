@@ -1,6 +1,10 @@
 #include "storm/builder/ParallelCompositionBuilder.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     namespace builder {
@@ -160,6 +164,32 @@ namespace storm {
             return composedCtmc;
         }
 
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuilder<ValueType>::composeMinimized(std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& ctmcs, bool labelAnd, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+            STORM_LOG_THROW(!ctmcs.empty(), storm::exceptions::InvalidArgumentException, "Cannot compose an empty set of Markov chains.");
+
+            std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composedCtmc = minimize(ctmcs.front(), formulas, type);
+            for (auto ctmcIt = std::next(ctmcs.begin()); ctmcIt != ctmcs.end(); ++ctmcIt) {
+                composedCtmc = minimize(compose(composedCtmc, minimize(*ctmcIt, formulas, type), labelAnd), formulas, type);
+                STORM_LOG_DEBUG("Minimized intermediate composition has " << composedCtmc->getNumberOfStates() << " states and " << composedCtmc->getNumberOfTransitions() << " transitions.");
+            }
+            return composedCtmc;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> ParallelCompositionBuilder<ValueType>::minimize(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type) {
+            // We only preserve the atomic propositions (and bounds) of the formulas, but do not use a measure-driven
+            // initial partition, because making states absorbing is not compatible with the later composition.
+            typename storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>>::Options options;
+            for (auto const& formula : formulas) {
+                options.preserveFormula(*formula);
+            }
+            options.setType(type);
+
+            storm::storage::DeterministicModelBisimulationDecomposition<storm::models::sparse::Ctmc<ValueType>> decomposition(*ctmc, options);
+            decomposition.computeBisimulationDecomposition();
+            return decomposition.getQuotient();
+        }
 
         // Explicitly instantiate the class.
         template class ParallelCompositionBuilder<double>;
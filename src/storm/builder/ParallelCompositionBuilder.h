@@ -1,7 +1,12 @@
 #ifndef PARALLELCOMPOSITIONBUILDER_H
 #define	PARALLELCOMPOSITIONBUILDER_H
 
+#include <memory>
+#include <vector>
+
+#include "storm/logic/Formula.h"
 #include "storm/models/sparse/Ctmc.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
 
 namespace storm {
     namespace builder {
@@ -16,6 +21,26 @@ namespace storm {
 
             static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> compose(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcA, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmcB, bool labelAnd);
 
+            /*!
+             * Builds the parallel composition of the given Markov chains compositionally. That is, every Markov chain
+             * is minimized wrt. bisimulation before it is composed and every intermediate composition is minimized
+             * again. As bisimulation is a congruence wrt. parallel composition, the result is bisimilar to the
+             * (minimized) full product, but the full product is never built.
+             *
+             * @param ctmcs The Markov chains to compose. Must not be empty.
+             * @param labelAnd If set, a label holds in a composed state iff it holds in all components.
+             * @param formulas The formulas whose atomic propositions are preserved. If empty, all labels are preserved.
+             * @param type The type of bisimulation used for the minimization.
+             * @return The minimized composition.
+             */
+            static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> composeMinimized(std::vector<std::shared_ptr<storm::models::sparse::Ctmc<ValueType>>> const& ctmcs, bool labelAnd, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong);
+
+        private:
+            /*!
+             * Computes the bisimulation quotient of the given Markov chain preserving the given formulas.
+             */
+            static std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> minimize(std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type);
+
         };
 
     }
@@ -101,6 +101,11 @@ namespace storm {
                     carlIncludeDirectory = STORM_CARL_INCLUDE_DIR;
                 }
                 sparseppIncludeDirectory = STORM_BUILD_DIR "/include/resources/3rdparty/sparsepp/";
+                usePrecompiledHeader = settings.isPrecompiledHeaderSet();
+                useModelCache = settings.isModelCacheSet();
+                if (settings.isCacheDirectorySet()) {
+                    jitCache = JitCache(settings.getCacheDirectory());
+                }
                 
                 // Register all transient variables as transient.
                 for (auto const& variable : this->model.getGlobalVariables().getTransientVariables()) {
@@ -477,15 +482,45 @@ namespace storm {
                 }
                 STORM_LOG_TRACE("Successfully created source code for model generation: " << source);
                 
-                // (2) Write the source code to a temporary file.
-                boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
-                
-                // (3) Compile the source code to a shared library.
-                boost::filesystem::path dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile);
-                STORM_LOG_TRACE("Successfully compiled shared library.");
+                // The source code fully determines the shared library, as the model, its constants and the options
+                // are compiled into it. Hence, a library compiled from the same source can be reused if it was cached.
+                // Note that this means that runs differing only in the values of constants do not share a library.
+                boost::optional<std::string> cachedLibraryFilename;
+                boost::optional<boost::filesystem::path> cachedLibraryPath;
+                if (useModelCache && jitCache.prepare()) {
+                    cachedLibraryFilename = "model-" + getCacheKey(source) + DYLIB_EXTENSION;
+                    cachedLibraryPath = jitCache.findLibrary(cachedLibraryFilename.get(), source);
+                }
                 
-                // (4) Remove the source code of the shared library we just compiled.
-                boost::filesystem::remove(temporarySourceFile);
+                boost::filesystem::path dynamicLibraryPath;
+                if (cachedLibraryPath) {
+                    STORM_LOG_TRACE("Reusing cached shared library '" << cachedLibraryPath.get().string() << "'.");
+                    dynamicLibraryPath = cachedLibraryPath.get();
+                } else {
+                    // (2) Write the source code to a temporary file.
+                    boost::filesystem::path temporarySourceFile = writeToTemporaryFile(source);
+                    
+                    // (3) Compile the source code to a shared library. If requested, the headers it includes are
+                    // precompiled (or the result of an earlier run is reused), as parsing them dominates the compile time.
+                    boost::optional<boost::filesystem::path> precompiledHeader;
+                    if (usePrecompiledHeader) {
+                        precompiledHeader = precompileHeader(createHeaderFromSkeleton(modelData));
+                    }
+                    dynamicLibraryPath = compileToSharedLibrary(temporarySourceFile, precompiledHeader);
+                    STORM_LOG_TRACE("Successfully compiled shared library.");
+                    
+                    // (4) Remove the source code of the shared library we just compiled.
+                    boost::filesystem::remove(temporarySourceFile);
+                    
+                    // Move the shared library to the cache. If this fails (e.g. because the cache directory is on a
+                    // different file system), the library is used from its temporary location.
+                    if (cachedLibraryFilename) {
+                        cachedLibraryPath = jitCache.storeLibrary(cachedLibraryFilename.get(), source, dynamicLibraryPath);
+                        if (cachedLibraryPath) {
+                            dynamicLibraryPath = cachedLibraryPath.get();
+                        }
+                    }
+                }
                 
                 // (5) Create the builder from the shared library.
                 createBuilder(dynamicLibraryPath);
@@ -506,8 +541,10 @@ namespace storm {
                 auto end = std::chrono::high_resolution_clock::now();
                 STORM_LOG_TRACE("Building model took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
                 
-                // (7) Delete the shared library.
-                boost::filesystem::remove(dynamicLibraryPath);
+                // (7) Delete the shared library unless it is kept in the cache.
+                if (!cachedLibraryPath) {
+                    boost::filesystem::remove(dynamicLibraryPath);
+                }
                 
                 STORM_LOG_THROW(!error, storm::exceptions::WrongFormatException, "Model building failed. Reason: " << error.get());
                 
@@ -1654,14 +1691,10 @@ namespace storm {
             }
                 
             template <typename ValueType, typename RewardModelType>
-            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::createSourceCodeFromSkeleton(cpptempl::data_map& modelData) {
-                std::string sourceTemplate = R"(
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::createHeaderFromSkeleton(cpptempl::data_map& modelData) {
+                std::string headerTemplate = R"(
 #define NDEBUG
                 
-{% if expl_progress %}
-#define EXPL_PROGRESS
-{% endif %}
-                
 #include <cstdint>
 #include <iostream>
 #include <vector>
@@ -1688,6 +1721,17 @@ namespace storm {
                 
 #include "storm/utility/constants.h"
 #include "storm/exceptions/WrongFormatException.h"
+                )";
+                
+                return cpptempl::parse(headerTemplate, modelData);
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::createSourceCodeFromSkeleton(cpptempl::data_map& modelData) {
+                std::string sourceTemplate = R"(
+{% if expl_progress %}
+#define EXPL_PROGRESS
+{% endif %}
                 
                 namespace storm {
                     namespace builder {
@@ -2455,17 +2499,94 @@ namespace storm {
                 }
                 )";
                 
-                return cpptempl::parse(sourceTemplate, modelData);
+                return createHeaderFromSkeleton(modelData) + cpptempl::parse(sourceTemplate, modelData);
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getIncludeFlags() const {
+                return " -I" + stormIncludeDirectory + " -I" + sparseppIncludeDirectory + " -I" + boostIncludeDirectory + " -I" + carlIncludeDirectory;
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            std::string ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::getCacheKey(std::string const& content) const {
+                return JitCache::getKey(content, compiler + " " + compilerFlags + getIncludeFlags());
+            }
+            
+            template <typename ValueType, typename RewardModelType>
+            boost::optional<boost::filesystem::path> ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::precompileHeader(std::string const& header) {
+                if (!jitCache.prepare()) {
+                    return boost::none;
+                }
+                
+                // A precompiled header may only be used by compiler invocations that match the one it was created
+                // with, which is reflected by the key. Compilers do not check whether the headers included by a
+                // precompiled header have changed since, so this is done via the dependencies recorded when
+                // precompiling it.
+                boost::system::error_code errorCode;
+                boost::filesystem::path const& directory = jitCache.getDirectory();
+                boost::filesystem::path headerFile = directory / ("header-" + getCacheKey(header) + ".h");
+                boost::filesystem::path precompiledHeaderFile = headerFile;
+                precompiledHeaderFile += ".gch";
+                boost::filesystem::path dependencyFile = headerFile;
+                dependencyFile += ".d";
+                if (boost::filesystem::exists(headerFile) && JitCache::isUpToDate(precompiledHeaderFile, dependencyFile)) {
+                    STORM_LOG_TRACE("Reusing precompiled header '" << precompiledHeaderFile.string() << "'.");
+                    return headerFile;
+                }
+                
+                // Other processes may precompile the same header concurrently, so the files are created under unique
+                // names first and only then moved to their final location.
+                boost::filesystem::path temporaryHeaderFile = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.h");
+                boost::filesystem::path temporaryPrecompiledHeaderFile = temporaryHeaderFile;
+                temporaryPrecompiledHeaderFile += ".gch";
+                boost::filesystem::path temporaryDependencyFile = temporaryHeaderFile;
+                temporaryDependencyFile += ".d";
+                {
+                    std::ofstream out(temporaryHeaderFile.native());
+                    out << header << std::endl;
+                }
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                boost::optional<std::string> error = execute(compiler + " -x c++-header " + temporaryHeaderFile.string() + " " + compilerFlags + getIncludeFlags() + " -MD -MF " + temporaryDependencyFile.string() + " -o " + temporaryPrecompiledHeaderFile.string());
+                if (error) {
+                    boost::filesystem::remove(temporaryHeaderFile, errorCode);
+                    boost::filesystem::remove(temporaryPrecompiledHeaderFile, errorCode);
+                    boost::filesystem::remove(temporaryDependencyFile, errorCode);
+                    STORM_LOG_WARN("Precompiling the header failed, compiling without it. Error: " << error.get());
+                    return boost::none;
+                }
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Precompiling the header took " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms.");
+                
+                boost::filesystem::rename(temporaryHeaderFile, headerFile, errorCode);
+                if (!errorCode) {
+                    boost::filesystem::rename(temporaryDependencyFile, dependencyFile, errorCode);
+                }
+                if (!errorCode) {
+                    boost::filesystem::rename(temporaryPrecompiledHeaderFile, precompiledHeaderFile, errorCode);
+                }
+                if (errorCode) {
+                    boost::filesystem::remove(temporaryHeaderFile, errorCode);
+                    boost::filesystem::remove(temporaryPrecompiledHeaderFile, errorCode);
+                    boost::filesystem::remove(temporaryDependencyFile, errorCode);
+                    STORM_LOG_WARN("Unable to store the precompiled header in '" << directory.string() << "', compiling without it.");
+                    return boost::none;
+                }
+                return headerFile;
             }
             
             template <typename ValueType, typename RewardModelType>
-            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::compileToSharedLibrary(boost::filesystem::path const& sourceFile) {
+            boost::filesystem::path ExplicitJitJaniModelBuilder<ValueType, RewardModelType>::compileToSharedLibrary(boost::filesystem::path const& sourceFile, boost::optional<boost::filesystem::path> const& precompiledHeader) {
                 std::string sourceFilename = boost::filesystem::absolute(sourceFile).string();
                 auto dynamicLibraryPath = sourceFile;
                 dynamicLibraryPath += DYLIB_EXTENSION;
                 std::string dynamicLibraryFilename = boost::filesystem::absolute(dynamicLibraryPath).string();
                 
-                std::string command = compiler + " " + sourceFilename + " " + compilerFlags + " -I" + stormIncludeDirectory + " -I" + sparseppIncludeDirectory + " -I" + boostIncludeDirectory + " -I" + carlIncludeDirectory + " -o " + dynamicLibraryFilename;
+                std::string command = compiler + " " + sourceFilename + " " + compilerFlags + getIncludeFlags() + " -o " + dynamicLibraryFilename;
+                if (precompiledHeader) {
+                    // Both gcc and clang pick up the precompiled version of a header that is included via the command line.
+                    command += " -include " + precompiledHeader.get().string();
+                }
                 boost::optional<std::string> error = execute(command);
                 
                 if (error) {
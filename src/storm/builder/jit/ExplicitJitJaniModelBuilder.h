@@ -15,6 +15,7 @@
 #include "storm/storage/expressions/ToCppVisitor.h"
 
 #include "storm/builder/BuilderOptions.h"
+#include "storm/builder/jit/JitCache.h"
 #include "storm/builder/jit/JitModelBuilderInterface.h"
 #include "storm/builder/jit/ModelComponentsBuilder.h"
 
@@ -127,6 +128,12 @@ namespace storm {
                 std::string asString(ValueTypePrime value) const;
                 std::string asString(bool value) const;
 
+                /*!
+                 * Creates the part of the source code of the shared library that includes the required headers. As it
+                 * only depends on the value type, it is suited to be precompiled.
+                 */
+                std::string createHeaderFromSkeleton(cpptempl::data_map& modelData);
+                
                 /*!
                  * Creates the source code for the shared library that performs the model generation.
                  *
@@ -135,11 +142,28 @@ namespace storm {
                  */
                 std::string createSourceCodeFromSkeleton(cpptempl::data_map& modelData);
                 
+                /*!
+                 * Retrieves the flags that make the compiler find the headers of storm and its dependencies.
+                 */
+                std::string getIncludeFlags() const;
+                
+                /*!
+                 * Computes a key that identifies the given content in the cache directory for the current compiler
+                 * invocation.
+                 */
+                std::string getCacheKey(std::string const& content) const;
+                
+                /*!
+                 * Precompiles the given header unless a precompiled version for the current compiler and flags already
+                 * exists in the cache directory. Returns the path of the header or boost::none if precompiling failed.
+                 */
+                boost::optional<boost::filesystem::path> precompileHeader(std::string const& header);
+                
                 /*!
                  * Compiles the provided source file to a shared library and returns a path object to the resulting
-                 * binary file.
+                 * binary file. If a precompiled header is given, it is included before the source file.
                  */
-                boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile);
+                boost::filesystem::path compileToSharedLibrary(boost::filesystem::path const& sourceFile, boost::optional<boost::filesystem::path> const& precompiledHeader = boost::none);
 
                 /*!
                  * Loads the given shared library and creates the builder from it.
@@ -195,6 +219,15 @@ namespace storm {
                 /// The include directory of sparsepp.
                 std::string sparseppIncludeDirectory;
                 
+                /// A flag indicating whether the headers included by the generated code are to be precompiled.
+                bool usePrecompiledHeader;
+                
+                /// A flag indicating whether compiled models are stored in and retrieved from the cache directory.
+                bool useModelCache;
+                
+                /// The directory in which files are kept across invocations of the builder.
+                JitCache jitCache;
+                
                 /// A cache that is used by carl.
                 std::shared_ptr<carl::Cache<carl::PolynomialFactorizationPair<RawPolynomial>>> cache;
             };
@@ -0,0 +1,222 @@
+#include "storm/builder/jit/JitCache.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <vector>
+
+#include <boost/dll/runtime_symbol_info.hpp>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/sha256.h"
+#include "storm/utility/storm-version.h"
+
+#ifndef WINDOWS
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace storm {
+    namespace builder {
+        namespace jit {
+
+            JitCache::JitCache() : directory(getDefaultDirectory()) {
+                // Intentionally left empty.
+            }
+
+            JitCache::JitCache(boost::filesystem::path const& directory) : directory(directory) {
+                // Intentionally left empty.
+            }
+
+            boost::filesystem::path const& JitCache::getDirectory() const {
+                return directory;
+            }
+
+            bool JitCache::prepare() const {
+                boost::system::error_code errorCode;
+                boost::filesystem::create_directories(directory, errorCode);
+                if (errorCode) {
+                    STORM_LOG_WARN("Unable to create cache directory '" << directory.string() << "' (error: " << errorCode.message() << ").");
+                    return false;
+                }
+
+#ifndef WINDOWS
+                // Other users must neither be able to place files in the directory nor to replace the directory itself.
+                struct stat status;
+                if (stat(directory.c_str(), &status) != 0 || !S_ISDIR(status.st_mode)) {
+                    STORM_LOG_WARN("Unable to access cache directory '" << directory.string() << "'.");
+                    return false;
+                }
+                if (status.st_uid != geteuid()) {
+                    STORM_LOG_WARN("Not using cache directory '" << directory.string() << "', because it is owned by another user.");
+                    return false;
+                }
+                if ((status.st_mode & (S_IRWXG | S_IRWXO)) != 0) {
+                    boost::filesystem::permissions(directory, boost::filesystem::owner_all, errorCode);
+                    if (errorCode) {
+                        STORM_LOG_WARN("Unable to restrict the permissions of cache directory '" << directory.string() << "' (error: " << errorCode.message() << ").");
+                        return false;
+                    }
+                }
+#endif
+                return true;
+            }
+
+            std::string JitCache::getKey(std::string const& content, std::string const& invocation) {
+                return storm::utility::sha256(getBuildIdentifier() + "\n" + invocation + "\n" + content);
+            }
+
+            boost::optional<boost::filesystem::path> JitCache::findLibrary(std::string const& filename, std::string const& source) const {
+                boost::filesystem::path library = directory / filename;
+                if (!boost::filesystem::exists(library)) {
+                    return boost::none;
+                }
+
+                std::ifstream in(getSourcePath(library).native(), std::ios::binary);
+                if (!in) {
+                    return boost::none;
+                }
+                std::string storedSource((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+                if (storedSource != source) {
+                    STORM_LOG_WARN("Not using cached library '" << library.string() << "', because it was compiled from a different source.");
+                    return boost::none;
+                }
+                return library;
+            }
+
+            boost::optional<boost::filesystem::path> JitCache::storeLibrary(std::string const& filename, std::string const& source, boost::filesystem::path const& library) const {
+                boost::filesystem::path cachedLibrary = directory / filename;
+
+                // Other processes may store the same library concurrently, so the source is written under a unique
+                // name first. It is moved to its final location before the library, so that the library is never
+                // found together with an incomplete source.
+                boost::system::error_code errorCode;
+                boost::filesystem::path temporarySource = directory / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.cpp");
+                {
+                    std::ofstream out(temporarySource.native(), std::ios::binary);
+                    out << source;
+                    if (!out) {
+                        errorCode = boost::system::errc::make_error_code(boost::system::errc::io_error);
+                    }
+                }
+                if (!errorCode) {
+                    boost::filesystem::rename(temporarySource, getSourcePath(cachedLibrary), errorCode);
+                }
+                if (!errorCode) {
+                    boost::filesystem::rename(library, cachedLibrary, errorCode);
+                }
+                if (errorCode) {
+                    boost::system::error_code ignoredErrorCode;
+                    boost::filesystem::remove(temporarySource, ignoredErrorCode);
+                    STORM_LOG_WARN("Unable to store the shared library in the cache (error: " << errorCode.message() << ").");
+                    return boost::none;
+                }
+                return cachedLibrary;
+            }
+
+            boost::filesystem::path JitCache::getSourcePath(boost::filesystem::path const& library) {
+                boost::filesystem::path source = library;
+                source += ".cpp";
+                return source;
+            }
+
+            bool JitCache::isUpToDate(boost::filesystem::path const& file, boost::filesystem::path const& dependencyFile) {
+                boost::system::error_code errorCode;
+                std::time_t fileTime = boost::filesystem::last_write_time(file, errorCode);
+                if (errorCode) {
+                    return false;
+                }
+
+                std::ifstream in(dependencyFile.native());
+                if (!in) {
+                    return false;
+                }
+                std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+                // The dependency file is a make rule, so the dependencies follow the target and are separated by
+                // whitespace. Line breaks are escaped and so are spaces within the file names.
+                std::size_t position = content.find(": ");
+                if (position == std::string::npos) {
+                    return false;
+                }
+                std::vector<std::string> dependencies;
+                std::string dependency;
+                for (position += 2; position <= content.size(); ++position) {
+                    char character = position < content.size() ? content[position] : ' ';
+                    if (character == '\\' && position + 1 < content.size()) {
+                        char nextCharacter = content[position + 1];
+                        if (nextCharacter == ' ') {
+                            dependency += ' ';
+                            ++position;
+                            continue;
+                        } else if (nextCharacter == '\n') {
+                            character = ' ';
+                            ++position;
+                        }
+                    }
+                    if (std::isspace(static_cast<unsigned char>(character))) {
+                        if (!dependency.empty()) {
+                            dependencies.push_back(std::move(dependency));
+                            dependency.clear();
+                        }
+                    } else {
+                        dependency += character;
+                    }
+                }
+                if (dependencies.empty()) {
+                    return false;
+                }
+
+                for (auto dependencyIt = dependencies.begin() + 1; dependencyIt != dependencies.end(); ++dependencyIt) {
+                    std::time_t dependencyTime = boost::filesystem::last_write_time(*dependencyIt, errorCode);
+                    if (errorCode || dependencyTime > fileTime) {
+                        STORM_LOG_TRACE("Cached file '" << file.string() << "' is outdated, because of '" << *dependencyIt << "'.");
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            boost::filesystem::path JitCache::getDefaultDirectory() {
+                char const* cacheHome = std::getenv("XDG_CACHE_HOME");
+                if (cacheHome != nullptr && *cacheHome != '\0') {
+                    return boost::filesystem::path(cacheHome) / "storm" / "jit";
+                }
+                char const* home = std::getenv("HOME");
+                if (home != nullptr && *home != '\0') {
+                    return boost::filesystem::path(home) / ".cache" / "storm" / "jit";
+                }
+
+                // The temporary directory is shared by all users, so the directory is made specific to the user. As
+                // prepare() checks its owner, other users cannot take it over by creating it first.
+                boost::system::error_code errorCode;
+                boost::filesystem::path temporaryDirectory = boost::filesystem::temp_directory_path(errorCode);
+#ifndef WINDOWS
+                return temporaryDirectory / ("storm-jit-" + std::to_string(geteuid()));
+#else
+                return temporaryDirectory / "storm-jit";
+#endif
+            }
+
+            std::string const& JitCache::getBuildIdentifier() {
+                static const std::string buildIdentifier = [] () {
+                    std::stringstream identifierStream;
+                    identifierStream << storm::utility::StormVersion::longVersionString();
+                    try {
+                        boost::filesystem::path binary = boost::dll::this_line_location();
+                        identifierStream << " " << binary.string() << " " << boost::filesystem::file_size(binary) << " " << boost::filesystem::last_write_time(binary);
+                    } catch (std::exception const& e) {
+                        STORM_LOG_WARN("Unable to locate the binary of storm, cached files may be reused after rebuilding storm (error: " << e.what() << ").");
+                    }
+                    return identifierStream.str();
+                }();
+                return buildIdentifier;
+            }
+
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <string>
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+
+namespace storm {
+    namespace builder {
+        namespace jit {
+
+            /*!
+             * A directory in which the jit-based model builder keeps files (such as precompiled headers) across
+             * invocations. As these files are loaded into the process, the directory must only be accessible by the
+             * current user.
+             */
+            class JitCache {
+            public:
+                /*!
+                 * Creates a cache in the default directory of the current user.
+                 */
+                JitCache();
+
+                /*!
+                 * Creates a cache in the given directory.
+                 */
+                JitCache(boost::filesystem::path const& directory);
+
+                /*!
+                 * Retrieves the directory of the cache.
+                 */
+                boost::filesystem::path const& getDirectory() const;
+
+                /*!
+                 * Creates the directory if necessary and restricts its permissions to the current user. Returns false
+                 * (and issues a warning) if the directory cannot be used, e.g. because it is owned by another user.
+                 */
+                bool prepare() const;
+
+                /*!
+                 * Computes a key that identifies the given content in the cache. Besides the content, the key covers
+                 * the compiler invocation and the build of storm, because the files in the cache are only valid for
+                 * these. The key is a SHA-256 digest.
+                 *
+                 * @param content The content from which the cached file is created.
+                 * @param invocation The compiler, its flags and the include directories.
+                 */
+                static std::string getKey(std::string const& content, std::string const& invocation);
+
+                /*!
+                 * Retrieves the cached shared library that was compiled from the given source. The source is stored
+                 * next to the library and compared with the given one, so a library is never used for a different
+                 * source, even if their keys collide.
+                 *
+                 * @param filename The name of the library within the cache directory.
+                 * @param source The source code from which the library was compiled.
+                 * @return The path of the library, if it is in the cache.
+                 */
+                boost::optional<boost::filesystem::path> findLibrary(std::string const& filename, std::string const& source) const;
+
+                /*!
+                 * Moves the given shared library into the cache and stores its source next to it.
+                 *
+                 * @param filename The name of the library within the cache directory.
+                 * @param source The source code from which the library was compiled.
+                 * @param library The library to move.
+                 * @return The new path of the library, or boost::none if it could not be stored.
+                 */
+                boost::optional<boost::filesystem::path> storeLibrary(std::string const& filename, std::string const& source, boost::filesystem::path const& library) const;
+
+                /*!
+                 * Checks whether the given file is newer than all files it was created from. These are read from the
+                 * given dependency file, as written by the -MD and -MF flags of the compiler. The first of them is the
+                 * compiled file itself, which is skipped, because it may have been moved since. Returns false if any of
+                 * the files does not exist.
+                 */
+                static bool isUpToDate(boost::filesystem::path const& file, boost::filesystem::path const& dependencyFile);
+
+                /*!
+                 * Retrieves the default directory of the current user. This is a subdirectory of $XDG_CACHE_HOME or
+                 * $HOME/.cache if they are set and a user-specific subdirectory of the temporary directory otherwise.
+                 */
+                static boost::filesystem::path getDefaultDirectory();
+
+                /*!
+                 * Retrieves a string that identifies the current build of storm. Besides the version, it covers the
+                 * location, size and modification time of the binary containing storm, so that it changes whenever
+                 * storm (and thereby its headers) is rebuilt.
+                 */
+                static std::string const& getBuildIdentifier();
+
+            private:
+                /*!
+                 * Retrieves the path under which the source of the given library is stored.
+                 */
+                static boost::filesystem::path getSourcePath(boost::filesystem::path const& library);
+
+                /// The directory in which the files are stored.
+                boost::filesystem::path directory;
+            };
+
+        }
+    }
+}
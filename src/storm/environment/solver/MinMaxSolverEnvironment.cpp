@@ -19,6 +19,9 @@ namespace storm {
         multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
         forceBounds = minMaxSettings.isForceBoundsSet();
         symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+        if (minMaxSettings.isSymbolicRoundingSet()) {
+            symbolicRoundingGranularity = storm::utility::convertNumber<storm::RationalNumber>(minMaxSettings.getSymbolicRoundingGranularity());
+        }
     }
 
     MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -86,4 +89,17 @@ namespace storm {
         symmetricUpdates = value;
     }
     
+    bool MinMaxSolverEnvironment::isSymbolicRoundingSet() const {
+        return static_cast<bool>(symbolicRoundingGranularity);
+    }
+    
+    storm::RationalNumber const& MinMaxSolverEnvironment::getSymbolicRoundingGranularity() const {
+        STORM_LOG_ASSERT(symbolicRoundingGranularity, "Symbolic rounding is not enabled.");
+        return symbolicRoundingGranularity.get();
+    }
+    
+    void MinMaxSolverEnvironment::setSymbolicRoundingGranularity(boost::optional<storm::RationalNumber> const& value) {
+        symbolicRoundingGranularity = value;
+    }
+    
 }
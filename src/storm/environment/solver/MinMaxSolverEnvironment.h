@@ -29,6 +29,9 @@ namespace storm {
         void setForceBounds(bool value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        bool isSymbolicRoundingSet() const;
+        storm::RationalNumber const& getSymbolicRoundingGranularity() const;
+        void setSymbolicRoundingGranularity(boost::optional<storm::RationalNumber> const& value);
         
     private:
         storm::solver::MinMaxMethod minMaxMethod;
@@ -39,6 +42,7 @@ namespace storm {
         storm::solver::MultiplicationStyle multiplicationStyle;
         bool forceBounds;
         bool symmetricUpdates;
+        boost::optional<storm::RationalNumber> symbolicRoundingGranularity;
     };
 }
 
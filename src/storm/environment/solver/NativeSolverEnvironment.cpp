@@ -20,6 +20,10 @@ namespace storm {
         sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
         forceBounds = nativeSettings.isForceBoundsSet();
         symmetricUpdates = nativeSettings.isForcePowerMethodSymmetricUpdatesSet();
+        stateOrdering = nativeSettings.getStateOrdering();
+        if (nativeSettings.isSymbolicRoundingSet()) {
+            symbolicRoundingGranularity = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getSymbolicRoundingGranularity());
+        }
 
     }
 
@@ -95,5 +99,26 @@ namespace storm {
     void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
         symmetricUpdates = value;
     }
+    
+    storm::utility::permutation::OrderKind const& NativeSolverEnvironment::getStateOrdering() const {
+        return stateOrdering;
+    }
+    
+    void NativeSolverEnvironment::setStateOrdering(storm::utility::permutation::OrderKind value) {
+        stateOrdering = value;
+    }
+    
+    bool NativeSolverEnvironment::isSymbolicRoundingSet() const {
+        return static_cast<bool>(symbolicRoundingGranularity);
+    }
+    
+    storm::RationalNumber const& NativeSolverEnvironment::getSymbolicRoundingGranularity() const {
+        STORM_LOG_ASSERT(symbolicRoundingGranularity, "Symbolic rounding is not enabled.");
+        return symbolicRoundingGranularity.get();
+    }
+    
+    void NativeSolverEnvironment::setSymbolicRoundingGranularity(boost::optional<storm::RationalNumber> const& value) {
+        symbolicRoundingGranularity = value;
+    }
   
 }
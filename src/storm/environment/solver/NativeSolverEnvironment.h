@@ -5,6 +5,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
     
@@ -31,6 +32,11 @@ namespace storm {
         void setForceBounds(bool value);
         bool isSymmetricUpdatesSet() const;
         void setSymmetricUpdates(bool value);
+        storm::utility::permutation::OrderKind const& getStateOrdering() const;
+        void setStateOrdering(storm::utility::permutation::OrderKind value);
+        bool isSymbolicRoundingSet() const;
+        storm::RationalNumber const& getSymbolicRoundingGranularity() const;
+        void setSymbolicRoundingGranularity(boost::optional<storm::RationalNumber> const& value);
         
     private:
         storm::solver::NativeLinearEquationSolverMethod method;
@@ -42,6 +48,8 @@ namespace storm {
         storm::RationalNumber sorOmega;
         bool forceBounds;
         bool symmetricUpdates;
+        storm::utility::permutation::OrderKind stateOrdering;
+        boost::optional<storm::RationalNumber> symbolicRoundingGranularity;
     };
 }
 
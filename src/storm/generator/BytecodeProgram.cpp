@@ -0,0 +1,356 @@
+#include "storm/generator/BytecodeProgram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/storage/expressions/Expressions.h"
+#include "storm/storage/expressions/ExpressionVisitor.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidTypeException.h"
+
+namespace storm {
+    namespace generator {
+
+        /*!
+         * Translates expressions into instructions of a bytecode program.
+         */
+        class BytecodeCompiler : public storm::expressions::ExpressionVisitor {
+        public:
+            typedef BytecodeProgram::Register Register;
+            typedef BytecodeProgram::RegisterType RegisterType;
+            typedef BytecodeProgram::Opcode Opcode;
+
+            BytecodeCompiler(BytecodeProgram& program) : program(program) {
+                // Intentionally left empty.
+            }
+
+            Register compile(storm::expressions::BaseExpression const& expression) {
+                auto registerIt = program.subexpressionRegisters.find(&expression);
+                if (registerIt != program.subexpressionRegisters.end()) {
+                    return registerIt->second;
+                }
+                Register result = boost::any_cast<Register>(expression.accept(*this, boost::none));
+                program.subexpressionRegisters.emplace(&expression, result);
+                return result;
+            }
+
+            virtual boost::any visit(storm::expressions::IfThenElseExpression const& expression, boost::any const&) override {
+                Register condition = compile(*expression.getCondition());
+                Register thenValue = compile(*expression.getThenExpression());
+                Register elseValue = compile(*expression.getElseExpression());
+
+                if (thenValue.type == RegisterType::Boolean) {
+                    return emit(Opcode::BooleanIte, RegisterType::Boolean, condition, thenValue, elseValue);
+                } else if (thenValue.type == RegisterType::Integer && elseValue.type == RegisterType::Integer) {
+                    return emit(Opcode::IntegerIte, RegisterType::Integer, condition, thenValue, elseValue);
+                } else {
+                    return emit(Opcode::RationalIte, RegisterType::Rational, condition, program.toRational(thenValue), program.toRational(elseValue));
+                }
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                Register first = compile(*expression.getFirstOperand());
+                Register second = compile(*expression.getSecondOperand());
+
+                Opcode opcode = Opcode::And;
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And: opcode = Opcode::And; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Or: opcode = Opcode::Or; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Xor: opcode = Opcode::Xor; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Implies: opcode = Opcode::Implies; break;
+                    case storm::expressions::BinaryBooleanFunctionExpression::OperatorType::Iff: opcode = Opcode::Iff; break;
+                }
+                return emit(opcode, RegisterType::Boolean, first, second);
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                Register first = compile(*expression.getFirstOperand());
+                Register second = compile(*expression.getSecondOperand());
+                bool integerOperands = first.type == RegisterType::Integer && second.type == RegisterType::Integer;
+
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Plus: return emitNumerical(integerOperands, Opcode::IntegerPlus, Opcode::RationalPlus, first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Minus: return emitNumerical(integerOperands, Opcode::IntegerMinus, Opcode::RationalMinus, first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Times: return emitNumerical(integerOperands, Opcode::IntegerTimes, Opcode::RationalTimes, first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Min: return emitNumerical(integerOperands, Opcode::IntegerMin, Opcode::RationalMin, first, second);
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Max: return emitNumerical(integerOperands, Opcode::IntegerMax, Opcode::RationalMax, first, second);
+                    // Divisions and powers are always carried out on rationals.
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Divide: return emit(Opcode::RationalDivide, RegisterType::Rational, program.toRational(first), program.toRational(second));
+                    case storm::expressions::BinaryNumericalFunctionExpression::OperatorType::Power: return emit(Opcode::RationalPower, RegisterType::Rational, program.toRational(first), program.toRational(second));
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown operator in expression " << expression << ".");
+            }
+
+            virtual boost::any visit(storm::expressions::BinaryRelationExpression const& expression, boost::any const&) override {
+                Register first = compile(*expression.getFirstOperand());
+                Register second = compile(*expression.getSecondOperand());
+                STORM_LOG_THROW(first.type != RegisterType::Boolean && second.type != RegisterType::Boolean, storm::exceptions::InvalidTypeException, "Relation " << expression << " requires numerical operands.");
+                bool integerOperands = first.type == RegisterType::Integer && second.type == RegisterType::Integer;
+
+                Opcode integerOpcode = Opcode::IntegerEqual;
+                Opcode rationalOpcode = Opcode::RationalEqual;
+                switch (expression.getRelationType()) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal: integerOpcode = Opcode::IntegerEqual; rationalOpcode = Opcode::RationalEqual; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: integerOpcode = Opcode::IntegerNotEqual; rationalOpcode = Opcode::RationalNotEqual; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: integerOpcode = Opcode::IntegerLess; rationalOpcode = Opcode::RationalLess; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: integerOpcode = Opcode::IntegerLessOrEqual; rationalOpcode = Opcode::RationalLessOrEqual; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: integerOpcode = Opcode::IntegerGreater; rationalOpcode = Opcode::RationalGreater; break;
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: integerOpcode = Opcode::IntegerGreaterOrEqual; rationalOpcode = Opcode::RationalGreaterOrEqual; break;
+                }
+
+                if (integerOperands) {
+                    return emit(integerOpcode, RegisterType::Boolean, first, second);
+                } else {
+                    return emit(rationalOpcode, RegisterType::Boolean, program.toRational(first), program.toRational(second));
+                }
+            }
+
+            virtual boost::any visit(storm::expressions::VariableExpression const& expression, boost::any const&) override {
+                return program.getVariableRegister(expression.getVariable());
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryBooleanFunctionExpression const& expression, boost::any const&) override {
+                Register operand = compile(*expression.getOperand());
+                return emit(Opcode::Not, RegisterType::Boolean, operand);
+            }
+
+            virtual boost::any visit(storm::expressions::UnaryNumericalFunctionExpression const& expression, boost::any const&) override {
+                Register operand = compile(*expression.getOperand());
+                bool integerOperand = operand.type == RegisterType::Integer;
+
+                switch (expression.getOperatorType()) {
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Minus:
+                        return integerOperand ? emit(Opcode::IntegerNegate, RegisterType::Integer, operand) : emit(Opcode::RationalNegate, RegisterType::Rational, operand);
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Floor:
+                        return integerOperand ? operand : emit(Opcode::RationalFloor, RegisterType::Integer, operand);
+                    case storm::expressions::UnaryNumericalFunctionExpression::OperatorType::Ceil:
+                        return integerOperand ? operand : emit(Opcode::RationalCeil, RegisterType::Integer, operand);
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown operator in expression " << expression << ".");
+            }
+
+            virtual boost::any visit(storm::expressions::BooleanLiteralExpression const& expression, boost::any const&) override {
+                Register result = program.createRegister(RegisterType::Boolean);
+                program.booleanRegisters[result.index] = expression.getValue() ? 1 : 0;
+                return result;
+            }
+
+            virtual boost::any visit(storm::expressions::IntegerLiteralExpression const& expression, boost::any const&) override {
+                Register result = program.createRegister(RegisterType::Integer);
+                program.integerRegisters[result.index] = expression.getValue();
+                return result;
+            }
+
+            virtual boost::any visit(storm::expressions::RationalLiteralExpression const& expression, boost::any const&) override {
+                Register result = program.createRegister(RegisterType::Rational);
+                program.rationalRegisters[result.index] = expression.getValueAsDouble();
+                return result;
+            }
+
+        private:
+            Register emit(Opcode opcode, RegisterType resultType, Register const& first, Register const& second = Register(), Register const& third = Register()) {
+                Register result = program.createRegister(resultType);
+                program.instructions.emplace_back(opcode, result.index, first.index, second.index, third.index);
+                return result;
+            }
+
+            Register emitNumerical(bool integerOperands, Opcode integerOpcode, Opcode rationalOpcode, Register const& first, Register const& second) {
+                if (integerOperands) {
+                    return emit(integerOpcode, RegisterType::Integer, first, second);
+                } else {
+                    return emit(rationalOpcode, RegisterType::Rational, program.toRational(first), program.toRational(second));
+                }
+            }
+
+            // The program to which the instructions are added.
+            BytecodeProgram& program;
+        };
+
+        BytecodeProgram::Register::Register() : type(RegisterType::Boolean), index(0) {
+            // Intentionally left empty.
+        }
+
+        BytecodeProgram::Register::Register(RegisterType type, uint_fast64_t index) : type(type), index(index) {
+            // Intentionally left empty.
+        }
+
+        BytecodeProgram::Instruction::Instruction(Opcode opcode, uint_fast64_t target, uint_fast64_t first, uint_fast64_t second, uint_fast64_t third) : opcode(opcode), target(target), first(first), second(second), third(third) {
+            // Intentionally left empty.
+        }
+
+        BytecodeProgram::BytecodeProgram(VariableInformation const& variableInformation) {
+            for (auto const& locationVariable : variableInformation.locationVariables) {
+                variableLocations[locationVariable.variable] = {RegisterType::Integer, locationVariable.bitOffset, locationVariable.bitWidth, 0};
+            }
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableLocations[booleanVariable.variable] = {RegisterType::Boolean, booleanVariable.bitOffset, 1, 0};
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableLocations[integerVariable.variable] = {RegisterType::Integer, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound};
+            }
+        }
+
+        bool BytecodeProgram::canCompile(storm::expressions::Expression const& expression) const {
+            for (auto const& variable : expression.getVariables()) {
+                if (variableLocations.find(variable) == variableLocations.end()) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        uint64_t BytecodeProgram::addExpression(storm::expressions::Expression const& expression) {
+            STORM_LOG_THROW(canCompile(expression), storm::exceptions::InvalidArgumentException, "Cannot compile expression " << expression << ", because it refers to variables that are not part of the state.");
+            BytecodeCompiler compiler(*this);
+            outputs.push_back(compiler.compile(expression.getBaseExpression()));
+            expressions.push_back(expression);
+            return outputs.size() - 1;
+        }
+
+        uint64_t BytecodeProgram::getNumberOfExpressions() const {
+            return outputs.size();
+        }
+
+        uint64_t BytecodeProgram::getNumberOfInstructions() const {
+            return instructions.size();
+        }
+
+        BytecodeProgram::Register BytecodeProgram::createRegister(RegisterType type) {
+            switch (type) {
+                case RegisterType::Boolean:
+                    booleanRegisters.push_back(0);
+                    return Register(type, booleanRegisters.size() - 1);
+                case RegisterType::Integer:
+                    integerRegisters.push_back(0);
+                    return Register(type, integerRegisters.size() - 1);
+                case RegisterType::Rational:
+                    rationalRegisters.push_back(0.0);
+                    return Register(type, rationalRegisters.size() - 1);
+            }
+            STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unknown register type.");
+        }
+
+        BytecodeProgram::Register BytecodeProgram::getVariableRegister(storm::expressions::Variable const& variable) {
+            auto registerIt = variableRegisters.find(variable);
+            if (registerIt != variableRegisters.end()) {
+                return registerIt->second;
+            }
+
+            auto locationIt = variableLocations.find(variable);
+            STORM_LOG_THROW(locationIt != variableLocations.end(), storm::exceptions::InvalidArgumentException, "Variable '" << variable.getName() << "' is not part of the state.");
+            VariableLocation const& location = locationIt->second;
+
+            Register result = createRegister(location.type);
+            if (location.type == RegisterType::Boolean) {
+                instructions.emplace_back(Opcode::LoadBoolean, result.index, location.bitOffset);
+            } else if (location.bitWidth == 0) {
+                // Variables without any bits can only take a single value, so they are constants.
+                integerRegisters[result.index] = location.offset;
+            } else {
+                Register offset = createRegister(RegisterType::Integer);
+                integerRegisters[offset.index] = location.offset;
+                instructions.emplace_back(Opcode::LoadInteger, result.index, location.bitOffset, location.bitWidth, offset.index);
+            }
+            variableRegisters.emplace(variable, result);
+            return result;
+        }
+
+        BytecodeProgram::Register BytecodeProgram::toRational(Register const& value) {
+            STORM_LOG_THROW(value.type != RegisterType::Boolean, storm::exceptions::InvalidTypeException, "Cannot convert boolean to rational.");
+            if (value.type == RegisterType::Rational) {
+                return value;
+            }
+            Register result = createRegister(RegisterType::Rational);
+            instructions.emplace_back(Opcode::IntegerToRational, result.index, value.index);
+            return result;
+        }
+
+        void BytecodeProgram::execute(CompressedState const& state) {
+            uint8_t* b = booleanRegisters.data();
+            int_fast64_t* i = integerRegisters.data();
+            double* r = rationalRegisters.data();
+
+            for (auto const& instruction : instructions) {
+                uint_fast64_t const target = instruction.target;
+                uint_fast64_t const first = instruction.first;
+                uint_fast64_t const second = instruction.second;
+                uint_fast64_t const third = instruction.third;
+
+                switch (instruction.opcode) {
+                    case Opcode::LoadBoolean: b[target] = state.get(first) ? 1 : 0; break;
+                    case Opcode::LoadInteger: i[target] = static_cast<int_fast64_t>(state.getAsInt(first, second)) + i[third]; break;
+
+                    case Opcode::Not: b[target] = !b[first]; break;
+                    case Opcode::And: b[target] = b[first] && b[second]; break;
+                    case Opcode::Or: b[target] = b[first] || b[second]; break;
+                    case Opcode::Xor: b[target] = b[first] != b[second]; break;
+                    case Opcode::Implies: b[target] = !b[first] || b[second]; break;
+                    case Opcode::Iff: b[target] = b[first] == b[second]; break;
+                    case Opcode::BooleanIte: b[target] = b[first] ? b[second] : b[third]; break;
+
+                    case Opcode::IntegerPlus: i[target] = i[first] + i[second]; break;
+                    case Opcode::IntegerMinus: i[target] = i[first] - i[second]; break;
+                    case Opcode::IntegerTimes: i[target] = i[first] * i[second]; break;
+                    case Opcode::IntegerMin: i[target] = std::min(i[first], i[second]); break;
+                    case Opcode::IntegerMax: i[target] = std::max(i[first], i[second]); break;
+                    case Opcode::IntegerNegate: i[target] = -i[first]; break;
+                    case Opcode::IntegerIte: i[target] = b[first] ? i[second] : i[third]; break;
+                    case Opcode::IntegerToRational: r[target] = static_cast<double>(i[first]); break;
+
+                    case Opcode::IntegerEqual: b[target] = i[first] == i[second]; break;
+                    case Opcode::IntegerNotEqual: b[target] = i[first] != i[second]; break;
+                    case Opcode::IntegerLess: b[target] = i[first] < i[second]; break;
+                    case Opcode::IntegerLessOrEqual: b[target] = i[first] <= i[second]; break;
+                    case Opcode::IntegerGreater: b[target] = i[first] > i[second]; break;
+                    case Opcode::IntegerGreaterOrEqual: b[target] = i[first] >= i[second]; break;
+
+                    case Opcode::RationalPlus: r[target] = r[first] + r[second]; break;
+                    case Opcode::RationalMinus: r[target] = r[first] - r[second]; break;
+                    case Opcode::RationalTimes: r[target] = r[first] * r[second]; break;
+                    case Opcode::RationalDivide: r[target] = r[first] / r[second]; break;
+                    case Opcode::RationalMin: r[target] = std::min(r[first], r[second]); break;
+                    case Opcode::RationalMax: r[target] = std::max(r[first], r[second]); break;
+                    case Opcode::RationalPower: r[target] = std::pow(r[first], r[second]); break;
+                    case Opcode::RationalNegate: r[target] = -r[first]; break;
+                    case Opcode::RationalIte: r[target] = b[first] ? r[second] : r[third]; break;
+                    case Opcode::RationalFloor: i[target] = static_cast<int_fast64_t>(std::floor(r[first])); break;
+                    case Opcode::RationalCeil: i[target] = static_cast<int_fast64_t>(std::ceil(r[first])); break;
+
+                    case Opcode::RationalEqual: b[target] = r[first] == r[second]; break;
+                    case Opcode::RationalNotEqual: b[target] = r[first] != r[second]; break;
+                    case Opcode::RationalLess: b[target] = r[first] < r[second]; break;
+                    case Opcode::RationalLessOrEqual: b[target] = r[first] <= r[second]; break;
+                    case Opcode::RationalGreater: b[target] = r[first] > r[second]; break;
+                    case Opcode::RationalGreaterOrEqual: b[target] = r[first] >= r[second]; break;
+                }
+            }
+        }
+
+        bool BytecodeProgram::getBooleanValue(uint64_t index) const {
+            Register const& output = outputs[index];
+            STORM_LOG_ASSERT(output.type == RegisterType::Boolean, "Expression does not have boolean type.");
+            return booleanRegisters[output.index] != 0;
+        }
+
+        int_fast64_t BytecodeProgram::getIntegerValue(uint64_t index) const {
+            Register const& output = outputs[index];
+            STORM_LOG_ASSERT(output.type != RegisterType::Boolean, "Expression does not have numerical type.");
+            if (output.type == RegisterType::Integer) {
+                return integerRegisters[output.index];
+            }
+            return static_cast<int_fast64_t>(rationalRegisters[output.index]);
+        }
+
+        double BytecodeProgram::getRationalValue(uint64_t index) const {
+            Register const& output = outputs[index];
+            STORM_LOG_ASSERT(output.type != RegisterType::Boolean, "Expression does not have numerical type.");
+            if (output.type == RegisterType::Integer) {
+                return static_cast<double>(integerRegisters[output.index]);
+            }
+            return rationalRegisters[output.index];
+        }
+
+    }
+}
@@ -0,0 +1,181 @@
+#ifndef STORM_GENERATOR_BYTECODEPROGRAM_H_
+#define STORM_GENERATOR_BYTECODEPROGRAM_H_
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include <boost/container/flat_map.hpp>
+
+#include "storm/storage/expressions/Expression.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+
+namespace storm {
+    namespace expressions {
+        class BaseExpression;
+    }
+
+    namespace generator {
+
+        class BytecodeCompiler;
+
+        /*!
+         * A program that evaluates a batch of expressions directly on compressed states. The expressions are compiled
+         * to a straight-line sequence of instructions over typed (boolean, integer and rational) registers. Variables
+         * are read from the bit offsets given by the variable information, so no valuation needs to be filled before
+         * the evaluation. Since the program does not contain jumps, every variable is loaded and every shared
+         * subexpression is evaluated at most once per execution, even if it is used by several of the expressions.
+         *
+         * Numerical operations follow the semantics of the exprtk-based evaluator: divisions and powers are performed
+         * on rationals (doubles) and integer results are obtained by truncation.
+         */
+        class BytecodeProgram {
+        public:
+            friend class BytecodeCompiler;
+
+            /*!
+             * Creates an empty program whose expressions may refer to the variables of the given variable information.
+             *
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            BytecodeProgram(VariableInformation const& variableInformation);
+
+            /*!
+             * Checks whether the given expression can be compiled, i.e. whether all its variables are state variables.
+             *
+             * @param expression The expression to check.
+             * @return True iff the expression can be added to the program.
+             */
+            bool canCompile(storm::expressions::Expression const& expression) const;
+
+            /*!
+             * Compiles the given expression and appends it to the program.
+             *
+             * @param expression The expression to add. It must satisfy canCompile.
+             * @return The index under which the value of the expression can be retrieved after an execution.
+             */
+            uint64_t addExpression(storm::expressions::Expression const& expression);
+
+            /*!
+             * Retrieves the number of expressions of the program.
+             */
+            uint64_t getNumberOfExpressions() const;
+
+            /*!
+             * Retrieves the number of instructions of the program.
+             */
+            uint64_t getNumberOfInstructions() const;
+
+            /*!
+             * Evaluates all expressions of the program in the given state.
+             *
+             * @param state The state in which to evaluate the expressions.
+             */
+            void execute(CompressedState const& state);
+
+            /*!
+             * Retrieves the value of the expression with the given index in the state of the last execution.
+             *
+             * @param index The index of the expression as returned by addExpression.
+             */
+            bool getBooleanValue(uint64_t index) const;
+            int_fast64_t getIntegerValue(uint64_t index) const;
+            double getRationalValue(uint64_t index) const;
+
+        private:
+            enum class RegisterType { Boolean, Integer, Rational };
+
+            struct Register {
+                Register();
+                Register(RegisterType type, uint_fast64_t index);
+
+                // The type of the register.
+                RegisterType type;
+
+                // The index of the register within the register file of its type.
+                uint_fast64_t index;
+            };
+
+            enum class Opcode : uint8_t {
+                LoadBoolean, LoadInteger,
+                Not, And, Or, Xor, Implies, Iff, BooleanIte,
+                IntegerPlus, IntegerMinus, IntegerTimes, IntegerMin, IntegerMax, IntegerNegate, IntegerIte, IntegerToRational,
+                IntegerEqual, IntegerNotEqual, IntegerLess, IntegerLessOrEqual, IntegerGreater, IntegerGreaterOrEqual,
+                RationalPlus, RationalMinus, RationalTimes, RationalDivide, RationalMin, RationalMax, RationalPower, RationalNegate, RationalIte, RationalFloor, RationalCeil,
+                RationalEqual, RationalNotEqual, RationalLess, RationalLessOrEqual, RationalGreater, RationalGreaterOrEqual
+            };
+
+            struct Instruction {
+                Instruction(Opcode opcode, uint_fast64_t target, uint_fast64_t first, uint_fast64_t second = 0, uint_fast64_t third = 0);
+
+                // The operation to perform.
+                Opcode opcode;
+
+                // The index of the register that receives the result.
+                uint_fast64_t target;
+
+                // The operands. Depending on the operation, these are register indices or bit offsets/widths.
+                uint_fast64_t first;
+                uint_fast64_t second;
+                uint_fast64_t third;
+            };
+
+            /*!
+             * Creates a fresh register of the given type.
+             */
+            Register createRegister(RegisterType type);
+
+            /*!
+             * Retrieves a register that is loaded with the value of the given variable.
+             */
+            Register getVariableRegister(storm::expressions::Variable const& variable);
+
+            /*!
+             * Retrieves a register that holds the given value converted to a rational.
+             */
+            Register toRational(Register const& value);
+
+            /// The location of the state variables within the compressed states.
+            struct VariableLocation {
+                // The type the variable is loaded as.
+                RegisterType type;
+
+                // The bit offset of the variable.
+                uint_fast64_t bitOffset;
+
+                // The bit width of the variable.
+                uint_fast64_t bitWidth;
+
+                // The value that is added to the stored bits to obtain the value of the variable.
+                int_fast64_t offset;
+            };
+            boost::container::flat_map<storm::expressions::Variable, VariableLocation> variableLocations;
+
+            /// The registers to which variables have already been loaded.
+            std::unordered_map<storm::expressions::Variable, Register> variableRegisters;
+
+            /// The registers holding the values of subexpressions that were already compiled.
+            std::unordered_map<storm::expressions::BaseExpression const*, Register> subexpressionRegisters;
+
+            /// The compiled expressions. They are kept to guarantee that the subexpressions used as keys stay alive.
+            std::vector<storm::expressions::Expression> expressions;
+
+            /// The registers holding the values of the compiled expressions.
+            std::vector<Register> outputs;
+
+            /// The instructions of the program.
+            std::vector<Instruction> instructions;
+
+            /// The register files. Registers that are not written by any instruction hold constants.
+            std::vector<uint8_t> booleanRegisters;
+            std::vector<int_fast64_t> integerRegisters;
+            std::vector<double> rationalRegisters;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_BYTECODEPROGRAM_H_ */
@@ -52,6 +52,16 @@ namespace storm {
             return evaluator->asBool(expression);
         }
         
+        template<typename ValueType, typename StateType>
+        boost::optional<uint64_t> NextStateGenerator<ValueType, StateType>::getTerminalStateIndex() const {
+            for (uint64_t index = 0; index < terminalStates.size(); ++index) {
+                if (evaluator->asBool(terminalStates[index].first) == terminalStates[index].second) {
+                    return index;
+                }
+            }
+            return boost::none;
+        }
+        
         template<typename ValueType, typename StateType>
         storm::models::sparse::StateLabeling NextStateGenerator<ValueType, StateType>::label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices, std::vector<StateType> const& deadlockStateIndices, std::vector<std::pair<std::string, storm::expressions::Expression>> labelsAndExpressions) {
             
@@ -150,6 +160,11 @@ namespace storm {
             return unpackStateIntoValuation(state, variableInformation, *expressionManager);
         }
         
+        template<typename ValueType, typename StateType>
+        storm::storage::sparse::StateValuations NextStateGenerator<ValueType, StateType>::createStateValuations(uint64_t numberOfStates) const {
+            return storm::storage::sparse::StateValuations(expressionManager, variableInformation, numberOfStates);
+        }
+        
         template<typename ValueType, typename StateType>
         std::shared_ptr<storm::storage::sparse::ChoiceOrigins> NextStateGenerator<ValueType, StateType>::generateChoiceOrigins(std::vector<boost::any>& dataForChoiceOrigins) const {
             STORM_LOG_ERROR_COND(!options.isBuildChoiceOriginsSet(), "Generating choice origins is not supported for the considered model format.");
@@ -10,6 +10,7 @@
 #include "storm/storage/sparse/StateStorage.h"
 #include "storm/storage/expressions/ExpressionEvaluator.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
+#include "storm/storage/sparse/StateValuations.h"
 
 #include "storm/builder/BuilderOptions.h"
 #include "storm/builder/RewardModelInformation.h"
@@ -56,11 +57,23 @@ namespace storm {
             virtual StateBehavior<ValueType, StateType> expand(StateToIdCallback const& stateToIdCallback) = 0;
             bool satisfies(storm::expressions::Expression const& expression) const;
             
+            /*!
+             * Retrieves the index of the first terminal state entry of the options that applies to the loaded state
+             * (if any).
+             */
+            boost::optional<uint64_t> getTerminalStateIndex() const;
+            
             virtual std::size_t getNumberOfRewardModels() const = 0;
             virtual storm::builder::RewardModelInformation getRewardModelInformation(uint64_t const& index) const = 0;
             
             storm::expressions::SimpleValuation toValuation(CompressedState const& state) const;
             
+            /*!
+             * Creates state valuations for the given number of states whose valuations can be set from the compressed
+             * states of this generator.
+             */
+            storm::storage::sparse::StateValuations createStateValuations(uint64_t numberOfStates) const;
+            
             virtual storm::models::sparse::StateLabeling label(storm::storage::sparse::StateStorage<StateType> const& stateStorage, std::vector<StateType> const& initialStateIndices = {}, std::vector<StateType> const& deadlockStateIndices = {}) = 0;
             
             NextStateGeneratorOptions const& getOptions() const;
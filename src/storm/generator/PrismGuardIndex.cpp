@@ -0,0 +1,183 @@
+#include "storm/generator/PrismGuardIndex.h"
+
+#include <boost/container/flat_map.hpp>
+
+#include "storm/storage/prism/Module.h"
+#include "storm/storage/expressions/Expressions.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // Variables that need more bits are not considered as index variables to keep the tables small.
+            uint_fast64_t const maximalIndexBitWidth = 12;
+
+            // A state variable that can serve as the index variable.
+            struct IndexCandidate {
+                // The position of the variable in the compressed states.
+                uint_fast64_t bitOffset;
+                uint_fast64_t bitWidth;
+
+                // The value represented by the bits that are all zero.
+                int_fast64_t lowerBound;
+
+                // The number of values of the variable.
+                uint_fast64_t numberOfValues;
+
+                // For each command, the values of the bits that are not excluded by the conjuncts of its guard.
+                std::vector<storm::storage::BitVector> allowedValues;
+            };
+
+            // A conjunct of the form 'variable relation constant'.
+            struct Restriction {
+                storm::expressions::Variable variable;
+                storm::expressions::BinaryRelationExpression::RelationType relation;
+                int_fast64_t constant;
+            };
+
+            void collectConjuncts(storm::expressions::BaseExpression const& expression, std::vector<storm::expressions::BaseExpression const*>& conjuncts) {
+                if (expression.isBinaryBooleanFunctionExpression() && expression.asBinaryBooleanFunctionExpression().getOperatorType() == storm::expressions::BinaryBooleanFunctionExpression::OperatorType::And) {
+                    collectConjuncts(*expression.asBinaryBooleanFunctionExpression().getFirstOperand(), conjuncts);
+                    collectConjuncts(*expression.asBinaryBooleanFunctionExpression().getSecondOperand(), conjuncts);
+                } else {
+                    conjuncts.push_back(&expression);
+                }
+            }
+
+            storm::expressions::BinaryRelationExpression::RelationType mirror(storm::expressions::BinaryRelationExpression::RelationType relation) {
+                switch (relation) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: return storm::expressions::BinaryRelationExpression::RelationType::Greater;
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: return storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: return storm::expressions::BinaryRelationExpression::RelationType::Less;
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: return storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual;
+                    default: return relation;
+                }
+            }
+
+            boost::optional<Restriction> getRestriction(storm::expressions::BaseExpression const& conjunct) {
+                if (conjunct.isVariableExpression() && conjunct.hasBooleanType()) {
+                    return Restriction({conjunct.asVariableExpression().getVariable(), storm::expressions::BinaryRelationExpression::RelationType::Equal, 1});
+                }
+                if (conjunct.isUnaryBooleanFunctionExpression() && conjunct.asUnaryBooleanFunctionExpression().getOperand()->isVariableExpression()) {
+                    return Restriction({conjunct.asUnaryBooleanFunctionExpression().getOperand()->asVariableExpression().getVariable(), storm::expressions::BinaryRelationExpression::RelationType::Equal, 0});
+                }
+                if (conjunct.isBinaryRelationExpression()) {
+                    storm::expressions::BinaryRelationExpression const& relation = conjunct.asBinaryRelationExpression();
+                    if (relation.getFirstOperand()->isVariableExpression() && relation.getSecondOperand()->isIntegerLiteralExpression()) {
+                        return Restriction({relation.getFirstOperand()->asVariableExpression().getVariable(), relation.getRelationType(), relation.getSecondOperand()->asIntegerLiteralExpression().getValue()});
+                    }
+                    if (relation.getFirstOperand()->isIntegerLiteralExpression() && relation.getSecondOperand()->isVariableExpression()) {
+                        return Restriction({relation.getSecondOperand()->asVariableExpression().getVariable(), mirror(relation.getRelationType()), relation.getFirstOperand()->asIntegerLiteralExpression().getValue()});
+                    }
+                }
+                return boost::none;
+            }
+
+            bool isSatisfied(Restriction const& restriction, int_fast64_t value) {
+                switch (restriction.relation) {
+                    case storm::expressions::BinaryRelationExpression::RelationType::Equal: return value == restriction.constant;
+                    case storm::expressions::BinaryRelationExpression::RelationType::NotEqual: return value != restriction.constant;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Less: return value < restriction.constant;
+                    case storm::expressions::BinaryRelationExpression::RelationType::LessOrEqual: return value <= restriction.constant;
+                    case storm::expressions::BinaryRelationExpression::RelationType::Greater: return value > restriction.constant;
+                    case storm::expressions::BinaryRelationExpression::RelationType::GreaterOrEqual: return value >= restriction.constant;
+                }
+                return true;
+            }
+        }
+
+        PrismGuardIndex::PrismGuardIndex(storm::prism::Module const& module) : bitOffset(0), bitWidth(0), allCommands(module.getNumberOfCommands(), true) {
+            // Intentionally left empty.
+        }
+
+        PrismGuardIndex::PrismGuardIndex(storm::prism::Module const& module, VariableInformation const& variableInformation) : bitOffset(0), bitWidth(0), allCommands(module.getNumberOfCommands(), true) {
+            // Gather all state variables that are small enough to serve as the index variable.
+            boost::container::flat_map<storm::expressions::Variable, IndexCandidate> candidates;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                candidates.emplace(booleanVariable.variable, IndexCandidate({booleanVariable.bitOffset, 1, 0, 2, {}}));
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                if (integerVariable.bitWidth > 0 && integerVariable.bitWidth <= maximalIndexBitWidth) {
+                    candidates.emplace(integerVariable.variable, IndexCandidate({integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound, static_cast<uint_fast64_t>(integerVariable.upperBound - integerVariable.lowerBound + 1), {}}));
+                }
+            }
+
+            // Determine for each candidate and command which values are excluded by the conjuncts of the guard.
+            uint_fast64_t numberOfCommands = module.getNumberOfCommands();
+            for (uint_fast64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+                std::vector<storm::expressions::BaseExpression const*> conjuncts;
+                collectConjuncts(module.getCommand(commandIndex).getGuardExpression().getBaseExpression(), conjuncts);
+
+                for (auto const& conjunct : conjuncts) {
+                    boost::optional<Restriction> restriction = getRestriction(*conjunct);
+                    if (!restriction) {
+                        continue;
+                    }
+                    auto candidateIt = candidates.find(restriction->variable);
+                    if (candidateIt == candidates.end()) {
+                        continue;
+                    }
+
+                    IndexCandidate& candidate = candidateIt->second;
+                    if (candidate.allowedValues.empty()) {
+                        candidate.allowedValues.resize(numberOfCommands, storm::storage::BitVector(1ull << candidate.bitWidth, true));
+                    }
+                    // Bits that do not represent a value of the variable never occur, so they are left untouched.
+                    for (uint_fast64_t bits = 0; bits < candidate.numberOfValues; ++bits) {
+                        if (!isSatisfied(restriction.get(), static_cast<int_fast64_t>(bits) + candidate.lowerBound)) {
+                            candidate.allowedValues[commandIndex].set(bits, false);
+                        }
+                    }
+                }
+            }
+
+            // Select the candidate that saves the most guard evaluations per state, assuming all values are equally
+            // likely. It is only used if it saves at least one evaluation on average.
+            double bestSavings = 0;
+            auto bestCandidateIt = candidates.end();
+            for (auto candidateIt = candidates.begin(); candidateIt != candidates.end(); ++candidateIt) {
+                IndexCandidate const& candidate = candidateIt->second;
+                if (candidate.allowedValues.empty()) {
+                    continue;
+                }
+                uint_fast64_t excludedValues = 0;
+                for (auto const& allowedValues : candidate.allowedValues) {
+                    excludedValues += allowedValues.size() - allowedValues.getNumberOfSetBits();
+                }
+                double savings = static_cast<double>(excludedValues) / candidate.numberOfValues;
+                if (savings > bestSavings) {
+                    bestSavings = savings;
+                    bestCandidateIt = candidateIt;
+                }
+            }
+            if (bestCandidateIt == candidates.end() || bestSavings < 1) {
+                STORM_LOG_TRACE("No guard index for module '" << module.getName() << "'.");
+                return;
+            }
+
+            // Transpose the allowed values of the chosen variable to bit masks over the commands.
+            IndexCandidate const& candidate = bestCandidateIt->second;
+            indexVariable = bestCandidateIt->first;
+            bitOffset = candidate.bitOffset;
+            bitWidth = candidate.bitWidth;
+            candidatesByValue.resize(1ull << bitWidth, storm::storage::BitVector(numberOfCommands));
+            for (uint_fast64_t commandIndex = 0; commandIndex < numberOfCommands; ++commandIndex) {
+                for (auto bits : candidate.allowedValues[commandIndex]) {
+                    candidatesByValue[bits].set(commandIndex);
+                }
+            }
+            STORM_LOG_TRACE("Indexing the guards of module '" << module.getName() << "' by variable '" << indexVariable->getName() << "' saves " << bestSavings << " guard evaluations per state on average.");
+        }
+
+        bool PrismGuardIndex::hasIndexVariable() const {
+            return static_cast<bool>(indexVariable);
+        }
+
+        storm::expressions::Variable const& PrismGuardIndex::getIndexVariable() const {
+            return indexVariable.get();
+        }
+
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef STORM_GENERATOR_PRISMGUARDINDEX_H_
+#define STORM_GENERATOR_PRISMGUARDINDEX_H_
+
+#include <vector>
+#include <cstdint>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Variable.h"
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+
+namespace storm {
+    namespace prism {
+        class Module;
+    }
+
+    namespace generator {
+
+        /*!
+         * An index over the commands of a PRISM module that restricts the commands whose guards need to be evaluated
+         * in a state. It selects the state variable that best discriminates the guards of the module, typically a
+         * program counter or phase variable that is tested by conjuncts of the form 'pc=3'. For every value of this
+         * variable, it stores a bit mask of the commands whose guards are not falsified by these conjuncts. All other
+         * commands are disabled in states with this value and need not be considered.
+         */
+        class PrismGuardIndex {
+        public:
+            /*!
+             * Builds the index for the given module.
+             *
+             * @param module The module whose commands to index.
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            PrismGuardIndex(storm::prism::Module const& module, VariableInformation const& variableInformation);
+
+            /*!
+             * Builds a trivial index for the given module, for which all commands are candidates in all states.
+             *
+             * @param module The module whose commands to index.
+             */
+            explicit PrismGuardIndex(storm::prism::Module const& module);
+
+            /*!
+             * Retrieves whether a variable was found that discriminates the commands. If not, all commands are
+             * candidates in all states.
+             */
+            bool hasIndexVariable() const;
+
+            /*!
+             * Retrieves the variable used to discriminate the commands. May only be called if there is one.
+             */
+            storm::expressions::Variable const& getIndexVariable() const;
+
+            /*!
+             * Retrieves the commands that can possibly be enabled in the given state.
+             *
+             * @param state The state for which to retrieve the candidates.
+             * @return A bit vector whose set bits are the (module-local) indices of the candidate commands.
+             */
+            storm::storage::BitVector const& getCandidateCommands(CompressedState const& state) const {
+                if (indexVariable) {
+                    return candidatesByValue[state.getAsInt(bitOffset, bitWidth)];
+                }
+                return allCommands;
+            }
+
+        private:
+            // The variable used to discriminate the commands, if there is one.
+            boost::optional<storm::expressions::Variable> indexVariable;
+
+            // The position of the index variable in the compressed states.
+            uint_fast64_t bitOffset;
+            uint_fast64_t bitWidth;
+
+            // The candidate commands for each value of the bits that store the index variable.
+            std::vector<storm::storage::BitVector> candidatesByValue;
+
+            // A bit vector that contains all commands of the module.
+            storm::storage::BitVector allCommands;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_PRISMGUARDINDEX_H_ */
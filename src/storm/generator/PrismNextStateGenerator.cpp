@@ -1,5 +1,7 @@
 #include "storm/generator/PrismNextStateGenerator.h"
 
+#include <algorithm>
+
 #include <boost/container/flat_map.hpp>
 #include <boost/any.hpp>
 
@@ -27,7 +29,7 @@ namespace storm {
         }
         
         template<typename ValueType, typename StateType>
-        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false) {
+        PrismNextStateGenerator<ValueType, StateType>::PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool) : NextStateGenerator<ValueType, StateType>(program.getManager(), options), program(program), rewardModels(), hasStateActionRewards(false), numberOfGuardEvaluations(0), numberOfSkippedGuardEvaluations(0), bytecodeLikelihoods(false), lastEvaluatedUpdate(nullptr), numberOfReducedStates(0) {
             STORM_LOG_TRACE("Creating next-state generator for PRISM program: " << program);
             STORM_LOG_THROW(!this->program.specifiesSystemComposition(), storm::exceptions::WrongFormatException, "The explicit next-state generator currently does not support custom system compositions.");
                         
@@ -38,6 +40,20 @@ namespace storm {
             // Create a proper evalator.
             this->evaluator = std::make_unique<storm::expressions::ExpressionEvaluator<ValueType>>(program.getManager());
             
+            if (this->options.isBytecodeSet()) {
+                compileToBytecode();
+            }
+            
+            // Index the commands of every module by the variables their guards test. If the guards are compiled, they
+            // are all evaluated by the guard program anyway, so the candidates are not restricted.
+            for (auto const& module : this->program.getModules()) {
+                if (guardProgram) {
+                    guardIndices.emplace_back(module);
+                } else {
+                    guardIndices.emplace_back(module, this->variableInformation);
+                }
+            }
+            
             if (this->options.isBuildAllRewardModelsSet()) {
                 for (auto const& rewardModel : this->program.getRewardModels()) {
                     rewardModels.push_back(rewardModel);
@@ -80,8 +96,97 @@ namespace storm {
                     }
                 }
             }
+            
+            if (this->options.isSymmetryReductionSet()) {
+                symmetryReduction = PrismSymmetryReduction(this->program, this->variableInformation);
+                
+                // Merging symmetric states is only sound if the labels, rewards and terminal states cannot tell the
+                // processes apart.
+                std::vector<storm::expressions::Expression> observedExpressions;
+                if (this->options.isBuildAllLabelsSet()) {
+                    for (auto const& label : this->program.getLabels()) {
+                        observedExpressions.push_back(label.getStatePredicateExpression());
+                    }
+                } else {
+                    for (auto const& labelName : this->options.getLabelNames()) {
+                        if (this->program.hasLabel(labelName)) {
+                            observedExpressions.push_back(this->program.getLabelExpression(labelName));
+                        }
+                    }
+                }
+                observedExpressions.insert(observedExpressions.end(), this->options.getExpressionLabels().begin(), this->options.getExpressionLabels().end());
+                for (auto const& expressionBool : this->terminalStates) {
+                    observedExpressions.push_back(expressionBool.first);
+                }
+                for (auto const& rewardModel : rewardModels) {
+                    for (auto const& stateReward : rewardModel.get().getStateRewards()) {
+                        observedExpressions.push_back(stateReward.getStatePredicateExpression());
+                        observedExpressions.push_back(stateReward.getRewardValueExpression());
+                    }
+                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                        observedExpressions.push_back(stateActionReward.getStatePredicateExpression());
+                        observedExpressions.push_back(stateActionReward.getRewardValueExpression());
+                    }
+                    for (auto const& transitionReward : rewardModel.get().getTransitionRewards()) {
+                        observedExpressions.push_back(transitionReward.getSourceStatePredicateExpression());
+                        observedExpressions.push_back(transitionReward.getTargetStatePredicateExpression());
+                        observedExpressions.push_back(transitionReward.getRewardValueExpression());
+                    }
+                }
+                
+                bool hadSymmetries = symmetryReduction->hasSymmetries();
+                symmetryReduction->dropDistinguishedProcessGroups(observedExpressions);
+                if (!symmetryReduction->hasSymmetries()) {
+                    if (hadSymmetries) {
+                        STORM_LOG_WARN("The labels, rewards or properties distinguish the symmetric processes, symmetry reduction is disabled.");
+                    } else {
+                        STORM_LOG_WARN("No symmetric processes were found, symmetry reduction is disabled.");
+                    }
+                    symmetryReduction = boost::none;
+                }
+            }
+            
+            if (this->options.isPartialOrderReductionSet()) {
+                if (program.getModelType() != storm::prism::Program::ModelType::MDP) {
+                    STORM_LOG_WARN("Partial-order reduction is only supported for MDPs and is disabled.");
+                } else if (!rewardModels.empty()) {
+                    STORM_LOG_WARN("Partial-order reduction does not preserve rewards and is disabled.");
+                } else {
+                    // The commands selected by the reduction must not change the variables that labels or terminal
+                    // states depend on.
+                    std::set<storm::expressions::Variable> visibleVariables;
+                    for (auto const& label : this->program.getLabels()) {
+                        std::set<storm::expressions::Variable> variables = label.getStatePredicateExpression().getVariables();
+                        visibleVariables.insert(variables.begin(), variables.end());
+                    }
+                    for (auto const& expression : this->options.getExpressionLabels()) {
+                        std::set<storm::expressions::Variable> variables = expression.getVariables();
+                        visibleVariables.insert(variables.begin(), variables.end());
+                    }
+                    for (auto const& expressionBool : this->terminalStates) {
+                        std::set<storm::expressions::Variable> variables = expressionBool.first.getVariables();
+                        visibleVariables.insert(variables.begin(), variables.end());
+                    }
+                    
+                    partialOrderReduction = PrismPartialOrderReduction(this->program, visibleVariables);
+                    if (!partialOrderReduction->hasSafeCommands()) {
+                        STORM_LOG_WARN("No command qualifies for the partial-order reduction, it is disabled.");
+                        partialOrderReduction = boost::none;
+                    }
+                }
+            }
         }
 
+        template<typename ValueType, typename StateType>
+        PrismNextStateGenerator<ValueType, StateType>::~PrismNextStateGenerator() {
+            if (!guardProgram && numberOfGuardEvaluations + numberOfSkippedGuardEvaluations > 0) {
+                STORM_LOG_INFO("Evaluated " << numberOfGuardEvaluations << " guards, the guard indices avoided " << numberOfSkippedGuardEvaluations << " evaluations.");
+            }
+            if (partialOrderReduction) {
+                STORM_LOG_INFO("The partial-order reduction explored a single choice in " << numberOfReducedStates << " states.");
+            }
+        }
+        
         template<typename ValueType, typename StateType>
         void PrismNextStateGenerator<ValueType, StateType>::checkValid() const {
             // If the program still contains undefined constants and we are not in a parametric setting, assemble an appropriate error message.
@@ -112,6 +217,106 @@ namespace storm {
 #endif
         }
         
+        template<typename ValueType, typename StateType>
+        void PrismNextStateGenerator<ValueType, StateType>::compileToBytecode() {
+            // Collect the guards and updates by their global indices, which are used to look up the compiled
+            // expressions. If the indices are not unique, we resort to the evaluator.
+            std::vector<boost::optional<storm::expressions::Expression>> guards;
+            std::vector<storm::prism::Update const*> updates;
+            bool uniqueIndices = true;
+            for (auto const& module : program.getModules()) {
+                for (auto const& command : module.getCommands()) {
+                    if (command.getGlobalIndex() >= guards.size()) {
+                        guards.resize(command.getGlobalIndex() + 1);
+                    }
+                    uniqueIndices &= !guards[command.getGlobalIndex()];
+                    guards[command.getGlobalIndex()] = command.getGuardExpression();
+                    
+                    for (auto const& update : command.getUpdates()) {
+                        if (update.getGlobalIndex() >= updates.size()) {
+                            updates.resize(update.getGlobalIndex() + 1, nullptr);
+                        }
+                        uniqueIndices &= updates[update.getGlobalIndex()] == nullptr;
+                        updates[update.getGlobalIndex()] = &update;
+                    }
+                }
+            }
+            if (!uniqueIndices) {
+                STORM_LOG_WARN("Not compiling expressions to bytecode, because the global indices of commands or updates are not unique.");
+                return;
+            }
+            
+            // Determine which expressions can be compiled. The bytecode programs evaluate all numerical subexpressions
+            // in floating point, so guards (which may compare non-integral values) and likelihoods are only compiled
+            // if the model is built with doubles. The assignments only take integral or boolean values.
+            BytecodeProgram guardBytecode(this->variableInformation);
+            bool compileGuards = std::is_same<ValueType, double>::value;
+            bool compileUpdates = true;
+            bytecodeLikelihoods = std::is_same<ValueType, double>::value;
+            STORM_LOG_INFO_COND(compileGuards, "Not compiling guards to bytecode, because the model is not built with doubles.");
+            for (auto const& guard : guards) {
+                compileGuards &= !guard || guardBytecode.canCompile(guard.get());
+            }
+            for (auto const& update : updates) {
+                if (update) {
+                    for (auto const& assignment : update->getAssignments()) {
+                        compileUpdates &= guardBytecode.canCompile(assignment.getExpression());
+                    }
+                    bytecodeLikelihoods &= guardBytecode.canCompile(update->getLikelihoodExpression());
+                }
+            }
+            
+            // All guards are put into one program, so they are evaluated in one batch per state.
+            if (compileGuards) {
+                for (auto const& guard : guards) {
+                    guardBytecode.addExpression(guard ? guard.get() : program.getManager().boolean(false));
+                }
+                STORM_LOG_TRACE("Compiled " << guards.size() << " guards to " << guardBytecode.getNumberOfInstructions() << " instructions.");
+                guardProgram = std::move(guardBytecode);
+            } else if (std::is_same<ValueType, double>::value) {
+                STORM_LOG_INFO("Not compiling guards to bytecode, because they refer to variables that are not part of the state.");
+            }
+            
+            if (compileUpdates) {
+                updatePrograms.reserve(updates.size());
+                for (auto const& update : updates) {
+                    updatePrograms.emplace_back(this->variableInformation);
+                    if (update) {
+                        for (auto const& assignment : update->getAssignments()) {
+                            updatePrograms.back().addExpression(assignment.getExpression());
+                        }
+                        if (bytecodeLikelihoods) {
+                            updatePrograms.back().addExpression(update->getLikelihoodExpression());
+                        }
+                    }
+                }
+            } else {
+                STORM_LOG_INFO("Not compiling updates to bytecode, because they refer to variables that are not part of the state.");
+                bytecodeLikelihoods = false;
+            }
+        }
+        
+        template<typename ValueType, typename StateType>
+        bool PrismNextStateGenerator<ValueType, StateType>::isEnabled(storm::prism::Command const& command) const {
+            if (guardProgram) {
+                return guardProgram->getBooleanValue(command.getGlobalIndex());
+            }
+            return this->evaluator->asBool(command.getGuardExpression());
+        }
+        
+        template<typename ValueType, typename StateType>
+        ValueType PrismNextStateGenerator<ValueType, StateType>::evaluateUpdate(storm::prism::Update const& update) {
+            if (!updatePrograms.empty()) {
+                BytecodeProgram& updateProgram = updatePrograms[update.getGlobalIndex()];
+                updateProgram.execute(*this->state);
+                lastEvaluatedUpdate = &update;
+                if (bytecodeLikelihoods) {
+                    return storm::utility::convertNumber<ValueType>(updateProgram.getRationalValue(updateProgram.getNumberOfExpressions() - 1));
+                }
+            }
+            return this->evaluator->asRational(update.getLikelihoodExpression());
+        }
+        
         template<typename ValueType, typename StateType>
         ModelType PrismNextStateGenerator<ValueType, StateType>::getModelType() const {
             switch (program.getModelType()) {
@@ -170,8 +375,14 @@ namespace storm {
                 }
                 
                 // Register initial state and return it.
+                if (symmetryReduction) {
+                    // Several initial states may share their representative.
+                    symmetryReduction->canonicalize(initialState);
+                }
                 StateType id = stateToIdCallback(initialState);
-                initialStateIndices.push_back(id);
+                if (std::find(initialStateIndices.begin(), initialStateIndices.end(), id) == initialStateIndices.end()) {
+                    initialStateIndices.push_back(id);
+                }
                 
                 // Block the current initial state to search for the next one.
                 if (!blockingExpression.isInitialized()) {
@@ -211,10 +422,38 @@ namespace storm {
                 }
             }
 
+            // If the guards are compiled, evaluate all of them in one go.
+            if (guardProgram) {
+                guardProgram->execute(*this->state);
+            }
+            
+            // If symmetric states are merged, the successors are registered by their canonical representatives.
+            StateToIdCallback canonicalStateToIdCallback;
+            if (symmetryReduction) {
+                canonicalStateToIdCallback = [this, &stateToIdCallback] (CompressedState const& state) {
+                    CompressedState canonicalState(state);
+                    symmetryReduction->canonicalize(canonicalState);
+                    return stateToIdCallback(canonicalState);
+                };
+            }
+            StateToIdCallback const& successorStateToIdCallback = symmetryReduction ? canonicalStateToIdCallback : stateToIdCallback;
+            
+            // If the state has a choice that is independent of all others, it suffices to explore this one.
+            if (partialOrderReduction) {
+                boost::optional<Choice<ValueType>> ampleChoice = getAmpleChoice(*this->state, stateToIdCallback, successorStateToIdCallback);
+                if (ampleChoice) {
+                    ++numberOfReducedStates;
+                    result.setExpanded();
+                    result.addChoice(std::move(ampleChoice.get()));
+                    this->postprocess(result);
+                    return result;
+                }
+            }
+            
             // Get all choices for the state.
             result.setExpanded();
-            std::vector<Choice<ValueType>> allChoices = getUnlabeledChoices(*this->state, stateToIdCallback);
-            std::vector<Choice<ValueType>> allLabeledChoices = getLabeledChoices(*this->state, stateToIdCallback);
+            std::vector<Choice<ValueType>> allChoices = getUnlabeledChoices(*this->state, successorStateToIdCallback);
+            std::vector<Choice<ValueType>> allLabeledChoices = getLabeledChoices(*this->state, successorStateToIdCallback);
             for (auto& choice : allLabeledChoices) {
                 allChoices.push_back(std::move(choice));
             }
@@ -294,6 +533,12 @@ namespace storm {
         CompressedState PrismNextStateGenerator<ValueType, StateType>::applyUpdate(CompressedState const& state, storm::prism::Update const& update) {
             CompressedState newState(state);
             
+            // If the update is compiled, the values of the assignments are already computed and stored under the
+            // position of the assignment.
+            BytecodeProgram const* updateProgram = updatePrograms.empty() ? nullptr : &updatePrograms[update.getGlobalIndex()];
+            STORM_LOG_ASSERT(!updateProgram || lastEvaluatedUpdate == &update, "Applying update " << update.getGlobalIndex() << " that was not evaluated last.");
+            uint64_t assignmentIndex = 0;
+            
             // NOTE: the following process assumes that the assignments of the update are ordered in such a way that the
             // assignments to boolean variables precede the assignments to all integer variables and that within the
             // types, the assignments to variables are ordered (in ascending order) by the expression variables.
@@ -304,20 +549,20 @@ namespace storm {
             
             // Iterate over all boolean assignments and carry them out.
             auto boolIt = this->variableInformation.booleanVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasBooleanType(); ++assignmentIt, ++assignmentIndex) {
                 while (assignmentIt->getVariable() != boolIt->variable) {
                     ++boolIt;
                 }
-                newState.set(boolIt->bitOffset, this->evaluator->asBool(assignmentIt->getExpression()));
+                newState.set(boolIt->bitOffset, updateProgram ? updateProgram->getBooleanValue(assignmentIndex) : this->evaluator->asBool(assignmentIt->getExpression()));
             }
             
             // Iterate over all integer assignments and carry them out.
             auto integerIt = this->variableInformation.integerVariables.begin();
-            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt) {
+            for (; assignmentIt != assignmentIte && assignmentIt->getExpression().hasIntegerType(); ++assignmentIt, ++assignmentIndex) {
                 while (assignmentIt->getVariable() != integerIt->variable) {
                     ++integerIt;
                 }
-                int_fast64_t assignedValue = this->evaluator->asInt(assignmentIt->getExpression());
+                int_fast64_t assignedValue = updateProgram ? updateProgram->getIntegerValue(assignmentIndex) : this->evaluator->asInt(assignmentIt->getExpression());
                 if (this->options.isExplorationChecksSet()) {
                     STORM_LOG_THROW(assignedValue >= integerIt->lowerBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
                     STORM_LOG_THROW(assignedValue <= integerIt->upperBound, storm::exceptions::WrongFormatException, "The update " << update << " leads to an out-of-bounds value (" << assignedValue << ") for the variable '" << assignmentIt->getVariableName() << "'.");
@@ -354,11 +599,18 @@ namespace storm {
                 }
                 
                 std::vector<std::reference_wrapper<storm::prism::Command const>> commands;
+                storm::storage::BitVector const& candidateCommands = guardIndices[i].getCandidateCommands(*this->state);
                 
                 // Look up commands by their indices and add them if the guard evaluates to true in the given state.
                 for (uint_fast64_t commandIndex : commandIndices) {
+                    if (!candidateCommands.get(commandIndex)) {
+                        ++numberOfSkippedGuardEvaluations;
+                        continue;
+                    }
+                    ++numberOfGuardEvaluations;
+                    
                     storm::prism::Command const& command = module.getCommand(commandIndex);
-                    if (this->evaluator->asBool(command.getGuardExpression())) {
+                    if (isEnabled(command)) {
                         commands.push_back(command);
                     }
                 }
@@ -383,6 +635,7 @@ namespace storm {
             // Iterate over all modules.
             for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
                 storm::prism::Module const& module = program.getModule(i);
+                storm::storage::BitVector const& candidateCommands = guardIndices[i].getCandidateCommands(state);
                 
                 // Iterate over all commands.
                 for (uint_fast64_t j = 0; j < module.getNumberOfCommands(); ++j) {
@@ -391,60 +644,114 @@ namespace storm {
                     // Only consider unlabeled commands.
                     if (command.isLabeled()) continue;
                     
-                    // Skip the command, if it is not enabled.
-                    if (!this->evaluator->asBool(command.getGuardExpression())) {
+                    // Skip the command, if the guard index shows that it is disabled or if it is not enabled.
+                    if (!candidateCommands.get(j)) {
+                        ++numberOfSkippedGuardEvaluations;
                         continue;
                     }
-                    
-                    result.push_back(Choice<ValueType>(command.getActionIndex(), command.isMarkovian()));
-                    Choice<ValueType>& choice = result.back();
-                    
-                    // Remember the choice origin only if we were asked to.
-                    if (this->options.isBuildChoiceOriginsSet()) {
-                        CommandSet commandIndex { command.getGlobalIndex() };
-                        choice.addOriginData(boost::any(std::move(commandIndex)));
+                    ++numberOfGuardEvaluations;
+                    if (!isEnabled(command)) {
+                        continue;
                     }
                     
-                    // Iterate over all updates of the current command.
-                    ValueType probabilitySum = storm::utility::zero<ValueType>();
-                    for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
-                        storm::prism::Update const& update = command.getUpdate(k);
+                    result.push_back(getUnlabeledChoice(state, command, stateToIdCallback));
+                }
+            }
+            
+            return result;
+        }
+        
+        template<typename ValueType, typename StateType>
+        Choice<ValueType> PrismNextStateGenerator<ValueType, StateType>::getUnlabeledChoice(CompressedState const& state, storm::prism::Command const& command, StateToIdCallback stateToIdCallback) {
+            Choice<ValueType> choice(command.getActionIndex(), command.isMarkovian());
+            
+            // Remember the choice origin only if we were asked to.
+            if (this->options.isBuildChoiceOriginsSet()) {
+                CommandSet commandIndex { command.getGlobalIndex() };
+                choice.addOriginData(boost::any(std::move(commandIndex)));
+            }
+            
+            // Iterate over all updates of the current command.
+            ValueType probabilitySum = storm::utility::zero<ValueType>();
+            for (uint_fast64_t k = 0; k < command.getNumberOfUpdates(); ++k) {
+                storm::prism::Update const& update = command.getUpdate(k);
 
-                        ValueType probability = this->evaluator->asRational(update.getLikelihoodExpression());
-                        if (probability != storm::utility::zero<ValueType>()) {
-                            // Obtain target state index and add it to the list of known states. If it has not yet been
-                            // seen, we also add it to the set of states that have yet to be explored.
-                            StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
-                            
-                            // Update the choice by adding the probability/target state to it.
-                            choice.addProbability(stateIndex, probability);
-                            if (this->options.isExplorationChecksSet()) {
-                                probabilitySum += probability;
-                            }
+                ValueType probability = evaluateUpdate(update);
+                if (probability != storm::utility::zero<ValueType>()) {
+                    // Obtain target state index and add it to the list of known states. If it has not yet been
+                    // seen, we also add it to the set of states that have yet to be explored.
+                    StateType stateIndex = stateToIdCallback(applyUpdate(state, update));
+                    
+                    // Update the choice by adding the probability/target state to it.
+                    choice.addProbability(stateIndex, probability);
+                    if (this->options.isExplorationChecksSet()) {
+                        probabilitySum += probability;
+                    }
+                }
+            }
+            
+            // Create the state-action reward for the newly created choice.
+            for (auto const& rewardModel : rewardModels) {
+                ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
+                if (rewardModel.get().hasStateActionRewards()) {
+                    for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
+                        if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
+                            stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
                         }
                     }
-                    
-                    // Create the state-action reward for the newly created choice.
-                    for (auto const& rewardModel : rewardModels) {
-                        ValueType stateActionRewardValue = storm::utility::zero<ValueType>();
-                        if (rewardModel.get().hasStateActionRewards()) {
-                            for (auto const& stateActionReward : rewardModel.get().getStateActionRewards()) {
-                                if (stateActionReward.getActionIndex() == choice.getActionIndex() && this->evaluator->asBool(stateActionReward.getStatePredicateExpression())) {
-                                    stateActionRewardValue += ValueType(this->evaluator->asRational(stateActionReward.getRewardValueExpression()));
-                                }
-                            }
+                }
+                choice.addReward(stateActionRewardValue);
+            }
+            
+            if (this->options.isExplorationChecksSet()) {
+                // Check that the resulting distribution is in fact a distribution.
+                STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+            }
+            
+            return choice;
+        }
+        
+        template<typename ValueType, typename StateType>
+        boost::optional<Choice<ValueType>> PrismNextStateGenerator<ValueType, StateType>::getAmpleChoice(CompressedState const& state, StateToIdCallback const& stateToIdCallback, StateToIdCallback const& successorStateToIdCallback) {
+            for (uint_fast64_t i = 0; i < program.getNumberOfModules(); ++i) {
+                storm::storage::BitVector const& safeCommands = partialOrderReduction->getSafeCommands(i);
+                if (safeCommands.empty()) {
+                    continue;
+                }
+                
+                // The command needs to be the only enabled command of its module (including the labeled ones), as
+                // otherwise the choices of the other commands would be lost.
+                storm::prism::Module const& module = program.getModule(i);
+                storm::storage::BitVector const& candidateCommands = guardIndices[i].getCandidateCommands(state);
+                boost::optional<uint_fast64_t> enabledCommandIndex;
+                bool unique = true;
+                for (auto j : candidateCommands) {
+                    if (isEnabled(module.getCommand(j))) {
+                        if (enabledCommandIndex) {
+                            unique = false;
+                            break;
                         }
-                        choice.addReward(stateActionRewardValue);
+                        enabledCommandIndex = j;
                     }
-                    
-                    if (this->options.isExplorationChecksSet()) {
-                        // Check that the resulting distribution is in fact a distribution.
-                        STORM_LOG_THROW(!program.isDiscreteTimeModel() || this->comparator.isOne(probabilitySum), storm::exceptions::WrongFormatException, "Probabilities do not sum to one for command '" << command << "' (actually sum to " << probabilitySum << ").");
+                }
+                if (!enabledCommandIndex || !unique || !safeCommands.get(enabledCommandIndex.get())) {
+                    continue;
+                }
+                
+                // To avoid that the other modules are postponed forever along a cycle, all successors of the choice
+                // need to be explored after the current state, i.e. have a larger index. This guarantees that every
+                // cycle contains a fully expanded state. Note that the successors are registered in any case, so
+                // if this condition is violated, we must not try other modules but expand the state fully.
+                StateType currentIndex = stateToIdCallback(state);
+                Choice<ValueType> choice = getUnlabeledChoice(state, module.getCommand(enabledCommandIndex.get()), successorStateToIdCallback);
+                for (auto const& stateProbabilityPair : choice) {
+                    if (stateProbabilityPair.first <= currentIndex) {
+                        return boost::none;
                     }
                 }
+                return choice;
             }
-            
-            return result;
+            return boost::none;
         }
         
         template<typename ValueType, typename StateType>
@@ -479,9 +786,10 @@ namespace storm {
                             storm::prism::Command const& command = *iteratorList[i];
                             for (uint_fast64_t j = 0; j < command.getNumberOfUpdates(); ++j) {
                                 storm::prism::Update const& update = command.getUpdate(j);
+                                ValueType likelihood = evaluateUpdate(update);
                                 
                                 for (auto const& stateProbability : currentDistribution) {
-                                    ValueType probability = stateProbability.getValue() * this->evaluator->asRational(update.getLikelihoodExpression());
+                                    ValueType probability = stateProbability.getValue() * likelihood;
 
                                     if (!storm::utility::isZero<ValueType>(probability)) {
                                         // Compute the new state under the current update and add it to the set of new target states.
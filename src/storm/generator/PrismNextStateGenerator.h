@@ -4,6 +4,10 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/generator/NextStateGenerator.h"
+#include "storm/generator/BytecodeProgram.h"
+#include "storm/generator/PrismGuardIndex.h"
+#include "storm/generator/PrismSymmetryReduction.h"
+#include "storm/generator/PrismPartialOrderReduction.h"
 
 #include "storm/storage/prism/Program.h"
 
@@ -17,6 +21,8 @@ namespace storm {
             typedef boost::container::flat_set<uint_fast64_t> CommandSet;
             
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options = NextStateGeneratorOptions());
+            
+            virtual ~PrismNextStateGenerator();
 
             virtual ModelType getModelType() const override;
             virtual bool isDeterministicModel() const override;
@@ -42,11 +48,32 @@ namespace storm {
              */
             PrismNextStateGenerator(storm::prism::Program const& program, NextStateGeneratorOptions const& options, bool flag);
             
+            /*!
+             * Compiles the guards and updates of the program to bytecode programs that evaluate them directly on the
+             * compressed states.
+             */
+            void compileToBytecode();
+            
+            /*!
+             * Retrieves whether the guard of the given command is satisfied in the currently loaded state.
+             */
+            bool isEnabled(storm::prism::Command const& command) const;
+            
+            /*!
+             * Evaluates the given update in the currently loaded state. If the updates are compiled to bytecode, this
+             * also computes the values of the assignments, so this needs to be called before applying the update.
+             *
+             * @param update The update to evaluate.
+             * @return The likelihood of the update.
+             */
+            ValueType evaluateUpdate(storm::prism::Update const& update);
+            
             /*!
              * Applies an update to the state currently loaded into the evaluator and applies the resulting values to
              * the given compressed state.
              * @params state The state to which to apply the new values.
-             * @params update The update to apply.
+             * @params update The update to apply. If the updates are compiled to bytecode, this must be the update that
+             * was last passed to evaluateUpdate and no other state may have been loaded since.
              * @return The resulting state.
              */
             CompressedState applyUpdate(CompressedState const& state, storm::prism::Update const& update);
@@ -77,6 +104,26 @@ namespace storm {
              */
             std::vector<Choice<ValueType>> getUnlabeledChoices(CompressedState const& state, StateToIdCallback stateToIdCallback);
             
+            /*!
+             * Retrieves the choice of the given unlabeled command, which needs to be enabled in the given state.
+             *
+             * @param state The state for which to retrieve the choice.
+             * @param command The command whose choice to retrieve.
+             * @return The choice of the command.
+             */
+            Choice<ValueType> getUnlabeledChoice(CompressedState const& state, storm::prism::Command const& command, StateToIdCallback stateToIdCallback);
+            
+            /*!
+             * Determines whether the given state can be reduced to a single choice of a command that is independent of
+             * all other commands enabled in the state and retrieves this choice.
+             *
+             * @param state The state for which to retrieve the ample choice.
+             * @param stateToIdCallback The callback that maps the successor states to their indices.
+             * @param successorStateToIdCallback The callback used to register the successor states.
+             * @return The ample choice, if there is one.
+             */
+            boost::optional<Choice<ValueType>> getAmpleChoice(CompressedState const& state, StateToIdCallback const& stateToIdCallback, StateToIdCallback const& successorStateToIdCallback);
+            
             /*!
              * Retrieves all labeled choices possible from the given state.
              *
@@ -93,6 +140,38 @@ namespace storm {
             
             // A flag that stores whether at least one of the selected reward models has state-action rewards.
             bool hasStateActionRewards;
+            
+            // For each module, an index that determines the commands whose guards need to be evaluated in a state.
+            std::vector<PrismGuardIndex> guardIndices;
+            
+            // Statistics on how many guards were evaluated and how many evaluations were avoided by the guard indices.
+            uint_fast64_t numberOfGuardEvaluations;
+            uint_fast64_t numberOfSkippedGuardEvaluations;
+            
+            // If set, a program evaluating the guards of all commands. The value of a guard is stored under the global
+            // index of its command.
+            boost::optional<BytecodeProgram> guardProgram;
+            
+            // If non-empty, programs evaluating the assignments of the updates, indexed by the global update index. The
+            // value of an assignment is stored under its position within the update.
+            std::vector<BytecodeProgram> updatePrograms;
+            
+            // A flag that stores whether the update programs also evaluate the likelihoods of the updates (as their last
+            // expression).
+            bool bytecodeLikelihoods;
+            
+            // The update whose update program was executed last. Only used to check that updates are evaluated before
+            // they are applied.
+            storm::prism::Update const* lastEvaluatedUpdate;
+            
+            // If set, the symmetries used to map the generated states to canonical representatives.
+            boost::optional<PrismSymmetryReduction> symmetryReduction;
+            
+            // If set, the commands that may be explored as the only choice of a state.
+            boost::optional<PrismPartialOrderReduction> partialOrderReduction;
+            
+            // The number of states that were reduced to a single choice by the partial-order reduction.
+            uint_fast64_t numberOfReducedStates;
         };
         
     }
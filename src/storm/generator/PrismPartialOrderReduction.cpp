@@ -0,0 +1,96 @@
+#include "storm/generator/PrismPartialOrderReduction.h"
+
+#include <algorithm>
+
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // The variables that are accessed by a command.
+            struct CommandVariables {
+                std::set<storm::expressions::Variable> read;
+                std::set<storm::expressions::Variable> written;
+            };
+
+            CommandVariables getCommandVariables(storm::prism::Command const& command) {
+                CommandVariables result;
+                result.read = command.getGuardExpression().getVariables();
+                for (auto const& update : command.getUpdates()) {
+                    std::set<storm::expressions::Variable> likelihoodVariables = update.getLikelihoodExpression().getVariables();
+                    result.read.insert(likelihoodVariables.begin(), likelihoodVariables.end());
+                    for (auto const& assignment : update.getAssignments()) {
+                        std::set<storm::expressions::Variable> expressionVariables = assignment.getExpression().getVariables();
+                        result.read.insert(expressionVariables.begin(), expressionVariables.end());
+                        result.written.insert(assignment.getVariable());
+                    }
+                }
+                return result;
+            }
+
+            bool intersects(std::set<storm::expressions::Variable> const& first, std::set<storm::expressions::Variable> const& second) {
+                return std::any_of(first.begin(), first.end(), [&second] (storm::expressions::Variable const& variable) { return second.find(variable) != second.end(); } );
+            }
+        }
+
+        PrismPartialOrderReduction::PrismPartialOrderReduction(storm::prism::Program const& program, std::set<storm::expressions::Variable> const& visibleVariables) {
+            // Gather the variables that are accessed by the commands of each module.
+            uint_fast64_t numberOfModules = program.getNumberOfModules();
+            std::vector<std::vector<CommandVariables>> commandVariables(numberOfModules);
+            std::vector<std::set<storm::expressions::Variable>> guardVariables(numberOfModules);
+            for (uint_fast64_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex) {
+                for (auto const& command : program.getModule(moduleIndex).getCommands()) {
+                    commandVariables[moduleIndex].push_back(getCommandVariables(command));
+                    std::set<storm::expressions::Variable> variables = command.getGuardExpression().getVariables();
+                    guardVariables[moduleIndex].insert(variables.begin(), variables.end());
+                }
+            }
+
+            for (uint_fast64_t moduleIndex = 0; moduleIndex < numberOfModules; ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                safeCommands.emplace_back(module.getNumberOfCommands());
+
+                // Determine which variables are written and accessed by the other modules.
+                std::set<storm::expressions::Variable> writtenByOthers;
+                std::set<storm::expressions::Variable> accessedByOthers;
+                for (uint_fast64_t otherModuleIndex = 0; otherModuleIndex < numberOfModules; ++otherModuleIndex) {
+                    if (otherModuleIndex == moduleIndex) {
+                        continue;
+                    }
+                    for (auto const& variables : commandVariables[otherModuleIndex]) {
+                        writtenByOthers.insert(variables.written.begin(), variables.written.end());
+                        accessedByOthers.insert(variables.written.begin(), variables.written.end());
+                        accessedByOthers.insert(variables.read.begin(), variables.read.end());
+                    }
+                }
+
+                // If other modules can change the guards of the module, commands of the module may become enabled
+                // before the selected one is executed.
+                if (intersects(guardVariables[moduleIndex], writtenByOthers)) {
+                    continue;
+                }
+
+                for (uint_fast64_t commandIndex = 0; commandIndex < module.getNumberOfCommands(); ++commandIndex) {
+                    CommandVariables const& variables = commandVariables[moduleIndex][commandIndex];
+                    if (module.getCommand(commandIndex).isLabeled() || intersects(variables.written, accessedByOthers) || intersects(variables.read, writtenByOthers) || intersects(variables.written, visibleVariables)) {
+                        continue;
+                    }
+                    safeCommands.back().set(commandIndex);
+                }
+                STORM_LOG_TRACE("Module '" << module.getName() << "' has " << safeCommands.back().getNumberOfSetBits() << " commands that can serve as ample sets.");
+            }
+        }
+
+        bool PrismPartialOrderReduction::hasSafeCommands() const {
+            return std::any_of(safeCommands.begin(), safeCommands.end(), [] (storm::storage::BitVector const& commands) { return !commands.empty(); } );
+        }
+
+        storm::storage::BitVector const& PrismPartialOrderReduction::getSafeCommands(uint64_t moduleIndex) const {
+            return safeCommands[moduleIndex];
+        }
+
+    }
+}
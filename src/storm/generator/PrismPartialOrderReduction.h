@@ -0,0 +1,60 @@
+#ifndef STORM_GENERATOR_PRISMPARTIALORDERREDUCTION_H_
+#define STORM_GENERATOR_PRISMPARTIALORDERREDUCTION_H_
+
+#include <vector>
+#include <set>
+#include <cstdint>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+
+        /*!
+         * A static analysis of a PRISM program that determines the commands that may serve as singleton ample sets
+         * for a partial-order reduction of MDPs. A command qualifies if it is unlabeled, does not access variables
+         * that are written by other modules, does not write variables that are accessed by other modules and does
+         * not write variables that are visible to the properties. Additionally, the guards of its module must not
+         * read variables that are written by other modules. In a state in which such a command is the only enabled
+         * command of its module, it is independent of all commands of the other modules and stays the only enabled
+         * command of its module until it is executed, so it forms an ample set on its own as long as the cycle
+         * condition is met, which has to be ensured during the exploration.
+         */
+        class PrismPartialOrderReduction {
+        public:
+            /*!
+             * Analyzes the given program.
+             *
+             * @param program The program to analyze. Its constants must be substituted.
+             * @param visibleVariables The variables that occur in labels or properties.
+             */
+            PrismPartialOrderReduction(storm::prism::Program const& program, std::set<storm::expressions::Variable> const& visibleVariables);
+
+            /*!
+             * Retrieves whether any command of the program can serve as an ample set.
+             */
+            bool hasSafeCommands() const;
+
+            /*!
+             * Retrieves the commands of the given module that can serve as an ample set if they are the only enabled
+             * command of their module.
+             *
+             * @param moduleIndex The index of the module.
+             * @return A bit vector whose set bits are the (module-local) indices of the commands.
+             */
+            storm::storage::BitVector const& getSafeCommands(uint64_t moduleIndex) const;
+
+        private:
+            /// For every module, the commands that can serve as an ample set.
+            std::vector<storm::storage::BitVector> safeCommands;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_PRISMPARTIALORDERREDUCTION_H_ */
@@ -0,0 +1,400 @@
+#include "storm/generator/PrismSymmetryReduction.h"
+
+#include <algorithm>
+#include <numeric>
+#include <map>
+#include <set>
+#include <sstream>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/expressions/BaseExpression.h"
+#include "storm/storage/expressions/OperatorType.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace generator {
+
+        namespace {
+            // Retrieves the local variables of the given module, boolean ones first, in the order of their declaration.
+            std::vector<storm::expressions::Variable> getLocalVariables(storm::prism::Module const& module) {
+                std::vector<storm::expressions::Variable> result;
+                for (auto const& variable : module.getBooleanVariables()) {
+                    result.push_back(variable.getExpressionVariable());
+                }
+                for (auto const& variable : module.getIntegerVariables()) {
+                    result.push_back(variable.getExpressionVariable());
+                }
+                return result;
+            }
+
+            // Retrieves all variables that are read by the commands of the given module.
+            std::set<storm::expressions::Variable> getReadVariables(storm::prism::Module const& module) {
+                std::set<storm::expressions::Variable> result;
+                auto insertVariables = [&result] (storm::expressions::Expression const& expression) {
+                    std::set<storm::expressions::Variable> variables = expression.getVariables();
+                    result.insert(variables.begin(), variables.end());
+                };
+                for (auto const& command : module.getCommands()) {
+                    insertVariables(command.getGuardExpression());
+                    for (auto const& update : command.getUpdates()) {
+                        insertVariables(update.getLikelihoodExpression());
+                        for (auto const& assignment : update.getAssignments()) {
+                            insertVariables(assignment.getExpression());
+                        }
+                    }
+                }
+                return result;
+            }
+
+            bool isAssociativeAndCommutative(storm::expressions::OperatorType operatorType) {
+                switch (operatorType) {
+                    case storm::expressions::OperatorType::And:
+                    case storm::expressions::OperatorType::Or:
+                    case storm::expressions::OperatorType::Plus:
+                    case storm::expressions::OperatorType::Times:
+                    case storm::expressions::OperatorType::Min:
+                    case storm::expressions::OperatorType::Max:
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+
+            bool isCommutative(storm::expressions::OperatorType operatorType) {
+                switch (operatorType) {
+                    case storm::expressions::OperatorType::Xor:
+                    case storm::expressions::OperatorType::Iff:
+                    case storm::expressions::OperatorType::Equal:
+                    case storm::expressions::OperatorType::NotEqual:
+                        return true;
+                    default:
+                        return isAssociativeAndCommutative(operatorType);
+                }
+            }
+
+            std::string getNormalForm(storm::expressions::BaseExpression const& expression);
+
+            // Collects the normal forms of the operands of a nested application of the given associative operator.
+            void collectOperands(storm::expressions::BaseExpression const& expression, storm::expressions::OperatorType operatorType, std::vector<std::string>& operands) {
+                if (expression.isFunctionApplication() && expression.getOperator() == operatorType) {
+                    for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                        collectOperands(*expression.getOperand(operandIndex), operatorType, operands);
+                    }
+                } else {
+                    operands.push_back(getNormalForm(expression));
+                }
+            }
+
+            // Computes a string representation of the given expression in which the operands of commutative operators
+            // are sorted. Expressions that only differ in the order of such operands thus have the same normal form.
+            std::string getNormalForm(storm::expressions::BaseExpression const& expression) {
+                std::stringstream stream;
+                if (!expression.isFunctionApplication()) {
+                    stream << expression;
+                    return stream.str();
+                }
+
+                storm::expressions::OperatorType operatorType = expression.getOperator();
+                std::vector<std::string> operands;
+                if (isAssociativeAndCommutative(operatorType)) {
+                    collectOperands(expression, operatorType, operands);
+                } else {
+                    for (uint_fast64_t operandIndex = 0; operandIndex < expression.getArity(); ++operandIndex) {
+                        operands.push_back(getNormalForm(*expression.getOperand(operandIndex)));
+                    }
+                }
+                if (isCommutative(operatorType)) {
+                    std::sort(operands.begin(), operands.end());
+                }
+
+                stream << "(" << operatorType;
+                for (auto const& operand : operands) {
+                    stream << " " << operand;
+                }
+                stream << ")";
+                return stream.str();
+            }
+
+            bool isImage(storm::expressions::Expression const& original, std::map<storm::expressions::Variable, storm::expressions::Expression> const& substitution, storm::expressions::Expression const& image) {
+                return original.substitute(substitution).toString() == image.toString();
+            }
+
+            // Checks whether the given copy is obtained from the base module by only substituting the local variables.
+            // If so, the local variables of the copy are returned in the order corresponding to the given ones of the base.
+            boost::optional<std::vector<storm::expressions::Variable>> matchCopy(storm::prism::Module const& base, std::vector<storm::expressions::Variable> const& baseVariables, storm::prism::Module const& copy) {
+                std::vector<storm::expressions::Variable> copyVariables = getLocalVariables(copy);
+                if (copyVariables.size() != baseVariables.size()) {
+                    return boost::none;
+                }
+
+                std::map<storm::expressions::Variable, storm::expressions::Expression> substitution;
+                std::map<storm::expressions::Variable, storm::expressions::Variable> variableMapping;
+                std::vector<storm::expressions::Variable> result;
+                for (auto const& baseVariable : baseVariables) {
+                    auto renamingIt = copy.getRenaming().find(baseVariable.getName());
+                    if (renamingIt == copy.getRenaming().end()) {
+                        return boost::none;
+                    }
+                    auto copyVariableIt = std::find_if(copyVariables.begin(), copyVariables.end(), [&renamingIt] (storm::expressions::Variable const& variable) { return variable.getName() == renamingIt->second; } );
+                    if (copyVariableIt == copyVariables.end() || !(copyVariableIt->getType() == baseVariable.getType())) {
+                        return boost::none;
+                    }
+                    substitution.emplace(baseVariable, copyVariableIt->getExpression());
+                    variableMapping.emplace(baseVariable, *copyVariableIt);
+                    result.push_back(*copyVariableIt);
+                }
+
+                // The ranges of the variables need to coincide.
+                for (uint_fast64_t variableIndex = 0; variableIndex < base.getIntegerVariables().size(); ++variableIndex) {
+                    storm::prism::IntegerVariable const& baseVariable = base.getIntegerVariables()[variableIndex];
+                    auto copyVariableIt = std::find_if(copy.getIntegerVariables().begin(), copy.getIntegerVariables().end(), [&variableMapping, &baseVariable] (storm::prism::IntegerVariable const& variable) { return variable.getExpressionVariable() == variableMapping.at(baseVariable.getExpressionVariable()); } );
+                    if (!isImage(baseVariable.getLowerBoundExpression(), substitution, copyVariableIt->getLowerBoundExpression()) || !isImage(baseVariable.getUpperBoundExpression(), substitution, copyVariableIt->getUpperBoundExpression())) {
+                        return boost::none;
+                    }
+                }
+
+                // The commands need to coincide up to the substitution, including their actions.
+                if (base.getNumberOfCommands() != copy.getNumberOfCommands()) {
+                    return boost::none;
+                }
+                for (uint_fast64_t commandIndex = 0; commandIndex < base.getNumberOfCommands(); ++commandIndex) {
+                    storm::prism::Command const& baseCommand = base.getCommand(commandIndex);
+                    storm::prism::Command const& copyCommand = copy.getCommand(commandIndex);
+                    if (baseCommand.getActionName() != copyCommand.getActionName() || baseCommand.isMarkovian() != copyCommand.isMarkovian() || baseCommand.getNumberOfUpdates() != copyCommand.getNumberOfUpdates()) {
+                        return boost::none;
+                    }
+                    if (!isImage(baseCommand.getGuardExpression(), substitution, copyCommand.getGuardExpression())) {
+                        return boost::none;
+                    }
+                    for (uint_fast64_t updateIndex = 0; updateIndex < baseCommand.getNumberOfUpdates(); ++updateIndex) {
+                        storm::prism::Update const& baseUpdate = baseCommand.getUpdate(updateIndex);
+                        storm::prism::Update const& copyUpdate = copyCommand.getUpdate(updateIndex);
+                        if (baseUpdate.getAssignments().size() != copyUpdate.getAssignments().size() || !isImage(baseUpdate.getLikelihoodExpression(), substitution, copyUpdate.getLikelihoodExpression())) {
+                            return boost::none;
+                        }
+
+                        // The assignments may be ordered differently, as the renaming may change the order of the names.
+                        std::map<storm::expressions::Variable, storm::expressions::Expression> copyAssignments;
+                        for (auto const& assignment : copyUpdate.getAssignments()) {
+                            copyAssignments.emplace(assignment.getVariable(), assignment.getExpression());
+                        }
+                        for (auto const& assignment : baseUpdate.getAssignments()) {
+                            auto mappingIt = variableMapping.find(assignment.getVariable());
+                            auto copyAssignmentIt = copyAssignments.find(mappingIt != variableMapping.end() ? mappingIt->second : assignment.getVariable());
+                            if (copyAssignmentIt == copyAssignments.end() || !isImage(assignment.getExpression(), substitution, copyAssignmentIt->second)) {
+                                return boost::none;
+                            }
+                        }
+                    }
+                }
+                return result;
+            }
+        }
+
+        PrismSymmetryReduction::PrismSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation) {
+            // Group the modules by the module they were obtained from via renaming.
+            std::map<std::string, std::vector<uint_fast64_t>> copies;
+            for (uint_fast64_t moduleIndex = 0; moduleIndex < program.getNumberOfModules(); ++moduleIndex) {
+                storm::prism::Module const& module = program.getModule(moduleIndex);
+                if (module.isRenamedFromModule()) {
+                    copies[module.getBaseModule()].push_back(moduleIndex);
+                }
+            }
+
+            // The local variables of all modules that take part in a renaming. The processes may only access their own
+            // ones among them.
+            std::set<storm::expressions::Variable> processVariables;
+            for (auto const& baseAndCopies : copies) {
+                for (auto const& variable : getLocalVariables(program.getModule(baseAndCopies.first))) {
+                    processVariables.insert(variable);
+                }
+                for (auto const& copyIndex : baseAndCopies.second) {
+                    for (auto const& variable : getLocalVariables(program.getModule(copyIndex))) {
+                        processVariables.insert(variable);
+                    }
+                }
+            }
+
+            // Determine the sets of processes that are symmetric when considered on their own.
+            std::vector<std::vector<std::vector<storm::expressions::Variable>>> candidateGroups;
+            std::vector<std::set<storm::expressions::Variable>> candidateGroupVariables;
+            std::vector<std::string> candidateBaseModules;
+            std::set<std::string> candidateModules;
+            for (auto const& baseAndCopies : copies) {
+                storm::prism::Module const& base = program.getModule(baseAndCopies.first);
+                std::vector<storm::expressions::Variable> baseVariables = getLocalVariables(base);
+                if (base.isRenamedFromModule() || baseVariables.empty()) {
+                    continue;
+                }
+
+                bool symmetric = true;
+                std::set<storm::expressions::Variable> baseVariableSet(baseVariables.begin(), baseVariables.end());
+                for (auto const& variable : getReadVariables(base)) {
+                    if (processVariables.find(variable) != processVariables.end() && baseVariableSet.find(variable) == baseVariableSet.end()) {
+                        STORM_LOG_TRACE("Module '" << base.getName() << "' reads variable '" << variable.getName() << "' of another process.");
+                        symmetric = false;
+                        break;
+                    }
+                }
+
+                std::vector<std::vector<storm::expressions::Variable>> processes = {baseVariables};
+                for (auto const& copyIndex : baseAndCopies.second) {
+                    if (!symmetric) {
+                        break;
+                    }
+                    boost::optional<std::vector<storm::expressions::Variable>> copyVariables = matchCopy(base, baseVariables, program.getModule(copyIndex));
+                    if (copyVariables) {
+                        processes.push_back(std::move(copyVariables.get()));
+                    } else {
+                        STORM_LOG_TRACE("Module '" << program.getModule(copyIndex).getName() << "' is not a symmetric copy of module '" << base.getName() << "'.");
+                        symmetric = false;
+                    }
+                }
+
+                if (symmetric) {
+                    std::set<storm::expressions::Variable> groupVariables;
+                    for (auto const& process : processes) {
+                        groupVariables.insert(process.begin(), process.end());
+                    }
+                    candidateGroups.push_back(std::move(processes));
+                    candidateGroupVariables.push_back(std::move(groupVariables));
+                    candidateBaseModules.push_back(base.getName());
+                    candidateModules.insert(base.getName());
+                    for (auto const& copyIndex : baseAndCopies.second) {
+                        candidateModules.insert(program.getModule(copyIndex).getName());
+                    }
+                }
+            }
+
+            // Modules outside of the sets must not be able to tell the processes apart, so they must not read their
+            // local variables.
+            std::set<storm::expressions::Variable> externallyReadVariables;
+            for (auto const& module : program.getModules()) {
+                if (candidateModules.find(module.getName()) == candidateModules.end()) {
+                    std::set<storm::expressions::Variable> readVariables = getReadVariables(module);
+                    externallyReadVariables.insert(readVariables.begin(), readVariables.end());
+                }
+            }
+
+            // Finally, create the slots of the symmetric sets of processes.
+            std::map<storm::expressions::Variable, Slot> variableSlots;
+            for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                variableSlots[booleanVariable.variable] = Slot({booleanVariable.bitOffset, 1});
+            }
+            for (auto const& integerVariable : variableInformation.integerVariables) {
+                variableSlots[integerVariable.variable] = Slot({integerVariable.bitOffset, integerVariable.bitWidth});
+            }
+            for (uint_fast64_t groupIndex = 0; groupIndex < candidateGroups.size(); ++groupIndex) {
+                bool readExternally = std::any_of(candidateGroupVariables[groupIndex].begin(), candidateGroupVariables[groupIndex].end(), [&externallyReadVariables] (storm::expressions::Variable const& variable) { return externallyReadVariables.find(variable) != externallyReadVariables.end(); } );
+                if (readExternally) {
+                    STORM_LOG_TRACE("The local variables of the copies of module '" << candidateBaseModules[groupIndex] << "' are read by other modules.");
+                    continue;
+                }
+
+                ProcessGroup group;
+                group.variables = candidateGroups[groupIndex];
+                for (auto const& process : candidateGroups[groupIndex]) {
+                    std::vector<Slot> slots;
+                    for (auto const& variable : process) {
+                        Slot const& slot = variableSlots.at(variable);
+                        // Variables with only one value do not need to be permuted.
+                        if (slot.bitWidth > 0) {
+                            slots.push_back(slot);
+                        }
+                    }
+                    group.processes.push_back(std::move(slots));
+                }
+                STORM_LOG_INFO("Found " << group.processes.size() << " symmetric processes obtained from module '" << candidateBaseModules[groupIndex] << "'.");
+                groups.push_back(std::move(group));
+            }
+        }
+
+        bool PrismSymmetryReduction::hasSymmetries() const {
+            return !groups.empty();
+        }
+
+        uint64_t PrismSymmetryReduction::getNumberOfProcessGroups() const {
+            return groups.size();
+        }
+
+        uint64_t PrismSymmetryReduction::getNumberOfProcesses(uint64_t groupIndex) const {
+            return groups[groupIndex].processes.size();
+        }
+
+        void PrismSymmetryReduction::dropDistinguishedProcessGroups(std::vector<storm::expressions::Expression> const& expressions) {
+            auto groupIt = std::remove_if(groups.begin(), groups.end(), [&expressions] (ProcessGroup const& group) {
+                for (auto const& expression : expressions) {
+                    if (!isInvariant(group, expression)) {
+                        STORM_LOG_TRACE("Expression '" << expression << "' distinguishes the symmetric processes.");
+                        return true;
+                    }
+                }
+                return false;
+            });
+            groups.erase(groupIt, groups.end());
+        }
+
+        bool PrismSymmetryReduction::isInvariant(ProcessGroup const& group, storm::expressions::Expression const& expression) {
+            std::set<storm::expressions::Variable> variables = expression.getVariables();
+            bool readsGroupVariables = std::any_of(group.variables.begin(), group.variables.end(), [&variables] (std::vector<storm::expressions::Variable> const& process) {
+                return std::any_of(process.begin(), process.end(), [&variables] (storm::expressions::Variable const& variable) { return variables.find(variable) != variables.end(); } );
+            });
+            if (!readsGroupVariables) {
+                return true;
+            }
+
+            // The transpositions of the first process with any other process generate all permutations of the
+            // processes, so it suffices to check that the expression is invariant under them.
+            std::string normalForm = getNormalForm(expression.getBaseExpression());
+            for (uint_fast64_t process = 1; process < group.variables.size(); ++process) {
+                std::map<storm::expressions::Variable, storm::expressions::Expression> transposition;
+                for (uint_fast64_t variableIndex = 0; variableIndex < group.variables[process].size(); ++variableIndex) {
+                    transposition.emplace(group.variables.front()[variableIndex], group.variables[process][variableIndex].getExpression());
+                    transposition.emplace(group.variables[process][variableIndex], group.variables.front()[variableIndex].getExpression());
+                }
+                if (getNormalForm(expression.substitute(transposition).getBaseExpression()) != normalForm) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void PrismSymmetryReduction::canonicalize(CompressedState& state) {
+            for (auto const& group : groups) {
+                uint_fast64_t numberOfProcesses = group.processes.size();
+                uint_fast64_t numberOfSlots = group.processes.front().size();
+
+                // Read the values of the local variables of all processes.
+                values.resize(numberOfProcesses * numberOfSlots);
+                for (uint_fast64_t process = 0; process < numberOfProcesses; ++process) {
+                    for (uint_fast64_t slot = 0; slot < numberOfSlots; ++slot) {
+                        Slot const& location = group.processes[process][slot];
+                        values[process * numberOfSlots + slot] = state.getAsInt(location.bitOffset, location.bitWidth);
+                    }
+                }
+
+                // Sort the processes lexicographically by their values.
+                order.resize(numberOfProcesses);
+                std::iota(order.begin(), order.end(), 0);
+                std::sort(order.begin(), order.end(), [this, numberOfSlots] (uint64_t first, uint64_t second) {
+                    return std::lexicographical_compare(values.begin() + first * numberOfSlots, values.begin() + (first + 1) * numberOfSlots, values.begin() + second * numberOfSlots, values.begin() + (second + 1) * numberOfSlots);
+                });
+
+                // Write the values back in the sorted order.
+                for (uint_fast64_t process = 0; process < numberOfProcesses; ++process) {
+                    if (order[process] == process) {
+                        continue;
+                    }
+                    for (uint_fast64_t slot = 0; slot < numberOfSlots; ++slot) {
+                        Slot const& location = group.processes[process][slot];
+                        state.setFromInt(location.bitOffset, location.bitWidth, values[order[process] * numberOfSlots + slot]);
+                    }
+                }
+            }
+        }
+
+    }
+}
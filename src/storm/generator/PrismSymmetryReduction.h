@@ -0,0 +1,102 @@
+#ifndef STORM_GENERATOR_PRISMSYMMETRYREDUCTION_H_
+#define STORM_GENERATOR_PRISMSYMMETRYREDUCTION_H_
+
+#include <vector>
+#include <cstdint>
+
+#include "storm/storage/expressions/Expression.h"
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/VariableInformation.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace generator {
+
+        /*!
+         * Detects sets of fully symmetric processes in a PRISM program and maps states to canonical representatives
+         * of their symmetry classes. A set of processes consists of a module and all modules that were obtained from
+         * it by renaming. It is only considered symmetric if the renaming only affects the local variables, i.e. the
+         * commands of every copy are obtained from the ones of the original module by substituting the local
+         * variables, and if no other module accesses the local variables of the processes. Then, permuting the values
+         * of the local variables among the processes is an automorphism of the transition relation. The canonical
+         * representative is obtained by sorting the processes by the values of their local variables.
+         *
+         * Note that merging symmetric states is only sound for labels and rewards that are symmetric as well. Sets of
+         * processes that are distinguished by them need to be dropped via dropDistinguishedProcessGroups.
+         */
+        class PrismSymmetryReduction {
+        public:
+            /*!
+             * Detects the symmetric sets of processes of the given program.
+             *
+             * @param program The program whose symmetries to detect. Its constants must be substituted.
+             * @param variableInformation The information about how the variables are packed within the states.
+             */
+            PrismSymmetryReduction(storm::prism::Program const& program, VariableInformation const& variableInformation);
+
+            /*!
+             * Retrieves whether at least one symmetric set of processes was found.
+             */
+            bool hasSymmetries() const;
+
+            /*!
+             * Retrieves the number of symmetric sets of processes.
+             */
+            uint64_t getNumberOfProcessGroups() const;
+
+            /*!
+             * Retrieves the number of processes in the given symmetric set.
+             */
+            uint64_t getNumberOfProcesses(uint64_t groupIndex) const;
+
+            /*!
+             * Drops all symmetric sets of processes for which one of the given expressions is not invariant under
+             * permuting the processes. This needs to be done for all labels, rewards and terminal states, as the
+             * states of a symmetry class are merged into one.
+             *
+             * @param expressions The expressions that must not distinguish the symmetric processes.
+             */
+            void dropDistinguishedProcessGroups(std::vector<storm::expressions::Expression> const& expressions);
+
+            /*!
+             * Replaces the given state by the canonical representative of its symmetry class.
+             *
+             * @param state The state to canonicalize.
+             */
+            void canonicalize(CompressedState& state);
+
+        private:
+            // The position of a local variable of a process within the compressed states.
+            struct Slot {
+                uint_fast64_t bitOffset;
+                uint_fast64_t bitWidth;
+            };
+
+            // A set of symmetric processes. The slots of all processes refer to corresponding variables in the same order
+            // and so do the local variables of all processes.
+            struct ProcessGroup {
+                std::vector<std::vector<Slot>> processes;
+                std::vector<std::vector<storm::expressions::Variable>> variables;
+            };
+
+            /*!
+             * Checks whether the given expression is invariant under permuting the processes of the given group.
+             */
+            static bool isInvariant(ProcessGroup const& group, storm::expressions::Expression const& expression);
+
+            /// The symmetric sets of processes.
+            std::vector<ProcessGroup> groups;
+
+            /// Buffers used for canonicalization that are kept to avoid repeated allocations.
+            std::vector<uint64_t> values;
+            std::vector<uint64_t> order;
+        };
+
+    }
+}
+
+#endif /* STORM_GENERATOR_PRISMSYMMETRYREDUCTION_H_ */
@@ -6,6 +6,7 @@
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
 
 #include "storm/utility/macros.h"
 #include "storm/utility/graph.h"
@@ -84,17 +85,17 @@ namespace storm {
                             storm::utility::Stopwatch conversionWatch(true);
                             
                             // Create an ODD for the translation to an explicit representation.
-                            storm::dd::Odd odd = statesWithProbabilityGreater0NonPsi.createOdd();
+                            storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(statesWithProbabilityGreater0NonPsi);
                             
                             // Convert the symbolic parts to their explicit representation.
-                            storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, statesWithProbabilityGreater0NonPsi, [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                             std::vector<ValueType> explicitB = b.toVector(odd);
                             conversionWatch.stop();
                             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
                             
                             // Finally compute the transient probabilities.
                             std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNonZeroCount(), storm::utility::zero<ValueType>());
-                            std::vector<ValueType> subresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, explicitUniformizedMatrix, &explicitB, upperBound, uniformizationRate, values);
+                            std::vector<ValueType> subresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, *explicitUniformizedMatrix, &explicitB, upperBound, uniformizationRate, values);
                             
                             return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(),
                                                                                                           (psiStates || !statesWithProbabilityGreater0) && model.getReachableStates(),
@@ -116,7 +117,7 @@ namespace storm {
                             
                             // Build an ODD for the relevant states.
                             conversionWatch.start();
-                            storm::dd::Odd odd = relevantStates.createOdd();
+                            storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(relevantStates);
                             conversionWatch.stop();
                             
                             std::vector<ValueType> result;
@@ -136,12 +137,12 @@ namespace storm {
                             // Compute the uniformized matrix.
                             storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
                             conversionWatch.start();
-                            storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, relevantStates, [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                             conversionWatch.stop();
                             STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                             // Compute the transient probabilities.
-                            result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, result);
+                            result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, result);
                             
                             return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), !relevantStates && model.getReachableStates(), model.getManager().template getAddZero<ValueType>(), relevantStates, odd, result));
                         } else {
@@ -162,14 +163,14 @@ namespace storm {
                                 
                                 // Build an ODD for the relevant states and translate the symbolic parts to their explicit representation.
                                 storm::utility::Stopwatch conversionWatch(true);
-                                storm::dd::Odd odd = statesWithProbabilityGreater0NonPsi.createOdd();
-                                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(statesWithProbabilityGreater0NonPsi);
+                                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, statesWithProbabilityGreater0NonPsi, [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                                 std::vector<ValueType> explicitB = b.toVector(odd);
                                 conversionWatch.stop();
 
                                 // Compute the transient probabilities.
                                 std::vector<ValueType> values(statesWithProbabilityGreater0NonPsi.getNonZeroCount(), storm::utility::zero<ValueType>());
-                                std::vector<ValueType> subResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, explicitUniformizedMatrix, &explicitB, upperBound - lowerBound, uniformizationRate, values);
+                                std::vector<ValueType> subResult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities(env, *explicitUniformizedMatrix, &explicitB, upperBound - lowerBound, uniformizationRate, values);
                                 
                                 // Transform the explicit result to a hybrid check result, so we can easily convert it to
                                 // a symbolic qualitative format.
@@ -184,7 +185,7 @@ namespace storm {
                                                                 
                                 // Build an ODD for the relevant states.
                                 conversionWatch.start();
-                                odd = relevantStates.createOdd();
+                                odd = model.getExplicitRepresentationCache().getOdd(relevantStates);
                                 
                                 std::unique_ptr<CheckResult> explicitResult = hybridResult.toExplicitQuantitativeCheckResult();
                                 conversionWatch.stop();
@@ -198,18 +199,18 @@ namespace storm {
                                 // If the lower and upper bounds coincide, we have only determined the relevant states at this
                                 // point, but we still need to construct the starting vector.
                                 if (lowerBound == upperBound) {
-                                    odd = relevantStates.createOdd();
+                                    odd = model.getExplicitRepresentationCache().getOdd(relevantStates);
                                     newSubresult = psiStates.template toAdd<ValueType>().toVector(odd);
                                 }
                                 
                                 // Finally, we compute the second set of transient probabilities.
                                 uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, relevantStates, uniformizationRate);
                                 conversionWatch.start();
-                                explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                                explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, relevantStates, [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                                 conversionWatch.stop();
                                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
+                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
                                 
                                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), !relevantStates && model.getReachableStates(), model.getManager().template getAddZero<ValueType>(), relevantStates, odd, newSubresult));
                             } else {
@@ -219,7 +220,7 @@ namespace storm {
                                 
                                 // Build an ODD for the relevant states.
                                 conversionWatch.start();
-                                storm::dd::Odd odd = statesWithProbabilityGreater0.createOdd();
+                                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(statesWithProbabilityGreater0);
 
                                 std::vector<ValueType> newSubresult = psiStates.template toAdd<ValueType>().toVector(odd);
                                 conversionWatch.stop();
@@ -232,11 +233,11 @@ namespace storm {
                                 // Finally, we compute the second set of transient probabilities.
                                 storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, statesWithProbabilityGreater0, uniformizationRate);
                                 conversionWatch.start();
-                                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, statesWithProbabilityGreater0, [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                                 conversionWatch.stop();
                                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
+                                newSubresult = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, lowerBound, uniformizationRate, newSubresult);
                                 
                                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType>(model.getReachableStates(), !statesWithProbabilityGreater0 && model.getReachableStates(), model.getManager().template getAddZero<ValueType>(), statesWithProbabilityGreater0, odd, newSubresult));
                             }
@@ -262,7 +263,7 @@ namespace storm {
                 
                 // Create ODD for the translation.
                 conversionWatch.start();
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 conversionWatch.stop();
                 
                 // Initialize result to state rewards of the model.
@@ -276,11 +277,11 @@ namespace storm {
                     storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector, model.getReachableStates(), uniformizationRate);
                     
                     conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, model.getReachableStates(), [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, result);
+                    result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType>(env, *explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, result);
                 }
                 
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), odd, result));
@@ -311,13 +312,13 @@ namespace storm {
                 
                 // Create ODD for the translation.
                 conversionWatch.start();
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 conversionWatch.stop();
                 
                 // Compute the uniformized matrix.
                 storm::dd::Add<DdType, ValueType> uniformizedMatrix = computeUniformizedMatrix(model, rateMatrix, exitRateVector,  model.getReachableStates(), uniformizationRate);
                 conversionWatch.start();
-                storm::storage::SparseMatrix<ValueType> explicitUniformizedMatrix = uniformizedMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitUniformizedMatrix = model.getExplicitRepresentationCache().getMatrix(uniformizedMatrix, model.getReachableStates(), [&uniformizedMatrix, &odd] () { return uniformizedMatrix.toMatrix(odd, odd); });
                 conversionWatch.stop();
                 
                 // Then compute the state reward vector to use in the computation.
@@ -328,7 +329,7 @@ namespace storm {
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Finally, compute the transient probabilities.
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType, true>(env, explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, explicitTotalRewardVector);
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeTransientProbabilities<ValueType, true>(env, *explicitUniformizedMatrix, nullptr, timeBound, uniformizationRate, explicitTotalRewardVector);
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
             
@@ -344,14 +345,14 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create ODD for the translation.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 
-                storm::storage::SparseMatrix<ValueType> explicitProbabilityMatrix = probabilityMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitProbabilityMatrix = model.getExplicitRepresentationCache().getMatrix(probabilityMatrix, model.getReachableStates(), [&probabilityMatrix, &odd] () { return probabilityMatrix.toMatrix(odd, odd); });
                 std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(), explicitProbabilityMatrix, psiStates.toVector(odd), &explicitExitRateVector);
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(), *explicitProbabilityMatrix, psiStates.toVector(odd), &explicitExitRateVector);
 
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
@@ -365,14 +366,14 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create ODD for the translation.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 
-                storm::storage::SparseMatrix<ValueType> explicitProbabilityMatrix = probabilityMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitProbabilityMatrix = model.getExplicitRepresentationCache().getMatrix(probabilityMatrix, model.getReachableStates(), [&probabilityMatrix, &odd] () { return probabilityMatrix.toMatrix(odd, odd); });
                 std::vector<ValueType> explicitExitRateVector = exitRateVector.toVector(odd);
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(), explicitProbabilityMatrix, rewardModel.getTotalRewardVector(probabilityMatrix, model.getColumnVariables(), exitRateVector, true).toVector(odd), &explicitExitRateVector);
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseCtmcCslHelper::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(), *explicitProbabilityMatrix, rewardModel.getTotalRewardVector(probabilityMatrix, model.getColumnVariables(), exitRateVector, true).toVector(odd), &explicitExitRateVector);
                 
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
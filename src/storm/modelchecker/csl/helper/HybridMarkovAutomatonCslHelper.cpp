@@ -0,0 +1,148 @@
+#include "storm/modelchecker/csl/helper/HybridMarkovAutomatonCslHelper.h"
+
+#include "storm/modelchecker/csl/helper/SparseMarkovAutomatonCslHelper.h"
+#include "storm/modelchecker/prctl/helper/HybridMdpPrctlHelper.h"
+
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
+
+#include "storm/modelchecker/results/SymbolicQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/Stopwatch.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeBoundedUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& psiStates, double lowerBound, double upperBound) {
+                // If there are no goal states, we avoid the computation and directly return zero.
+                if (psiStates.isZero()) {
+                    return std::unique_ptr<CheckResult>(new SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().template getAddZero<ValueType>()));
+                }
+
+                // The digitization needs the full model, so we translate all reachable states.
+                storm::utility::Stopwatch conversionWatch(true);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitTransitionMatrix = model.getExplicitRepresentationCache().getMatrix(model.getTransitionMatrix(), model.getReachableStates(), [&model, &odd] () { return model.getTransitionMatrix().toMatrix(model.getNondeterminismVariables(), odd, odd); });
+                std::vector<ValueType> explicitExitRateVector = model.getExitRateVector().toVector(odd);
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeBoundedUntilProbabilities(env, dir, *explicitTransitionMatrix, explicitExitRateVector, model.getMarkovianStates().toVector(odd), psiStates.toVector(odd), std::make_pair(lowerBound, upperBound));
+
+                return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative) {
+                // Untimed reachability only depends on the embedded MDP, whose transition matrix is stored in the model.
+                return HybridMdpPrctlHelper<DdType, ValueType>::computeUntilProbabilities(env, dir, model, model.getTransitionMatrix(), phiStates, psiStates, qualitative);
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeReachabilityRewards(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, RewardModelType const& rewardModel, storm::dd::Bdd<DdType> const& targetStates) {
+                STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
+
+                // State rewards are earned per time unit, so we weight them with the expected sojourn times and obtain
+                // a reward model for the embedded MDP.
+                boost::optional<storm::dd::Add<DdType, ValueType>> stateRewards;
+                boost::optional<storm::dd::Add<DdType, ValueType>> stateActionRewards;
+                boost::optional<storm::dd::Add<DdType, ValueType>> transitionRewards;
+                if (rewardModel.hasStateRewards()) {
+                    stateRewards = rewardModel.getStateRewardVector() * computeExpectedSojournTimes(model);
+                }
+                if (rewardModel.hasStateActionRewards()) {
+                    stateActionRewards = rewardModel.getStateActionRewardVector();
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    transitionRewards = rewardModel.getTransitionRewardMatrix();
+                }
+                RewardModelType scaledRewardModel(stateRewards, stateActionRewards, transitionRewards);
+
+                return HybridMdpPrctlHelper<DdType, ValueType>::computeReachabilityRewards(env, dir, model, model.getTransitionMatrix(), scaledRewardModel, targetStates, false);
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeReachabilityTimes(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& targetStates) {
+                // Expected times are expected rewards where every state earns its expected sojourn time.
+                RewardModelType timeRewardModel(computeExpectedSojournTimes(model), boost::none, boost::none);
+                return HybridMdpPrctlHelper<DdType, ValueType>::computeReachabilityRewards(env, dir, model, model.getTransitionMatrix(), timeRewardModel, targetStates, false);
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeLongRunAverageProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& psiStates) {
+                // If there are no goal states or all states are goal states, the result is known without any computation.
+                if (psiStates.isZero() || (model.getReachableStates() && !psiStates).isZero()) {
+                    return std::unique_ptr<CheckResult>(new SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), psiStates.template toAdd<ValueType>()));
+                }
+
+                // Since the end components of the whole model need to be analyzed, the full model is translated.
+                storm::utility::Stopwatch conversionWatch(true);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitTransitionMatrix = model.getExplicitRepresentationCache().getMatrix(model.getTransitionMatrix(), model.getReachableStates(), [&model, &odd] () { return model.getTransitionMatrix().toMatrix(model.getNondeterminismVariables(), odd, odd); });
+                std::vector<ValueType> explicitExitRateVector = model.getExitRateVector().toVector(odd);
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeLongRunAverageProbabilities(env, dir, *explicitTransitionMatrix, explicitTransitionMatrix->transpose(true), explicitExitRateVector, model.getMarkovianStates().toVector(odd), psiStates.toVector(odd));
+
+                return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeLongRunAverageRewards(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, RewardModelType const& rewardModel) {
+                STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
+
+                // In contrast to the state rewards, action and transition rewards are earned instantaneously, so they
+                // are collected in a vector over the choices.
+                storm::dd::Add<DdType, ValueType> actionRewards = model.getManager().template getAddZero<ValueType>();
+                if (rewardModel.hasStateActionRewards()) {
+                    actionRewards += rewardModel.getStateActionRewardVector();
+                }
+                if (rewardModel.hasTransitionRewards()) {
+                    actionRewards += (model.getTransitionMatrix() * rewardModel.getTransitionRewardMatrix()).sumAbstract(model.getColumnVariables());
+                }
+
+                storm::utility::Stopwatch conversionWatch(true);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = model.getTransitionMatrix().toMatrixVector(actionRewards, model.getNondeterminismVariables(), odd, odd);
+                std::vector<ValueType> explicitExitRateVector = model.getExitRateVector().toVector(odd);
+                boost::optional<std::vector<ValueType>> explicitStateRewards;
+                if (rewardModel.hasStateRewards()) {
+                    explicitStateRewards = rewardModel.getStateRewardVector().toVector(odd);
+                }
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+
+                storm::models::sparse::StandardRewardModel<ValueType> explicitRewardModel(std::move(explicitStateRewards), std::move(explicitRepresentation.second));
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseMarkovAutomatonCslHelper::computeLongRunAverageRewards<ValueType, storm::models::sparse::StandardRewardModel<ValueType>>(env, dir, explicitRepresentation.first, explicitRepresentation.first.transpose(true), explicitExitRateVector, model.getMarkovianStates().toVector(odd), explicitRewardModel);
+
+                return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
+            }
+
+            template<storm::dd::DdType DdType, typename ValueType>
+            storm::dd::Add<DdType, ValueType> HybridMarkovAutomatonCslHelper<DdType, ValueType>::computeExpectedSojournTimes(storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model) {
+                // Replace the (zero) exit rates of probabilistic states before dividing, so no division by zero occurs.
+                storm::dd::Add<DdType, ValueType> one = model.getManager().template getAddOne<ValueType>();
+                storm::dd::Add<DdType, ValueType> exitRates = model.getMarkovianStates().ite(model.getExitRateVector(), one);
+                return model.getMarkovianStates().ite(one / exitRates, model.getManager().template getAddZero<ValueType>());
+            }
+
+            template class HybridMarkovAutomatonCslHelper<storm::dd::DdType::CUDD, double>;
+            template class HybridMarkovAutomatonCslHelper<storm::dd::DdType::Sylvan, double>;
+
+            template class HybridMarkovAutomatonCslHelper<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+
+        }
+    }
+}
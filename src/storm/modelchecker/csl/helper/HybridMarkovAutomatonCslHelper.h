@@ -0,0 +1,56 @@
+#ifndef STORM_MODELCHECKER_HYBRID_MARKOVAUTOMATON_CSL_MODELCHECKER_HELPER_H_
+#define STORM_MODELCHECKER_HYBRID_MARKOVAUTOMATON_CSL_MODELCHECKER_HELPER_H_
+
+#include <memory>
+
+#include "storm/models/symbolic/MarkovAutomaton.h"
+
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+
+#include "storm/solver/OptimizationDirection.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+        // Forward-declare result class.
+        class CheckResult;
+
+        namespace helper {
+
+            /*!
+             * Model checking of closed Markov automata in the hybrid engine. The qualitative analysis is performed
+             * symbolically, the numerical computations are done on the explicit representation of the relevant states.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            class HybridMarkovAutomatonCslHelper {
+            public:
+                typedef typename storm::models::symbolic::MarkovAutomaton<DdType, ValueType>::RewardModelType RewardModelType;
+
+                static std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& psiStates, double lowerBound, double upperBound);
+
+                static std::unique_ptr<CheckResult> computeUntilProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative);
+
+                static std::unique_ptr<CheckResult> computeReachabilityRewards(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, RewardModelType const& rewardModel, storm::dd::Bdd<DdType> const& targetStates);
+
+                static std::unique_ptr<CheckResult> computeReachabilityTimes(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& targetStates);
+
+                static std::unique_ptr<CheckResult> computeLongRunAverageProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, storm::dd::Bdd<DdType> const& psiStates);
+
+                static std::unique_ptr<CheckResult> computeLongRunAverageRewards(Environment const& env, OptimizationDirection dir, storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model, RewardModelType const& rewardModel);
+
+            private:
+                /*!
+                 * Computes the expected time spent in each state per visit, i.e. the inverse of the exit rate for
+                 * Markovian states and zero for probabilistic states.
+                 */
+                static storm::dd::Add<DdType, ValueType> computeExpectedSojournTimes(storm::models::symbolic::MarkovAutomaton<DdType, ValueType> const& model);
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_MODELCHECKER_HYBRID_MARKOVAUTOMATON_CSL_MODELCHECKER_HELPER_H_ */
@@ -0,0 +1,277 @@
+#include "storm/modelchecker/incremental/SparseVerificationSession.h"
+
+#include <sstream>
+
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        namespace detail {
+            template<typename SparseModelType>
+            struct SessionModelChecker;
+
+            template<typename ValueType>
+            struct SessionModelChecker<storm::models::sparse::Dtmc<ValueType>> {
+                typedef SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> type;
+            };
+
+            template<typename ValueType>
+            struct SessionModelChecker<storm::models::sparse::Mdp<ValueType>> {
+                typedef SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> type;
+            };
+
+            template<typename ValueType>
+            bool haveSameStructure(storm::storage::SparseMatrix<ValueType> const& first, storm::storage::SparseMatrix<ValueType> const& second) {
+                if (first.getRowCount() != second.getRowCount() || first.getColumnCount() != second.getColumnCount() || first.getEntryCount() != second.getEntryCount() || first.getRowGroupCount() != second.getRowGroupCount()) {
+                    return false;
+                }
+                if (first.getRowGroupIndices() != second.getRowGroupIndices()) {
+                    return false;
+                }
+                for (uint_fast64_t row = 0; row < first.getRowCount(); ++row) {
+                    auto firstRow = first.getRow(row);
+                    auto secondRow = second.getRow(row);
+                    if (firstRow.getNumberOfEntries() != secondRow.getNumberOfEntries()) {
+                        return false;
+                    }
+                    for (auto firstIt = firstRow.begin(), secondIt = secondRow.begin(); firstIt != firstRow.end(); ++firstIt, ++secondIt) {
+                        if (firstIt->getColumn() != secondIt->getColumn() || storm::utility::isZero(firstIt->getValue()) != storm::utility::isZero(secondIt->getValue())) {
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            }
+        }
+
+        template<typename SparseModelType>
+        SparseVerificationSession<SparseModelType>::SparseVerificationSession(std::shared_ptr<SparseModelType> const& model) : model(model), numberOfCacheHits(0) {
+            STORM_LOG_THROW(model, storm::exceptions::InvalidArgumentException, "Unable to create a verification session without a model.");
+        }
+
+        template<typename SparseModelType>
+        std::shared_ptr<SparseModelType> const& SparseVerificationSession<SparseModelType>::getModel() const {
+            return model;
+        }
+
+        template<typename SparseModelType>
+        bool SparseVerificationSession<SparseModelType>::updateModel(std::shared_ptr<SparseModelType> const& newModel) {
+            STORM_LOG_THROW(newModel, storm::exceptions::InvalidArgumentException, "Unable to update a verification session without a model.");
+            bool sameStructure = model->getStateLabeling() == newModel->getStateLabeling() && detail::haveSameStructure(model->getTransitionMatrix(), newModel->getTransitionMatrix());
+            model = newModel;
+            if (sameStructure) {
+                // The previous solutions remain valid starting points and the qualitative information only depends on the structure.
+                STORM_LOG_INFO("The structure of the updated model is unchanged. Keeping cached information.");
+            } else {
+                STORM_LOG_INFO("The structure of the updated model changed. Dropping cached information.");
+                clearCache();
+            }
+            return sameStructure;
+        }
+
+        template<typename SparseModelType>
+        void SparseVerificationSession<SparseModelType>::clearCache() {
+            backwardTransitions = boost::none;
+            qualitativeInformation.clear();
+            solutions.clear();
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseVerificationSession<SparseModelType>::check(CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            Environment env;
+            return check(env, checkTask);
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseVerificationSession<SparseModelType>::check(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            if (formula.isProbabilityOperatorFormula() && formula.isInFragment(storm::logic::reachability())) {
+                storm::logic::Formula const& pathFormula = formula.asOperatorFormula().getSubformula();
+                if (pathFormula.isUntilFormula() || pathFormula.isEventuallyFormula()) {
+                    return checkReachabilityProbabilityFormula(env, checkTask);
+                }
+            } else if (formula.isRewardOperatorFormula() && formula.isInFragment(storm::logic::propositional().setRewardOperatorsAllowed(true).setReachabilityRewardFormulasAllowed(true).setOperatorAtTopLevelRequired(true).setNestedOperatorsAllowed(false))) {
+                if (formula.asRewardOperatorFormula().getMeasureType() == storm::logic::RewardMeasureType::Expectation && formula.asOperatorFormula().getSubformula().isEventuallyFormula()) {
+                    return checkReachabilityRewardFormula(env, checkTask);
+                }
+            }
+
+            // No information can be reused, so we just invoke the model checker.
+            typename detail::SessionModelChecker<SparseModelType>::type modelChecker(*model);
+            return modelChecker.check(env, checkTask);
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseVerificationSession<SparseModelType>::checkReachabilityProbabilityFormula(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::OperatorFormula const& operatorFormula = checkTask.getFormula().asOperatorFormula();
+            auto pathFormulaTask = checkTask.substituteFormula(operatorFormula.getSubformula()).setOnlyInitialStatesRelevant(false);
+            std::string key = getCacheKey(checkTask);
+
+            // Build a hint that carries the (cached) qualitative information and the previous solution (if any).
+            bool hasCachedInformation = qualitativeInformation.count(key) > 0;
+            QualitativeInformation const& qualitativeInfo = getQualitativeInformation(env, key, pathFormulaTask);
+            auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+            auto solutionIt = solutions.find(key);
+            std::vector<ValueType> resultHint;
+            if (solutionIt != solutions.end()) {
+                resultHint = solutionIt->second;
+                hasCachedInformation = true;
+            } else {
+                resultHint = std::vector<ValueType>(model->getNumberOfStates(), storm::utility::zero<ValueType>());
+            }
+            // The helpers expect that the hint specifies exactly zero or one for all non-maybe states.
+            storm::utility::vector::setVectorValues(resultHint, ~qualitativeInfo.maybeStates, storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(resultHint, qualitativeInfo.statesWithProbability1, storm::utility::one<ValueType>());
+            hint->setResultHint(std::move(resultHint));
+            hint->setMaybeStates(qualitativeInfo.maybeStates);
+            hint->setComputeOnlyMaybeStates(true);
+            hint->setNoEndComponentsInMaybeStates(qualitativeInfo.noEndComponentsInMaybeStates);
+            pathFormulaTask.setHint(hint);
+            if (hasCachedInformation) {
+                ++numberOfCacheHits;
+            }
+
+            typename detail::SessionModelChecker<SparseModelType>::type modelChecker(*model);
+            std::unique_ptr<CheckResult> quantitativeResult = modelChecker.computeProbabilities(env, pathFormulaTask);
+
+            // Results of qualitative checks only distinguish zero, one and the remaining values and are thus not stored.
+            if (!checkTask.isQualitativeSet()) {
+                solutions[key] = quantitativeResult->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+            }
+
+            if (operatorFormula.hasQuantitativeResult()) {
+                return quantitativeResult;
+            } else {
+                return quantitativeResult->template asExplicitQuantitativeCheckResult<ValueType>().compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ValueType>());
+            }
+        }
+
+        template<typename SparseModelType>
+        std::unique_ptr<CheckResult> SparseVerificationSession<SparseModelType>::checkReachabilityRewardFormula(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask) {
+            storm::logic::RewardOperatorFormula const& operatorFormula = checkTask.getFormula().asRewardOperatorFormula();
+            auto pathFormulaTask = checkTask.substituteFormula(operatorFormula.getSubformula()).setOnlyInitialStatesRelevant(false);
+            std::string key = getCacheKey(checkTask);
+
+            // Since reward values may change without changing the structure of the model, we only use previous solutions
+            // as starting point for the solvers.
+            auto solutionIt = solutions.find(key);
+            if (solutionIt != solutions.end()) {
+                auto hint = std::make_shared<ExplicitModelCheckerHint<ValueType>>();
+                hint->setResultHint(solutionIt->second);
+                hint->setComputeOnlyMaybeStates(false);
+                hint->setNoEndComponentsInMaybeStates(false);
+                pathFormulaTask.setHint(hint);
+                ++numberOfCacheHits;
+            }
+
+            typename detail::SessionModelChecker<SparseModelType>::type modelChecker(*model);
+            std::unique_ptr<CheckResult> quantitativeResult = modelChecker.computeRewards(env, operatorFormula.getMeasureType(), pathFormulaTask);
+
+            if (!checkTask.isQualitativeSet()) {
+                solutions[key] = quantitativeResult->template asExplicitQuantitativeCheckResult<ValueType>().getValueVector();
+            }
+
+            if (operatorFormula.hasQuantitativeResult()) {
+                return quantitativeResult;
+            } else {
+                return quantitativeResult->template asExplicitQuantitativeCheckResult<ValueType>().compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ValueType>());
+            }
+        }
+
+        template<typename SparseModelType>
+        typename SparseVerificationSession<SparseModelType>::QualitativeInformation const& SparseVerificationSession<SparseModelType>::getQualitativeInformation(Environment const& env, std::string const& key, CheckTask<storm::logic::Formula, ValueType> const& pathFormulaTask) {
+            auto infoIt = qualitativeInformation.find(key);
+            if (infoIt != qualitativeInformation.end()) {
+                return infoIt->second;
+            }
+
+            typename detail::SessionModelChecker<SparseModelType>::type modelChecker(*model);
+            storm::logic::Formula const& pathFormula = pathFormulaTask.getFormula();
+            storm::storage::BitVector phiStates, psiStates;
+            if (pathFormula.isUntilFormula()) {
+                phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                phiStates = storm::storage::BitVector(model->getNumberOfStates(), true);
+                psiStates = modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+
+            storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model->getTransitionMatrix();
+            std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+            QualitativeInformation info;
+            if (model->isNondeterministicModel()) {
+                STORM_LOG_THROW(pathFormulaTask.isOptimizationDirectionSet(), storm::exceptions::InvalidArgumentException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+                if (storm::solver::minimize(pathFormulaTask.getOptimizationDirection())) {
+                    statesWithProbability01 = storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), phiStates, psiStates);
+                } else {
+                    statesWithProbability01 = storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), phiStates, psiStates);
+                }
+                info.maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+                // When minimizing, end components within the maybe states would have been identified as prob0 states.
+                info.noEndComponentsInMaybeStates = storm::solver::minimize(pathFormulaTask.getOptimizationDirection()) || storm::utility::graph::performProb1A(transitionMatrix, transitionMatrix.getRowGroupIndices(), getBackwardTransitions(), info.maybeStates, ~info.maybeStates).full();
+            } else {
+                statesWithProbability01 = storm::utility::graph::performProb01(getBackwardTransitions(), phiStates, psiStates);
+                info.maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+                info.noEndComponentsInMaybeStates = true;
+            }
+            info.statesWithProbability1 = std::move(statesWithProbability01.second);
+
+            return qualitativeInformation.emplace(key, std::move(info)).first->second;
+        }
+
+        template<typename SparseModelType>
+        storm::storage::SparseMatrix<typename SparseModelType::ValueType> const& SparseVerificationSession<SparseModelType>::getBackwardTransitions() {
+            if (!backwardTransitions) {
+                backwardTransitions = model->getBackwardTransitions();
+            }
+            return backwardTransitions.get();
+        }
+
+        template<typename SparseModelType>
+        std::string SparseVerificationSession<SparseModelType>::getCacheKey(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+            storm::logic::OperatorFormula const& operatorFormula = checkTask.getFormula().asOperatorFormula();
+            std::stringstream stream;
+            if (operatorFormula.isRewardOperatorFormula()) {
+                stream << "R{\"" << (checkTask.isRewardModelSet() ? checkTask.getRewardModel() : "") << "\"}";
+            } else {
+                stream << "P";
+            }
+            // For deterministic models, the optimization direction is only derived from the bound and thus irrelevant.
+            if (model->isNondeterministicModel() && checkTask.isOptimizationDirectionSet()) {
+                stream << (storm::solver::minimize(checkTask.getOptimizationDirection()) ? "min" : "max");
+            }
+            stream << " [" << operatorFormula.getSubformula() << "]";
+            return stream.str();
+        }
+
+        template<typename SparseModelType>
+        uint_fast64_t SparseVerificationSession<SparseModelType>::getNumberOfCacheHits() const {
+            return numberOfCacheHits;
+        }
+
+        template class SparseVerificationSession<storm::models::sparse::Dtmc<double>>;
+        template class SparseVerificationSession<storm::models::sparse::Mdp<double>>;
+#ifdef STORM_HAVE_CARL
+        template class SparseVerificationSession<storm::models::sparse::Dtmc<storm::RationalNumber>>;
+        template class SparseVerificationSession<storm::models::sparse::Mdp<storm::RationalNumber>>;
+#endif
+    }
+}
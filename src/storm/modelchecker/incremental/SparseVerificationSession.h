@@ -0,0 +1,99 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+
+        /*!
+         * A session that checks several properties on the same (sparse) model and reuses information obtained by
+         * previous checks. In particular, the qualitative state sets (prob0/prob1 states) of unbounded reachability
+         * properties are computed only once and previous solution vectors are used as starting point for the solvers.
+         *
+         * The model can be exchanged (e.g. after changing the value of some constants). If the new model has the same
+         * structure (i.e. the same transition graph and state labeling), the qualitative information is kept and the
+         * previous solutions are used for warm-starting the solvers. Otherwise, all cached information is dropped.
+         */
+        template<typename SparseModelType>
+        class SparseVerificationSession {
+        public:
+            typedef typename SparseModelType::ValueType ValueType;
+
+            explicit SparseVerificationSession(std::shared_ptr<SparseModelType> const& model);
+
+            /*!
+             * Retrieves the model that is currently considered in this session.
+             */
+            std::shared_ptr<SparseModelType> const& getModel() const;
+
+            /*!
+             * Replaces the model of this session.
+             *
+             * @param newModel The new model.
+             * @return True iff the new model has the same structure as the old one and therefore the cached information
+             * is kept.
+             */
+            bool updateModel(std::shared_ptr<SparseModelType> const& newModel);
+
+            /*!
+             * Drops all cached information.
+             */
+            void clearCache();
+
+            /*!
+             * Checks the given task on the current model, exploiting (and extending) the cached information.
+             */
+            std::unique_ptr<CheckResult> check(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            std::unique_ptr<CheckResult> check(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+            /*!
+             * Retrieves the number of checks that could reuse qualitative information or solutions of earlier checks.
+             */
+            uint_fast64_t getNumberOfCacheHits() const;
+
+        private:
+            struct QualitativeInformation {
+                storm::storage::BitVector maybeStates;
+                storm::storage::BitVector statesWithProbability1;
+                bool noEndComponentsInMaybeStates;
+            };
+
+            std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+            std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask);
+
+            QualitativeInformation const& getQualitativeInformation(Environment const& env, std::string const& key, CheckTask<storm::logic::Formula, ValueType> const& pathFormulaTask);
+            storm::storage::SparseMatrix<ValueType> const& getBackwardTransitions();
+
+            /*!
+             * Builds an identifier of the quantity that is computed for the given (operator) formula.
+             */
+            std::string getCacheKey(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const;
+
+            // The model considered in this session.
+            std::shared_ptr<SparseModelType> model;
+
+            // The backward transitions of the model (if already computed).
+            boost::optional<storm::storage::SparseMatrix<ValueType>> backwardTransitions;
+
+            // The qualitative information for unbounded reachability probabilities.
+            std::map<std::string, QualitativeInformation> qualitativeInformation;
+
+            // The solutions of previous checks.
+            std::map<std::string, std::vector<ValueType>> solutions;
+
+            uint_fast64_t numberOfCacheHits;
+        };
+
+    }
+}
@@ -9,6 +9,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
@@ -30,6 +31,19 @@ namespace storm {
     namespace modelchecker {
         namespace helper {
 
+            /*!
+             * Creates a linear equation solver for the given explicit matrix (as obtained from the cache of the model).
+             * If the matrix is cached, the solver refers to it, so the given pointer has to be kept alive as long as the
+             * solver is used. Otherwise, the solver takes over the matrix.
+             */
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> createLinearEquationSolver(Environment const& env, storm::solver::LinearEquationSolverFactory<ValueType> const& factory, storm::models::symbolic::Model<DdType, ValueType> const& model, std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>& explicitMatrix) {
+                if (model.getExplicitRepresentationCache().isCached(explicitMatrix)) {
+                    return factory.create(env, *explicitMatrix);
+                }
+                return factory.create(env, model.getExplicitRepresentationCache().releaseMatrix(std::move(explicitMatrix)));
+            }
+
             template<storm::dd::DdType DdType, typename ValueType>
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeUntilProbabilities(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& phiStates, storm::dd::Bdd<DdType> const& psiStates, bool qualitative) {
                 // We need to identify the states which have to be taken out of the matrix, i.e. all states that have
@@ -51,7 +65,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = maybeStates.createOdd();
+                        storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(maybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -89,12 +103,12 @@ namespace storm {
                         
                         // Translate the symbolic matrix/vector to their explicit representations and solve the equation system.
                         conversionWatch.start();
-                        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getExplicitRepresentationCache().getMatrix(submatrix, maybeStates, [&submatrix, &odd] () { return submatrix.toMatrix(odd, odd); });
                         std::vector<ValueType> b = subvector.toVector(odd);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
                         
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = createLinearEquationSolver(env, linearEquationSolverFactory, model, explicitSubmatrix);
                         solver->setBounds(storm::utility::zero<ValueType>(), storm::utility::one<ValueType>());
                         solver->solveEquations(env, x, b);
                         
@@ -134,7 +148,7 @@ namespace storm {
                     
                     // Create the ODD for the translation between symbolic and explicit storage.
                     conversionWatch.start();
-                    storm::dd::Odd odd = maybeStates.createOdd();
+                    storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(maybeStates);
                     conversionWatch.stop();
                     
                     // Create the matrix and the vector for the equation system.
@@ -157,12 +171,12 @@ namespace storm {
                     
                     // Translate the symbolic matrix/vector to their explicit representations.
                     conversionWatch.start();
-                    storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getExplicitRepresentationCache().getMatrix(submatrix, maybeStates, [&submatrix, &odd] () { return submatrix.toMatrix(odd, odd); });
                     std::vector<ValueType> b = subvector.toVector(odd);
                     conversionWatch.stop();
                     STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitSubmatrix);
+                    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitSubmatrix);
                     multiplier->repeatedMultiply(env, x, &b, stepBound);
 
                     // Return a hybrid check result that stores the numerical values explicitly.
@@ -180,18 +194,18 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 
                 // Create the solution vector (and initialize it to the state rewards of the model).
                 std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
                 
                 // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getExplicitRepresentationCache().getMatrix(transitionMatrix, model.getReachableStates(), [&transitionMatrix, &odd] () { return transitionMatrix.toMatrix(odd, odd); });
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiply(env, x, nullptr, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -212,16 +226,16 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 
                 // Translate the symbolic matrix/vector to their explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getExplicitRepresentationCache().getMatrix(transitionMatrix, model.getReachableStates(), [&transitionMatrix, &odd] () { return transitionMatrix.toMatrix(odd, odd); });
                 std::vector<ValueType> b = totalRewardVector.toVector(odd);
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiply(env, x, &b, stepBound);
                 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -266,7 +280,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = maybeStates.createOdd();
+                        storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(maybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -309,7 +323,7 @@ namespace storm {
                         
                         // Translate the symbolic matrix/vector to their explicit representations.
                         conversionWatch.start();
-                        storm::storage::SparseMatrix<ValueType> explicitSubmatrix = submatrix.toMatrix(odd, odd);
+                        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitSubmatrix = model.getExplicitRepresentationCache().getMatrix(submatrix, maybeStates, [&submatrix, &odd] () { return submatrix.toMatrix(odd, odd); });
                         std::vector<ValueType> b = subvector.toVector(odd);
                         conversionWatch.stop();
                         STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
@@ -319,11 +333,11 @@ namespace storm {
                         if (oneStepTargetProbs) {
                             // FIXME: This will fail if we already converted the matrix to the equation problem format.
                             STORM_LOG_ASSERT(!convertToEquationSystem, "Upper reward bounds required, but the matrix is in the wrong format for the computation.");
-                            upperBounds = computeUpperRewardBounds(explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
+                            upperBounds = computeUpperRewardBounds(*explicitSubmatrix, b, oneStepTargetProbs->toVector(odd));
                         }
                         
                         // Now solve the resulting equation system.
-                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = linearEquationSolverFactory.create(env, std::move(explicitSubmatrix));
+                        std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver = createLinearEquationSolver(env, linearEquationSolverFactory, model, explicitSubmatrix);
                         solver->setLowerBound(storm::utility::zero<ValueType>());
                         if (upperBounds) {
                             solver->setUpperBounds(std::move(upperBounds.get()));
@@ -342,12 +356,12 @@ namespace storm {
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeLongRunAverageProbabilities(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& targetStates) {
                 // Create ODD for the translation.
                 storm::utility::Stopwatch conversionWatch(true);
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
-                storm::storage::SparseMatrix<ValueType> explicitProbabilityMatrix = model.getTransitionMatrix().toMatrix(odd, odd);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitProbabilityMatrix = model.getExplicitRepresentationCache().getMatrix(model.getTransitionMatrix(), model.getReachableStates(), [&model, &odd] () { return model.getTransitionMatrix().toMatrix(odd, odd); });
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(), explicitProbabilityMatrix, targetStates.toVector(odd));
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(), *explicitProbabilityMatrix, targetStates.toVector(odd));
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
 
@@ -355,12 +369,12 @@ namespace storm {
             std::unique_ptr<CheckResult> HybridDtmcPrctlHelper<DdType, ValueType>::computeLongRunAverageRewards(Environment const& env, storm::models::symbolic::Model<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, RewardModelType const& rewardModel) {
                 // Create ODD for the translation.
                 storm::utility::Stopwatch conversionWatch(true);
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
-                storm::storage::SparseMatrix<ValueType> explicitProbabilityMatrix = model.getTransitionMatrix().toMatrix(odd, odd);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitProbabilityMatrix = model.getExplicitRepresentationCache().getMatrix(model.getTransitionMatrix(), model.getReachableStates(), [&model, &odd] () { return model.getTransitionMatrix().toMatrix(odd, odd); });
                 conversionWatch.stop();
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
-                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(), explicitProbabilityMatrix, rewardModel.getTotalRewardVector(model.getTransitionMatrix(), model.getColumnVariables()).toVector(odd));
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseDtmcPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(), *explicitProbabilityMatrix, rewardModel.getTotalRewardVector(model.getTransitionMatrix(), model.getColumnVariables()).toVector(odd));
                 return std::unique_ptr<CheckResult>(new HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
             }
             
@@ -1,17 +1,20 @@
 #include "storm/modelchecker/prctl/helper/HybridMdpPrctlHelper.h"
 
 #include "storm/modelchecker/prctl/helper/SymbolicMdpPrctlHelper.h"
+#include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Odd.h"
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
 #include "storm/storage/MaximalEndComponentDecomposition.h"
 
 #include "storm/utility/graph.h"
 #include "storm/utility/constants.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/modelchecker/prctl/helper/SparseMdpEndComponentInformation.h"
 #include "storm/modelchecker/prctl/helper/DsMpiUpperRewardBoundsComputer.h"
@@ -22,6 +25,7 @@
 
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
+#include "storm/solver/SolveGoal.h"
 
 #include "storm/utility/Stopwatch.h"
 
@@ -180,7 +184,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = extendedMaybeStates.createOdd();
+                        storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(extendedMaybeStates);
                         conversionWatch.stop();
                         
                         // Convert the maybe states BDD to an ADD.
@@ -259,7 +263,7 @@ namespace storm {
 
                         // If we extended the maybe states, we create a new ODD containing only the propery maybe states.
                         if (extendMaybeStates) {
-                            odd = maybeStates.createOdd();
+                            odd = model.getExplicitRepresentationCache().getOdd(maybeStates);
                         }
                         
                         // Return a hybrid check result that stores the numerical values explicitly.
@@ -302,7 +306,7 @@ namespace storm {
                     
                     // Create the ODD for the translation between symbolic and explicit storage.
                     conversionWatch.start();
-                    storm::dd::Odd odd = maybeStates.createOdd();
+                    storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(maybeStates);
                     conversionWatch.stop();
                     
                     // Create the matrix and the vector for the equation system.
@@ -347,10 +351,10 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch;
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 
                 // Translate the symbolic matrix to its explicit representations.
-                storm::storage::SparseMatrix<ValueType> explicitMatrix = transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd);
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix = model.getExplicitRepresentationCache().getMatrix(transitionMatrix, model.getReachableStates(), [&model, &transitionMatrix, &odd] () { return transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd); });
                 
                 // Create the solution vector (and initialize it to the state rewards of the model).
                 std::vector<ValueType> x = rewardModel.getStateRewardVector().toVector(odd);
@@ -358,7 +362,7 @@ namespace storm {
                 STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
 
                 // Perform the matrix-vector multiplication.
-                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, explicitMatrix);
+                auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, *explicitMatrix);
                 multiplier->repeatedMultiplyAndReduce(env, dir, x, nullptr, stepBound);
 
                 // Return a hybrid check result that stores the numerical values explicitly.
@@ -379,7 +383,7 @@ namespace storm {
                 storm::utility::Stopwatch conversionWatch(true);
                 
                 // Create the ODD for the translation between symbolic and explicit storage.
-                storm::dd::Odd odd = model.getReachableStates().createOdd();
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
                 
                 // Translate the symbolic matrix/vector to their explicit representations.
                 std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = transitionMatrix.toMatrixVector(totalRewardVector, model.getNondeterminismVariables(), odd, odd);
@@ -576,7 +580,7 @@ namespace storm {
                         
                         // Create the ODD for the translation between symbolic and explicit storage.
                         conversionWatch.start();
-                        storm::dd::Odd odd = requiredMaybeStates.createOdd();
+                        storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(requiredMaybeStates);
                         conversionWatch.stop();
                         
                         // Create the matrix and the vector for the equation system.
@@ -665,7 +669,7 @@ namespace storm {
 
                         // If we extended the maybe states, we create a new ODD that only contains proper maybe states.
                         if (extendMaybeStates) {
-                            odd = maybeStates.createOdd();
+                            odd = model.getExplicitRepresentationCache().getOdd(maybeStates);
                         }
 
                         // Return a hybrid check result that stores the numerical values explicitly.
@@ -676,6 +680,44 @@ namespace storm {
                 }
             }
             
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeLongRunAverageProbabilities(Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, storm::dd::Bdd<DdType> const& psiStates) {
+                // If there are no goal states or all states are goal states, the result is known without any computation.
+                if (psiStates.isZero() || (model.getReachableStates() && !psiStates).isZero()) {
+                    return std::unique_ptr<CheckResult>(new storm::modelchecker::SymbolicQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), psiStates.template toAdd<ValueType>()));
+                }
+                
+                // Since the end components of the whole model need to be analyzed, the full model is translated.
+                storm::utility::Stopwatch conversionWatch(true);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitTransitionMatrix = model.getExplicitRepresentationCache().getMatrix(transitionMatrix, model.getReachableStates(), [&model, &transitionMatrix, &odd] () { return transitionMatrix.toMatrix(model.getNondeterminismVariables(), odd, odd); });
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converting symbolic matrix to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeLongRunAverageProbabilities(env, storm::solver::SolveGoal<ValueType>(dir), *explicitTransitionMatrix, explicitTransitionMatrix->transpose(true), psiStates.toVector(odd));
+                
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
+            }
+            
+            template<storm::dd::DdType DdType, typename ValueType>
+            std::unique_ptr<CheckResult> HybridMdpPrctlHelper<DdType, ValueType>::computeLongRunAverageRewards(Environment const& env, OptimizationDirection dir, storm::models::symbolic::NondeterministicModel<DdType, ValueType> const& model, storm::dd::Add<DdType, ValueType> const& transitionMatrix, RewardModelType const& rewardModel) {
+                STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Missing reward model for formula. Skipping formula.");
+                
+                // In an MDP, all rewards are earned when taking a choice, so we can collect them in a single vector over the choices.
+                storm::dd::Add<DdType, ValueType> totalRewardVector = rewardModel.getTotalRewardVector(transitionMatrix, model.getColumnVariables());
+                
+                storm::utility::Stopwatch conversionWatch(true);
+                storm::dd::Odd odd = model.getExplicitRepresentationCache().getOdd(model.getReachableStates());
+                std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<ValueType>> explicitRepresentation = transitionMatrix.toMatrixVector(totalRewardVector, model.getNondeterminismVariables(), odd, odd);
+                conversionWatch.stop();
+                STORM_LOG_INFO("Converting symbolic matrix/vector to explicit representation done in " << conversionWatch.getTimeInMilliseconds() << "ms.");
+                
+                storm::models::sparse::StandardRewardModel<ValueType> explicitRewardModel(boost::none, std::move(explicitRepresentation.second));
+                std::vector<ValueType> result = storm::modelchecker::helper::SparseMdpPrctlHelper<ValueType>::computeLongRunAverageRewards(env, storm::solver::SolveGoal<ValueType>(dir), explicitRepresentation.first, explicitRepresentation.first.transpose(true), explicitRewardModel);
+                
+                return std::unique_ptr<CheckResult>(new storm::modelchecker::HybridQuantitativeCheckResult<DdType, ValueType>(model.getReachableStates(), model.getManager().getBddZero(), model.getManager().template getAddZero<ValueType>(), model.getReachableStates(), std::move(odd), std::move(result)));
+            }
+            
             template class HybridMdpPrctlHelper<storm::dd::DdType::CUDD, double>;
             template class HybridMdpPrctlHelper<storm::dd::DdType::Sylvan, double>;
 
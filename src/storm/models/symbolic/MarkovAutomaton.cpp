@@ -89,7 +89,7 @@ namespace storm {
             
             template<storm::dd::DdType Type, typename ValueType>
             storm::dd::Bdd<Type> const& MarkovAutomaton<Type, ValueType>::getProbabilisticStates() const {
-                return this->markovianStates;
+                return this->probabilisticStates;
             }
             
             template<storm::dd::DdType Type, typename ValueType>
@@ -104,8 +104,12 @@ namespace storm {
             
             template<storm::dd::DdType Type, typename ValueType>
             MarkovAutomaton<Type, ValueType> MarkovAutomaton<Type, ValueType>::close() {
+                // The stored transition matrix is normalized, but the constructor expects the rates of the Markovian
+                // choices, so we restore them first.
+                storm::dd::Add<Type, ValueType> rateMatrix = this->getTransitionMatrix() * this->markovianChoices.ite(this->exitRateVector, this->getManager().template getAddOne<ValueType>());
+                
                 // Create the new transition matrix by deleting all Markovian transitions from probabilistic states.
-                storm::dd::Add<Type, ValueType> newTransitionMatrix = this->probabilisticStates.ite(this->getTransitionMatrix() * (!this->getMarkovianMarker()).template toAdd<ValueType>(), this->getTransitionMatrix());
+                storm::dd::Add<Type, ValueType> newTransitionMatrix = this->probabilisticStates.ite(rateMatrix * (!this->getMarkovianMarker()).template toAdd<ValueType>(), rateMatrix);
                 
                 return MarkovAutomaton<Type, ValueType>(this->getManagerAsSharedPointer(), this->getMarkovianMarker(), this->getReachableStates(), this->getInitialStates(), this->getDeadlockStates(), newTransitionMatrix, this->getRowVariables(), this->getRowExpressionAdapter(), this->getColumnVariables(), this->getRowColumnMetaVariablePairs(), this->getNondeterminismVariables(), this->getLabelToExpressionMap(), this->getRewardModels());
             }
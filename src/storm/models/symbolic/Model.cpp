@@ -12,6 +12,9 @@
 
 #include "storm/adapters/AddExpressionAdapter.h"
 
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
+
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/utility/macros.h"
@@ -209,6 +212,7 @@ namespace storm {
             template<storm::dd::DdType Type, typename ValueType>
             void Model<Type, ValueType>::setTransitionMatrix(storm::dd::Add<Type, ValueType> const& transitionMatrix) {
                 this->transitionMatrix = transitionMatrix;
+                this->partitionedTransitionRelation.reset();
             }
             
             template<storm::dd::DdType Type, typename ValueType>
@@ -382,6 +386,32 @@ namespace storm {
                 return parameters;
             }
             
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::ExplicitRepresentationCache<Type, ValueType>& Model<Type, ValueType>::getExplicitRepresentationCache() const {
+                if (!explicitRepresentationCache) {
+                    explicitRepresentationCache = std::make_shared<storm::dd::ExplicitRepresentationCache<Type, ValueType>>();
+                }
+                return *explicitRepresentationCache;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            void Model<Type, ValueType>::setPartitionedTransitionRelation(std::shared_ptr<storm::dd::PartitionedTransitionRelation<Type> const> const& partitionedTransitionRelation) {
+                STORM_LOG_ASSERT(partitionedTransitionRelation->represents(this->getQualitativeTransitionMatrix()), "The partitioned transition relation was created for another transition matrix.");
+                STORM_LOG_ASSERT(partitionedTransitionRelation->toBdd() == this->getQualitativeTransitionMatrix(false), "The partitions do not cover the transition matrix.");
+                this->partitionedTransitionRelation = partitionedTransitionRelation;
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            bool Model<Type, ValueType>::hasPartitionedTransitionRelation() const {
+                return static_cast<bool>(partitionedTransitionRelation);
+            }
+            
+            template<storm::dd::DdType Type, typename ValueType>
+            storm::dd::PartitionedTransitionRelation<Type> const& Model<Type, ValueType>::getPartitionedTransitionRelation() const {
+                STORM_LOG_THROW(this->hasPartitionedTransitionRelation(), storm::exceptions::InvalidOperationException, "The model does not have a partitioned transition relation.");
+                return *partitionedTransitionRelation;
+            }
+            
             template<storm::dd::DdType Type, typename ValueType>
             template<typename NewValueType>
             std::shared_ptr<Model<Type, NewValueType>> Model<Type, ValueType>::toValueType() const {
@@ -26,6 +26,12 @@ namespace storm {
         template<storm::dd::DdType Type>
         class DdManager;
         
+        template<storm::dd::DdType Type, typename ValueType>
+        class ExplicitRepresentationCache;
+        
+        template<storm::dd::DdType Type>
+        class PartitionedTransitionRelation;
+        
     }
     
     namespace adapters {
@@ -330,6 +336,35 @@ namespace storm {
                 template<typename NewValueType>
                 std::shared_ptr<Model<Type, NewValueType>> toValueType() const;
                 
+                /*!
+                 * Retrieves the cache for explicit representations (ODDs and matrices) of DDs of this model. This allows
+                 * to reuse explicit representations across several checks of the model, e.g. in the hybrid engine.
+                 *
+                 * @return The cache of explicit representations.
+                 */
+                storm::dd::ExplicitRepresentationCache<Type, ValueType>& getExplicitRepresentationCache() const;
+                
+                /*!
+                 * Sets a partitioned representation of the qualitative transition matrix of the model. If set, it is
+                 * used by graph analyses instead of the monolithic transition matrix.
+                 *
+                 * @param partitionedTransitionRelation The partitioned transition relation. It must represent the
+                 * qualitative transition matrix of the model.
+                 */
+                void setPartitionedTransitionRelation(std::shared_ptr<storm::dd::PartitionedTransitionRelation<Type> const> const& partitionedTransitionRelation);
+                
+                /*!
+                 * Retrieves whether the model has a partitioned representation of its transition relation.
+                 */
+                bool hasPartitionedTransitionRelation() const;
+                
+                /*!
+                 * Retrieves the partitioned representation of the transition relation of the model.
+                 *
+                 * @return The partitioned transition relation.
+                 */
+                storm::dd::PartitionedTransitionRelation<Type> const& getPartitionedTransitionRelation() const;
+                
             protected:
                 /*!
                  * Sets the transition matrix of the model.
@@ -428,6 +463,13 @@ namespace storm {
                 
                 // An empty variable set that can be used when references to non-existing sets need to be returned.
                 std::set<storm::expressions::Variable> emptyVariableSet;
+                
+                // A cache for explicit representations of DDs of this model (created on demand). Note that it needs to
+                // be destroyed before the manager, because it holds references to DDs.
+                mutable std::shared_ptr<storm::dd::ExplicitRepresentationCache<Type, ValueType>> explicitRepresentationCache;
+                
+                // If set, a partitioned representation of the qualitative transition matrix.
+                std::shared_ptr<storm::dd::PartitionedTransitionRelation<Type> const> partitionedTransitionRelation;
             };
             
         } // namespace symbolic
@@ -22,6 +22,9 @@ namespace storm {
             const std::string BisimulationSettings::initialPartitionOptionName = "init";
             const std::string BisimulationSettings::refinementModeOptionName = "refine";
             const std::string BisimulationSettings::exactArithmeticDdOptionName = "ddexact";
+            const std::string BisimulationSettings::sparseRefinementMethodOptionName = "sparserefine";
+            const std::string BisimulationSettings::blockGroupsOptionName = "blockgroups";
+            const std::string BisimulationSettings::refinementStatisticsOptionName = "stats";
             
             BisimulationSettings::BisimulationSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> types = { "strong", "weak" };
@@ -54,6 +57,18 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("mode", "The mode to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(refinementModes))
                                              .setDefaultValueString("full").build())
                                 .build());
+                
+                std::vector<std::string> sparseRefinementMethods = {"splitter", "signature"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, sparseRefinementMethodOptionName, true, "Sets which partition refinement method to use for sparse models. The signature-based method refines all blocks simultaneously and runs in parallel if Intel TBB is available.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("method", "The method to use.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(sparseRefinementMethods))
+                                             .setDefaultValueString("splitter").build())
+                                .build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, blockGroupsOptionName, true, "Sets the number of groups of blocks whose signatures are computed separately (only applies to DD-based bisimulation). With sylvan, the signatures of the groups are computed in parallel. Ignored for refinement mode 'changed'.")
+                                .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of groups (rounded down to a power of two).").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                             .setDefaultValueUnsignedInteger(1).build())
+                                .build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, refinementStatisticsOptionName, true, "Sets whether to show statistics (signature sizes, new blocks, time) for every refinement step (only applies to DD-based bisimulation).").build());
             }
             
             bool BisimulationSettings::isStrongBisimulationSet() const {
@@ -130,9 +145,26 @@ namespace storm {
                 return RefinementMode::Full;
             }
 
+            storm::storage::SparseRefinementMethod BisimulationSettings::getSparseRefinementMethod() const {
+                std::string methodAsString = this->getOption(sparseRefinementMethodOptionName).getArgumentByName("method").getValueAsString();
+                if (methodAsString == "signature") {
+                    return storm::storage::SparseRefinementMethod::Signature;
+                }
+                return storm::storage::SparseRefinementMethod::Splitter;
+            }
+            
+            uint64_t BisimulationSettings::getNumberOfBlockGroups() const {
+                return this->getOption(blockGroupsOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
+            
+            bool BisimulationSettings::isShowRefinementStatisticsSet() const {
+                return this->getOption(refinementStatisticsOptionName).getHasOptionBeenSet();
+            }
+            
             bool BisimulationSettings::check() const {
                 bool optionsSet = this->getOption(typeOptionName).getHasOptionBeenSet();
                 STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::GeneralSettings>().isBisimulationSet() || !optionsSet, "Bisimulation minimization is not selected, so setting options for bisimulation has no effect.");
+                STORM_LOG_WARN_COND(this->getNumberOfBlockGroups() == 1 || this->getRefinementMode() != RefinementMode::ChangedStates, "Grouping blocks is not supported for refinement mode 'changed' and is therefore ignored.");
                 return true;
             }
         } // namespace modules
@@ -4,6 +4,7 @@
 #include "storm/settings/modules/ModuleSettings.h"
 
 #include "storm/storage/dd/bisimulation/SignatureMode.h"
+#include "storm/storage/bisimulation/BisimulationType.h"
 
 namespace storm {
     namespace settings {
@@ -89,6 +90,24 @@ namespace storm {
                  * Retrieves the refinement mode to use.
                  */
                 RefinementMode getRefinementMode() const;
+                
+                /*!
+                 * Retrieves the partition refinement method to use for sparse models.
+                 * NOTE: only applies to sparse bisimulation.
+                 */
+                storm::storage::SparseRefinementMethod getSparseRefinementMethod() const;
+                
+                /*!
+                 * Retrieves the number of groups of blocks whose signatures are computed and refined separately.
+                 * NOTE: only applies to DD-based bisimulation.
+                 */
+                uint64_t getNumberOfBlockGroups() const;
+                
+                /*!
+                 * Retrieves whether statistics are to be shown for every refinement step.
+                 * NOTE: only applies to DD-based bisimulation.
+                 */
+                bool isShowRefinementStatisticsSet() const;
                                 
                 virtual bool check() const override;
                 
@@ -107,6 +126,9 @@ namespace storm {
                 static const std::string refinementModeOptionName;
                 static const std::string parallelismModeOptionName;
                 static const std::string exactArithmeticDdOptionName;
+                static const std::string sparseRefinementMethodOptionName;
+                static const std::string blockGroupsOptionName;
+                static const std::string refinementStatisticsOptionName;
             };
         } // namespace modules
     } // namespace settings
@@ -29,6 +29,15 @@ namespace storm {
             const std::string fullModelBuildOptionName = "buildfull";
             const std::string buildChoiceLabelOptionName = "buildchoicelab";
             const std::string buildStateValuationsOptionName = "buildstateval";
+            const std::string ddVariableOrderingOptionName = "ddorder";
+            const std::string ddReachabilityStrategyOptionName = "ddreach";
+            const std::string ddPartitionOptionName = "ddpartition";
+            const std::string bytecodeOptionName = "bytecode";
+            const std::string symmetryReductionOptionName = "symmetry";
+            const std::string partialOrderReductionOptionName = "por";
+            const std::string prob01PruningOptionName = "prob01prune";
+            const std::string spillDirectoryOptionName = "spilldir";
+            const std::string spillThresholdOptionName = "spillthreshold";
             BuildSettings::BuildSettings() : ModuleSettings(moduleName) {
 
                 std::vector<std::string> explorationOrders = {"dfs", "bfs"};
@@ -41,6 +50,21 @@ namespace storm {
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationOrderOptionName, false, "Sets which exploration order to use.").setShortName(explorationOrderOptionShortName)
                                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the exploration order to choose.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(explorationOrders)).setDefaultValueString("bfs").build()).build());
+                std::vector<std::string> ddVariableOrderings = {"declaration", "force", "moduleforce"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddVariableOrderingOptionName, false, "Sets the heuristic that determines the static order of the DD variables when building symbolic models.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the heuristic. 'declaration': order of declaration, 'force': variables that are used together are placed close to each other, 'moduleforce': like 'force', but the variables of a module are kept together.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddVariableOrderings)).setDefaultValueString("declaration").build()).build());
+                std::vector<std::string> ddReachabilityStrategies = {"bfs", "chaining"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddReachabilityStrategyOptionName, false, "Sets how the reachable states are computed when building symbolic models.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the strategy. 'bfs': breadth-first search over the monolithic transition relation, 'chaining': the transition relations of the individual actions are applied one after the other.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(ddReachabilityStrategies)).setDefaultValueString("bfs").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, ddPartitionOptionName, false, "If set, symbolic models keep their transition relation partitioned by action, which is used by the graph analyses.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, bytecodeOptionName, false, "If set, the explicit model builder evaluates guards, updates and probabilities with expressions compiled to bytecode instead of the generic expression evaluator.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, symmetryReductionOptionName, false, "If set, the explicit model builder merges states that only differ by a permutation of fully symmetric processes (PRISM modules obtained by renaming). Labels and rewards must be symmetric.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, partialOrderReductionOptionName, false, "If set, the explicit model builder only explores one interleaving of independent local commands when building MDPs. This preserves the probabilities of properties over the labels of the model that do not use the next operator, but not rewards.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, prob01PruningOptionName, false, "If set, the explicit model builder finds the states with probability zero or one for the property during the exploration and does not expand states that only such states reach. Only the results for the initial states are preserved.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, spillDirectoryOptionName, false, "If set, the explicit model builder holds the states it found in a memory-mapped temporary file that the operating system can move out of memory, while their indices stay in memory. Also, it keeps only a bounded number of the states that are still to be explored in memory and writes the others to a temporary file, which requires breadth-first exploration.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The directory in which to create the temporary files.").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, spillThresholdOptionName, false, "Sets how many of the states that are still to be explored the explicit model builder keeps in memory if states are written to disk.")
+                                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("count", "The number of states.").addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(1)).setDefaultValueUnsignedInteger(1000000).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, explorationChecksOptionName, false, "If set, additional checks (if available) are performed during model exploration to debug the model.").setShortName(explorationChecksOptionShortName).build());
 
             }
@@ -85,9 +109,63 @@ namespace storm {
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown exploration order '" << explorationOrderAsString << "'.");
             }
 
+            storm::builder::DdVariableOrdering BuildSettings::getDdVariableOrdering() const {
+                std::string orderingAsString = this->getOption(ddVariableOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (orderingAsString == "declaration") {
+                    return storm::builder::DdVariableOrdering::Declaration;
+                } else if (orderingAsString == "force") {
+                    return storm::builder::DdVariableOrdering::Force;
+                } else if (orderingAsString == "moduleforce") {
+                    return storm::builder::DdVariableOrdering::ModuleForce;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD variable ordering '" << orderingAsString << "'.");
+            }
+
+            storm::utility::dd::ReachabilityStrategy BuildSettings::getDdReachabilityStrategy() const {
+                std::string strategyAsString = this->getOption(ddReachabilityStrategyOptionName).getArgumentByName("name").getValueAsString();
+                if (strategyAsString == "bfs") {
+                    return storm::utility::dd::ReachabilityStrategy::Bfs;
+                } else if (strategyAsString == "chaining") {
+                    return storm::utility::dd::ReachabilityStrategy::Chaining;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown DD reachability strategy '" << strategyAsString << "'.");
+            }
+
+            bool BuildSettings::isDdPartitionSet() const {
+                return this->getOption(ddPartitionOptionName).getHasOptionBeenSet();
+            }
+
             bool BuildSettings::isExplorationChecksSet() const {
                 return this->getOption(explorationChecksOptionName).getHasOptionBeenSet();
             }
+
+            bool BuildSettings::isBytecodeSet() const {
+                return this->getOption(bytecodeOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isSymmetryReductionSet() const {
+                return this->getOption(symmetryReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isPartialOrderReductionSet() const {
+                return this->getOption(partialOrderReductionOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isProb01PruningSet() const {
+                return this->getOption(prob01PruningOptionName).getHasOptionBeenSet();
+            }
+
+            bool BuildSettings::isSpillDirectorySet() const {
+                return this->getOption(spillDirectoryOptionName).getHasOptionBeenSet();
+            }
+
+            std::string BuildSettings::getSpillDirectory() const {
+                return this->getOption(spillDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+
+            uint64_t BuildSettings::getSpillThreshold() const {
+                return this->getOption(spillThresholdOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+            }
         }
 
 
@@ -4,6 +4,8 @@
 #include "storm-config.h"
 #include "storm/settings/modules/ModuleSettings.h"
 #include "storm/builder/ExplorationOrder.h"
+#include "storm/builder/DdVariableOrdering.h"
+#include "storm/utility/dd.h"
 
 namespace storm {
     namespace settings {
@@ -75,6 +77,81 @@ namespace storm {
                  */
                 bool isBuildStateValuationsSet() const;
 
+                /*!
+                 * Retrieves the heuristic that is used to determine the static order of DD variables when building
+                 * symbolic models.
+                 *
+                 * @return The chosen heuristic.
+                 */
+                storm::builder::DdVariableOrdering getDdVariableOrdering() const;
+
+                /*!
+                 * Retrieves the strategy that is used to compute the reachable states when building symbolic models.
+                 *
+                 * @return The chosen strategy.
+                 */
+                storm::utility::dd::ReachabilityStrategy getDdReachabilityStrategy() const;
+
+                /*!
+                 * Retrieves whether symbolic models are to keep a partitioned representation of their transition relation.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isDdPartitionSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to evaluate expressions with compiled bytecode.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isBytecodeSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to merge states that are equal up to a permutation of
+                 * symmetric processes.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isSymmetryReductionSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to apply a partial-order reduction to MDPs.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isPartialOrderReductionSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to skip states that only states with probability
+                 * zero or one for the property reach.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isProb01PruningSet() const;
+
+                /*!
+                 * Retrieves whether the explicit model builder is to write the states that are still to be explored
+                 * to disk.
+                 *
+                 * @return True iff the option was set.
+                 */
+                bool isSpillDirectorySet() const;
+
+                /*!
+                 * Retrieves the directory in which the explicit model builder stores the states that are still to be
+                 * explored.
+                 *
+                 * @return The directory.
+                 */
+                std::string getSpillDirectory() const;
+
+                /*!
+                 * Retrieves how many of the states that are still to be explored are kept in memory if states are
+                 * written to disk.
+                 *
+                 * @return The number of states.
+                 */
+                uint64_t getSpillThreshold() const;
 
                 // The name of the module.
                 static const std::string moduleName;
@@ -21,6 +21,9 @@ namespace storm {
             const std::string JitBuilderSettings::carlIncludeDirectoryOptionName = "carl";
             const std::string JitBuilderSettings::compilerFlagsOptionName = "cxxflags";
             const std::string JitBuilderSettings::optimizationLevelOptionName = "opt";
+            const std::string JitBuilderSettings::precompiledHeaderOptionName = "pch";
+            const std::string JitBuilderSettings::modelCacheOptionName = "cache";
+            const std::string JitBuilderSettings::cacheDirectoryOptionName = "cachedir";
 
             JitBuilderSettings::JitBuilderSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, doctorOptionName, false, "Show debugging information on why the jit-based model builder is not working on your system.").build());
@@ -36,6 +39,10 @@ namespace storm {
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("flags", "The compiler flags.").build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, optimizationLevelOptionName, false, "Sets the optimization level.")
                                 .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("level", "The level to use.").setDefaultValueUnsignedInteger(3).build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, precompiledHeaderOptionName, false, "If set, the headers included by the generated code are precompiled once and reused in later runs.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, modelCacheOptionName, false, "If set, the compiled code of a model is stored and reused by later runs on the same model. As the values of the constants are compiled into the code, runs that only differ in these values do not share compiled code.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, cacheDirectoryOptionName, false, "The directory in which precompiled headers and compiled models are stored.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("dir", "The cache directory. Only the current user may access it. Defaults to storm/jit in $XDG_CACHE_HOME or $HOME/.cache.").build()).build());
             }
             
             bool JitBuilderSettings::isCompilerSet() const {
@@ -86,6 +93,22 @@ namespace storm {
                 return this->getOption(optimizationLevelOptionName).getArgumentByName("level").getValueAsUnsignedInteger();
             }
             
+            bool JitBuilderSettings::isPrecompiledHeaderSet() const {
+                return this->getOption(precompiledHeaderOptionName).getHasOptionBeenSet();
+            }
+            
+            bool JitBuilderSettings::isModelCacheSet() const {
+                return this->getOption(modelCacheOptionName).getHasOptionBeenSet();
+            }
+            
+            bool JitBuilderSettings::isCacheDirectorySet() const {
+                return this->getOption(cacheDirectoryOptionName).getHasOptionBeenSet();
+            }
+            
+            std::string JitBuilderSettings::getCacheDirectory() const {
+                return this->getOption(cacheDirectoryOptionName).getArgumentByName("dir").getValueAsString();
+            }
+            
             void JitBuilderSettings::finalize() {
                 // Intentionally left empty.
             }
@@ -32,6 +32,13 @@ namespace storm {
                 
                 uint64_t getOptimizationLevel() const;
                 
+                bool isPrecompiledHeaderSet() const;
+                
+                bool isModelCacheSet() const;
+                
+                bool isCacheDirectorySet() const;
+                std::string getCacheDirectory() const;
+                
                 bool check() const override;
                 void finalize() override;
                 
@@ -45,6 +52,9 @@ namespace storm {
                 static const std::string compilerFlagsOptionName;
                 static const std::string doctorOptionName;
                 static const std::string optimizationLevelOptionName;
+                static const std::string precompiledHeaderOptionName;
+                static const std::string modelCacheOptionName;
+                static const std::string cacheDirectoryOptionName;
             };
             
         }
@@ -22,6 +22,7 @@ namespace storm {
             const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
             const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
             const std::string MinMaxEquationSolverSettings::forceBoundsOptionName = "forcebounds";
+            const std::string MinMaxEquationSolverSettings::symbolicRoundingOptionName = "ddround";
 
             MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> minMaxSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration", "lp", "linear-programming", "rs", "ratsearch", "ii", "interval-iteration", "svi", "sound-value-iteration", "topological"};
@@ -49,6 +50,9 @@ namespace storm {
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, forceBoundsOptionName, false, "If set, minmax solver always require that a priori bounds for the solution are computed.").build());
                 
+                this->addOption(storm::settings::OptionBuilder(moduleName, symbolicRoundingOptionName, false, "If set, the values are rounded to multiples of the given granularity in each iteration of the dd engine, which bounds the number of distinct values in the DDs.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("granularity", "The granularity to which values are rounded.").addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
+                
             }
             
             storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -139,6 +143,14 @@ namespace storm {
             bool MinMaxEquationSolverSettings::isForceBoundsSet() const {
                 return this->getOption(forceBoundsOptionName).getHasOptionBeenSet();
             }
+            
+            bool MinMaxEquationSolverSettings::isSymbolicRoundingSet() const {
+                return this->getOption(symbolicRoundingOptionName).getHasOptionBeenSet();
+            }
+            
+            double MinMaxEquationSolverSettings::getSymbolicRoundingGranularity() const {
+                return this->getOption(symbolicRoundingOptionName).getArgumentByName("granularity").getValueAsDouble();
+            }
         }
     }
 }
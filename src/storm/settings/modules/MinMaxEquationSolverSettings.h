@@ -117,6 +117,18 @@ namespace storm {
                  */
                 bool isForceBoundsSet() const;
                 
+                /*!
+                 * Retrieves whether the values are to be rounded in each iteration of the dd engine.
+                 */
+                bool isSymbolicRoundingSet() const;
+                
+                /*!
+                 * Retrieves the granularity to which values are rounded in each iteration of the dd engine.
+                 *
+                 * @return The granularity.
+                 */
+                double getSymbolicRoundingGranularity() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -131,6 +143,7 @@ namespace storm {
                 static const std::string valueIterationMultiplicationStyleOptionName;
                 static const std::string intervalIterationSymmetricUpdatesOptionName;
                 static const std::string forceBoundsOptionName;
+                static const std::string symbolicRoundingOptionName;
             };
             
         }
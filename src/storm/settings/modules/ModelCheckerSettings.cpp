@@ -14,14 +14,20 @@ namespace storm {
             
             const std::string ModelCheckerSettings::moduleName = "modelchecker";
             const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
+            const std::string ModelCheckerSettings::explicitRepresentationCacheSizeOptionName = "hybridcache";
 
             ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false, "If set, states with reward zero are filtered out, potentially reducing the size of the equation system").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, explicitRepresentationCacheSizeOptionName, true, "Sets the amount of memory (in MB) used to keep explicit matrices obtained from symbolic ones between property checks.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The size of the cache (0 disables caching).").setDefaultValueUnsignedInteger(256).build()).build());
             }
             
             bool ModelCheckerSettings::isFilterRewZeroSet() const {
                 return this->getOption(filterRewZeroOptionName).getHasOptionBeenSet();
             }
+
+            uint_fast64_t ModelCheckerSettings::getExplicitRepresentationCacheSize() const {
+                return this->getOption(explicitRepresentationCacheSizeOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+            }
             
         } // namespace modules
     } // namespace settings
@@ -22,12 +22,21 @@ namespace storm {
                 
                 bool isFilterRewZeroSet() const;
 
+                /*!
+                 * Retrieves the amount of memory (in MB) that may be used to cache explicit representations (ODDs and
+                 * matrices) that were obtained from symbolic ones, e.g. by the hybrid engine.
+                 *
+                 * @return The size of the cache in MB.
+                 */
+                uint_fast64_t getExplicitRepresentationCacheSize() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
             private:
                 // Define the string names of the options as constants.
                 static const std::string filterRewZeroOptionName;
+                static const std::string explicitRepresentationCacheSizeOptionName;
             };
 
         } // namespace modules
@@ -25,6 +25,8 @@ namespace storm {
             const std::string NativeEquationSolverSettings::powerMethodMultiplicationStyleOptionName = "powmult";
             const std::string NativeEquationSolverSettings::forceBoundsOptionName = "forcebounds";
             const std::string NativeEquationSolverSettings::powerMethodSymmetricUpdatesOptionName = "symmetricupdates";
+            const std::string NativeEquationSolverSettings::stateOrderingOptionName = "reorder";
+            const std::string NativeEquationSolverSettings::symbolicRoundingOptionName = "ddround";
 
             NativeEquationSolverSettings::NativeEquationSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> methods = { "jacobi", "gaussseidel", "sor", "walkerchae", "power", "soundpower", "interval-iteration", "ratsearch" };
@@ -45,6 +47,13 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, forceBoundsOptionName, false, "If set, the equation solver always require that a priori bounds for the solution are computed.").build());
                 
                 this->addOption(storm::settings::OptionBuilder(moduleName, powerMethodSymmetricUpdatesOptionName, false, "If set, interval iteration performs an update on both, lower and upper bound in each iteration").build());
+                
+                std::vector<std::string> stateOrderings = {"none", "rcm", "scc", "backwardbfs"};
+                this->addOption(storm::settings::OptionBuilder(moduleName, stateOrderingOptionName, false, "Sets how the states are reordered before solving the equation system with jacobi, gaussseidel, sor, walkerchae or power.")
+                                .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the ordering. 'rcm' is reverse Cuthill-McKee, 'scc' orders the SCCs topologically and 'backwardbfs' is a backward search from the states with a direct transition to the target.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(stateOrderings)).setDefaultValueString("none").build()).build());
+                
+                this->addOption(storm::settings::OptionBuilder(moduleName, symbolicRoundingOptionName, false, "If set, the values are rounded to multiples of the given granularity in each iteration of the dd engine, which bounds the number of distinct values in the DDs.")
+                                .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("granularity", "The granularity to which values are rounded.").addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
             }
             
             bool NativeEquationSolverSettings::isLinearEquationSystemTechniqueSet() const {
@@ -123,6 +132,28 @@ namespace storm {
                 return this->getOption(forceBoundsOptionName).getHasOptionBeenSet();
             }
 
+            storm::utility::permutation::OrderKind NativeEquationSolverSettings::getStateOrdering() const {
+                std::string stateOrderingString = this->getOption(stateOrderingOptionName).getArgumentByName("name").getValueAsString();
+                if (stateOrderingString == "none") {
+                    return storm::utility::permutation::OrderKind::None;
+                } else if (stateOrderingString == "rcm") {
+                    return storm::utility::permutation::OrderKind::ReverseCuthillMcKee;
+                } else if (stateOrderingString == "scc") {
+                    return storm::utility::permutation::OrderKind::Topological;
+                } else if (stateOrderingString == "backwardbfs") {
+                    return storm::utility::permutation::OrderKind::BackwardBfs;
+                }
+                STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown state ordering '" << stateOrderingString << "'.");
+            }
+
+            bool NativeEquationSolverSettings::isSymbolicRoundingSet() const {
+                return this->getOption(symbolicRoundingOptionName).getHasOptionBeenSet();
+            }
+            
+            double NativeEquationSolverSettings::getSymbolicRoundingGranularity() const {
+                return this->getOption(symbolicRoundingOptionName).getArgumentByName("granularity").getValueAsDouble();
+            }
+
             bool NativeEquationSolverSettings::check() const {
                 // This list does not include the precision, because this option is shared with other modules.
                 bool optionSet = isLinearEquationSystemTechniqueSet() || isMaximalIterationCountSet() || isConvergenceCriterionSet();
@@ -5,6 +5,7 @@
 
 #include "storm/solver/MultiplicationStyle.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/utility/permutation.h"
 
 namespace storm {
     namespace settings {
@@ -109,6 +110,25 @@ namespace storm {
                  * Retrieves whether the  force bounds option has been set.
                  */
                 bool isForceBoundsSet() const;
+                
+                /*!
+                 * Retrieves the ordering of the states that is established before solving the equation system.
+                 *
+                 * @return The state ordering.
+                 */
+                storm::utility::permutation::OrderKind getStateOrdering() const;
+                
+                /*!
+                 * Retrieves whether the values are to be rounded in each iteration of the dd engine.
+                 */
+                bool isSymbolicRoundingSet() const;
+                
+                /*!
+                 * Retrieves the granularity to which values are rounded in each iteration of the dd engine.
+                 *
+                 * @return The granularity.
+                 */
+                double getSymbolicRoundingGranularity() const;
                
                 bool check() const override;
                 
@@ -126,6 +146,8 @@ namespace storm {
                 static const std::string powerMethodSymmetricUpdatesOptionName;
                 static const std::string powerMethodMultiplicationStyleOptionName;
                 static const std::string forceBoundsOptionName;
+                static const std::string stateOrderingOptionName;
+                static const std::string symbolicRoundingOptionName;
 
             };
             
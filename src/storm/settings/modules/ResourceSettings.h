@@ -39,6 +39,14 @@ namespace storm {
                  */
                 uint_fast64_t getTimeoutInSeconds() const;
 
+                /*!
+                 * Retrieves the number of threads that may be used for parallel computations that do not belong to a
+                 * particular library (such as the translation of decision diagrams to sparse matrices).
+                 *
+                 * @return The number of threads, where zero means that the number of hardware threads is used.
+                 */
+                uint_fast64_t getNumberOfThreads() const;
+
                 // The name of the module.
                 static const std::string moduleName;
 
@@ -48,6 +56,7 @@ namespace storm {
                 static const std::string timeoutOptionShortName;
                 static const std::string printTimeAndMemoryOptionName;
                 static const std::string printTimeAndMemoryOptionShortName;
+                static const std::string threadsOptionName;
             };
         }
     }
@@ -14,10 +14,14 @@ namespace storm {
             const std::string SylvanSettings::moduleName = "sylvan";
             const std::string SylvanSettings::maximalMemoryOptionName = "maxmem";
             const std::string SylvanSettings::threadCountOptionName = "threads";
+            const std::string SylvanSettings::reorderOptionName = "dynreorder";
+            const std::string SylvanSettings::reorderMaximalGrowthOptionName = "reordermaxgrowth";
             
             SylvanSettings::SylvanSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, maximalMemoryOptionName, true, "Sets the upper bound of memory available to Sylvan in MB.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The memory available to Sylvan.").setDefaultValueUnsignedInteger(4096).build()).build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, threadCountOptionName, true, "Sets the number of threads used by Sylvan.").addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The number of threads available to Sylvan (0 means 'auto-detect').").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, reorderOptionName, false, "Sets whether dynamic reordering (sifting) is allowed.").build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, reorderMaximalGrowthOptionName, true, "Sets by which factor the DDs may grow while sifting a group of variables.").addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The maximal growth factor.").setDefaultValueDouble(1.2).addValidatorDouble(ArgumentValidatorFactory::createDoubleGreaterEqualValidator(1.0)).build()).build());
             }
             
             uint_fast64_t SylvanSettings::getMaximalMemory() const {
@@ -32,6 +36,14 @@ namespace storm {
                 return this->getOption(threadCountOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
             }
             
+            bool SylvanSettings::isReorderingEnabled() const {
+                return this->getOption(reorderOptionName).getHasOptionBeenSet();
+            }
+            
+            double SylvanSettings::getReorderingMaximalGrowth() const {
+                return this->getOption(reorderMaximalGrowthOptionName).getArgumentByName("value").getValueAsDouble();
+            }
+            
         } // namespace modules
     } // namespace settings
 } // namespace storm
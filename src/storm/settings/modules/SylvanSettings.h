@@ -37,6 +37,20 @@ namespace storm {
                  */
                 bool isNumberOfThreadsSet() const;
                 
+                /*!
+                 * Retrieves whether dynamic reordering is enabled.
+                 *
+                 * @return True iff dynamic reordering is enabled.
+                 */
+                bool isReorderingEnabled() const;
+                
+                /*!
+                 * Retrieves the maximal factor by which the DDs may grow while sifting a group of variables.
+                 *
+                 * @return The maximal growth factor.
+                 */
+                double getReorderingMaximalGrowth() const;
+                
                 // The name of the module.
                 static const std::string moduleName;
                 
@@ -44,6 +58,8 @@ namespace storm {
                 // Define the string names of the options as constants.
                 static const std::string maximalMemoryOptionName;
                 static const std::string threadCountOptionName;
+                static const std::string reorderOptionName;
+                static const std::string reorderMaximalGrowthOptionName;
             };
             
         } // namespace modules
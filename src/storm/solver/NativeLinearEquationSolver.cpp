@@ -9,6 +9,7 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/permutation.h"
 #include "storm/solver/Multiplier.h"
 #include "storm/exceptions/InvalidStateException.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -1127,9 +1128,65 @@ namespace storm {
         }
 
         
+        template<typename ValueType>
+        bool NativeLinearEquationSolver<ValueType>::solveEquationsReordered(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+            auto const& order = env.solver().native().getStateOrdering();
+            if (!this->reorderedSystem) {
+                STORM_LOG_INFO("Reordering the " << this->A->getRowCount() << " rows of the equation system (" << storm::utility::permutation::toString(order) << ").");
+                this->reorderedSystem = std::make_unique<ReorderedSystem>();
+                // The rows with a nonzero right-hand side correspond to the states with a direct transition to the target.
+                storm::storage::BitVector targetStates = storm::utility::vector::filter<ValueType>(b, [] (ValueType const& value) { return !storm::utility::isZero(value); });
+                this->reorderedSystem->permutation = storm::utility::permutation::createPermutation(order, *this->A, targetStates);
+                std::vector<uint_fast64_t> inversePermutation = storm::utility::permutation::invertPermutation(this->reorderedSystem->permutation);
+                this->reorderedSystem->solver = std::make_unique<NativeLinearEquationSolver<ValueType>>(this->A->permuteRowGroupsAndColumns(this->reorderedSystem->permutation, inversePermutation));
+                this->reorderedSystem->solver->setCachingEnabled(true);
+            }
+            
+            // The bounds may change between calls, so they are passed on (in the new ordering) every time.
+            auto& reorderedSolver = *this->reorderedSystem->solver;
+            reorderedSolver.clearBounds();
+            if (this->hasLowerBound(AbstractEquationSolver<ValueType>::BoundType::Global)) {
+                reorderedSolver.setLowerBound(this->getLowerBound());
+            }
+            if (this->hasLowerBound(AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                reorderedSolver.setLowerBounds(storm::utility::permutation::permuteVector(this->getLowerBounds(), this->reorderedSystem->permutation));
+            }
+            if (this->hasUpperBound(AbstractEquationSolver<ValueType>::BoundType::Global)) {
+                reorderedSolver.setUpperBound(this->getUpperBound());
+            }
+            if (this->hasUpperBound(AbstractEquationSolver<ValueType>::BoundType::Local)) {
+                reorderedSolver.setUpperBounds(storm::utility::permutation::permuteVector(this->getUpperBounds(), this->reorderedSystem->permutation));
+            }
+            
+            storm::Environment reorderedEnv(env);
+            reorderedEnv.solver().native().setStateOrdering(storm::utility::permutation::OrderKind::None);
+            std::vector<ValueType> reorderedX = storm::utility::permutation::permuteVector(x, this->reorderedSystem->permutation);
+            std::vector<ValueType> reorderedB = storm::utility::permutation::permuteVector(b, this->reorderedSystem->permutation);
+            bool result = reorderedSolver.solveEquations(reorderedEnv, reorderedX, reorderedB);
+            
+            // Apply the inverse permutation to obtain the result for the original ordering.
+            for (uint64_t index = 0; index < reorderedX.size(); ++index) {
+                x[this->reorderedSystem->permutation[index]] = std::move(reorderedX[index]);
+            }
+            
+            if (!this->isCachingEnabled()) {
+                clearCache();
+            }
+            return result;
+        }
+        
         template<typename ValueType>
         bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-            switch(getMethod(env, storm::NumberTraits<ValueType>::IsExact)) {
+            auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact);
+            
+            // Custom termination conditions refer to the original ordering, so we only reorder if there is none. The
+            // bounds are permuted along with the system.
+            bool methodSupportsReordering = method == NativeLinearEquationSolverMethod::SOR || method == NativeLinearEquationSolverMethod::GaussSeidel || method == NativeLinearEquationSolverMethod::Jacobi || method == NativeLinearEquationSolverMethod::WalkerChae || method == NativeLinearEquationSolverMethod::Power;
+            if (env.solver().native().getStateOrdering() != storm::utility::permutation::OrderKind::None && methodSupportsReordering && !this->hasCustomTerminationCondition()) {
+                return this->solveEquationsReordered(env, x, b);
+            }
+            
+            switch(method) {
                 case NativeLinearEquationSolverMethod::SOR:
                     return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
                 case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -1181,6 +1238,7 @@ namespace storm {
             jacobiDecomposition.reset();
             cachedRowVector2.reset();
             walkerChaeData.reset();
+            reorderedSystem.reset();
             multiplier.reset();
             LinearEquationSolver<ValueType>::clearCache();
         }
@@ -67,6 +67,7 @@ namespace storm {
             virtual bool solveEquationsSoundPower(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
             virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+            virtual bool solveEquationsReordered(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
 
             template<typename RationalType, typename ImpreciseType>
             bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver, storm::storage::SparseMatrix<RationalType> const& rationalA, std::vector<RationalType>& rationalX, std::vector<RationalType> const& rationalB, storm::storage::SparseMatrix<ImpreciseType> const& A, std::vector<ImpreciseType>& x, std::vector<ImpreciseType> const& b, std::vector<ImpreciseType>& tmpX) const;
@@ -120,6 +121,14 @@ namespace storm {
                 std::vector<ValueType> newX;
             };
             mutable std::unique_ptr<WalkerChaeData> walkerChaeData;
+            
+            struct ReorderedSystem {
+                // Holds at position i the index of the row of the original system that became the i-th row.
+                std::vector<uint_fast64_t> permutation;
+                // A solver for the reordered system.
+                std::unique_ptr<NativeLinearEquationSolver<ValueType>> solver;
+            };
+            mutable std::unique_ptr<ReorderedSystem> reorderedSystem;
         };
         
         template<typename ValueType>
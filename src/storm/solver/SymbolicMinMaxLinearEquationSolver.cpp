@@ -103,6 +103,73 @@ namespace storm {
             
             return SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult(status, iterations, localX);
         }
+        
+        template<storm::dd::DdType DdType, typename ValueType>
+        typename SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::performRoundedValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, ValueType const& granularity) const {
+            
+            auto performStep = [&] (storm::dd::Add<DdType, ValueType> const& values, bool roundUp) {
+                storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(values.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables);
+                tmp += b;
+                
+                if (dir == storm::solver::OptimizationDirection::Minimize) {
+                    tmp += illegalMaskAdd;
+                    tmp = tmp.minAbstract(this->choiceVariables);
+                } else {
+                    tmp = tmp.maxAbstract(this->choiceVariables);
+                }
+                return storm::utility::dd::roundToGranularity(tmp, granularity, roundUp);
+            };
+            
+            // As the Bellman operator is monotone, rounding the values down (up) keeps lower (upper) bounds. The
+            // given starting point need not be a lower bound (e.g. if it is the value of an initial scheduler), so we
+            // can only iterate from both sides if lower and upper bounds are known.
+            storm::dd::Add<DdType, ValueType> lowerX;
+            boost::optional<storm::dd::Add<DdType, ValueType>> upperX;
+            if ((this->hasLowerBound() || this->hasLowerBounds()) && (this->hasUpperBound() || this->hasUpperBounds())) {
+                lowerX = storm::utility::dd::roundToGranularity(this->getLowerBoundsVector(), granularity, false);
+                upperX = storm::utility::dd::roundToGranularity(this->getUpperBoundsVector(), granularity, true);
+            } else {
+                // Otherwise, we can only compare consecutive iterations. Once the changes fall below the granularity,
+                // the rounded values no longer change, so this is only reasonable for a fine granularity.
+                lowerX = storm::utility::dd::roundToGranularity(x, granularity, false);
+                STORM_LOG_THROW(storm::utility::dd::isGranularityNegligible(granularity, precision), storm::exceptions::InvalidEnvironmentException, "The rounding granularity " << granularity << " is too coarse for precision " << precision << " as no lower and upper bounds are known.");
+            }
+            uint64_t iterations = 0;
+            
+            SolverStatus status = SolverStatus::InProgress;
+            while (status == SolverStatus::InProgress && iterations < maximalIterations) {
+                storm::dd::Add<DdType, ValueType> tmp = performStep(lowerX, false);
+                
+                if (upperX) {
+                    storm::dd::Add<DdType, ValueType> upperTmp = performStep(upperX.get(), true);
+                    
+                    // We only stop once the lower and upper bounds are close enough.
+                    if (tmp.equalModuloPrecision(upperTmp, precision, relativeTerminationCriterion)) {
+                        status = SolverStatus::Converged;
+                    } else if (tmp == lowerX && upperTmp == upperX.get()) {
+                        STORM_LOG_WARN("Rounded value iteration got stuck after " << iterations << " iterations. Consider a finer granularity.");
+                        break;
+                    }
+                    upperX = upperTmp;
+                } else if (tmp.equalModuloPrecision(lowerX, precision, relativeTerminationCriterion)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                lowerX = tmp;
+                ++iterations;
+                STORM_LOG_TRACE("Rounded value iteration " << iterations << ": " << lowerX.getLeafCount() << " distinct values, " << lowerX.getNodeCount() << " nodes.");
+            }
+            
+            if (status != SolverStatus::Converged) {
+                status = SolverStatus::MaximalIterationsExceeded;
+            }
+            
+            if (upperX) {
+                // Take the middle of the interval to halve the error.
+                lowerX = (lowerX + upperX.get()) / lowerX.getDdManager().getConstant(storm::utility::convertNumber<ValueType>(2.0));
+            }
+            return SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::ValueIterationResult(status, iterations, lowerX);
+        }
 
         template<storm::dd::DdType DdType, typename ValueType>
         bool SymbolicMinMaxLinearEquationSolver<DdType, ValueType>::isSolution(OptimizationDirection dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
@@ -270,7 +337,7 @@ namespace storm {
             }
             
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
-            ValueIterationResult viResult = performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
+            ValueIterationResult viResult = env.solver().minMax().isSymbolicRoundingSet() ? performRoundedValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations(), storm::utility::convertNumber<ValueType>(env.solver().minMax().getSymbolicRoundingGranularity())) : performValueIteration(dir, localX, b, precision, env.solver().minMax().getRelativeTerminationCriterion(), env.solver().minMax().getMaximalNumberOfIterations());
             
             if (viResult.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (value iteration) converged in " << viResult.iterations << " iterations.");
@@ -169,6 +169,13 @@ namespace storm {
             
             ValueIterationResult performValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
             
+            /*!
+             * Performs value iteration in which all values are rounded to multiples of the given granularity after each
+             * iteration. The values starting from x are rounded down. If upper bounds are known, values starting from
+             * the upper bounds are additionally rounded up and the iteration stops once both agree up to the precision.
+             */
+            ValueIterationResult performRoundedValueIteration(storm::solver::OptimizationDirection const& dir, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, ValueType const& granularity) const;
+            
         protected:
             // The matrix defining the coefficients of the linear equation system.
             storm::dd::Add<DdType, ValueType> A;
@@ -10,6 +10,7 @@
 
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 
@@ -78,6 +79,12 @@ namespace storm {
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
             uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
             bool relative = env.solver().native().getRelativeTerminationCriterion();
+            boost::optional<ValueType> granularity;
+            if (env.solver().native().isSymbolicRoundingSet()) {
+                granularity = storm::utility::convertNumber<ValueType>(env.solver().native().getSymbolicRoundingGranularity());
+                // The rounded values are not bounded from above, so they may get stuck before the solution is reached.
+                STORM_LOG_THROW(storm::utility::dd::isGranularityNegligible(granularity.get(), precision), storm::exceptions::InvalidEnvironmentException, "The rounding granularity " << granularity.get() << " is too coarse for the Jacobi method with precision " << precision << ".");
+            }
             
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (jacobi)");
 
@@ -100,6 +107,9 @@ namespace storm {
             while (!converged && iterationCount < maxIter) {
                 storm::dd::Add<DdType, ValueType> xCopyAsColumn = xCopy.swapVariables(this->rowColumnMetaVariablePairs);
                 storm::dd::Add<DdType, ValueType> tmp = scaledB - scaledLu.multiplyMatrix(xCopyAsColumn, this->columnMetaVariables);
+                if (granularity) {
+                    tmp = storm::utility::dd::roundToGranularity(tmp, granularity.get(), false);
+                }
                 
                 // Now check if the process already converged within our precision.
                 converged = tmp.equalModuloPrecision(xCopy, precision, relative);
@@ -144,11 +154,67 @@ namespace storm {
             return PowerIterationResult(status, iterations, currentX);
         }
         
+        template<storm::dd::DdType DdType, typename ValueType>
+        typename SymbolicNativeLinearEquationSolver<DdType, ValueType>::PowerIterationResult SymbolicNativeLinearEquationSolver<DdType, ValueType>::performRoundedPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, ValueType const& granularity) const {
+            
+            // As the matrix is non-negative, the iteration is monotone. Hence, rounding the values down (up) keeps
+            // lower (upper) bounds. The given starting point need not be a lower bound, so we can only iterate from
+            // both sides if lower and upper bounds are known.
+            storm::dd::Add<DdType, ValueType> lowerX;
+            boost::optional<storm::dd::Add<DdType, ValueType>> upperX;
+            if ((this->hasLowerBound() || this->hasLowerBounds()) && (this->hasUpperBound() || this->hasUpperBounds())) {
+                lowerX = storm::utility::dd::roundToGranularity(this->getLowerBoundsVector(), granularity, false);
+                upperX = storm::utility::dd::roundToGranularity(this->getUpperBoundsVector(), granularity, true);
+            } else {
+                // Otherwise, we can only compare consecutive iterations. Once the changes fall below the granularity,
+                // the rounded values no longer change, so this is only reasonable for a fine granularity.
+                lowerX = storm::utility::dd::roundToGranularity(x, granularity, false);
+                STORM_LOG_THROW(storm::utility::dd::isGranularityNegligible(granularity, precision), storm::exceptions::InvalidEnvironmentException, "The rounding granularity " << granularity << " is too coarse for precision " << precision << " as no lower and upper bounds are known.");
+            }
+            uint_fast64_t iterations = 0;
+            SolverStatus status = SolverStatus::InProgress;
+            
+            while (status == SolverStatus::InProgress && iterations < maximalIterations) {
+                storm::dd::Add<DdType, ValueType> tmp = this->A.multiplyMatrix(lowerX.swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+                tmp = storm::utility::dd::roundToGranularity(tmp, granularity, false);
+                
+                if (upperX) {
+                    storm::dd::Add<DdType, ValueType> upperTmp = this->A.multiplyMatrix(upperX.get().swapVariables(this->rowColumnMetaVariablePairs), this->columnMetaVariables) + b;
+                    upperTmp = storm::utility::dd::roundToGranularity(upperTmp, granularity, true);
+                    
+                    // We only stop once the lower and upper bounds are close enough.
+                    if (tmp.equalModuloPrecision(upperTmp, precision, relativeTerminationCriterion)) {
+                        status = SolverStatus::Converged;
+                    } else if (tmp == lowerX && upperTmp == upperX.get()) {
+                        STORM_LOG_WARN("Rounded power iteration got stuck after " << iterations << " iterations. Consider a finer granularity.");
+                        break;
+                    }
+                    upperX = upperTmp;
+                } else if (tmp.equalModuloPrecision(lowerX, precision, relativeTerminationCriterion)) {
+                    status = SolverStatus::Converged;
+                }
+                
+                ++iterations;
+                lowerX = tmp;
+                STORM_LOG_TRACE("Rounded power iteration " << iterations << ": " << lowerX.getLeafCount() << " distinct values, " << lowerX.getNodeCount() << " nodes.");
+            }
+            
+            if (status != SolverStatus::Converged) {
+                status = SolverStatus::MaximalIterationsExceeded;
+            }
+            
+            if (upperX) {
+                // Take the middle of the interval to halve the error.
+                lowerX = (lowerX + upperX.get()) / lowerX.getDdManager().getConstant(storm::utility::convertNumber<ValueType>(2.0));
+            }
+            return PowerIterationResult(status, iterations, lowerX);
+        }
+        
         template<storm::dd::DdType DdType, typename ValueType>
         storm::dd::Add<DdType, ValueType> SymbolicNativeLinearEquationSolver<DdType, ValueType>::solveEquationsPower(Environment const& env, storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b) const {
             STORM_LOG_INFO("Solving symbolic linear equation system with NativeLinearEquationSolver (power)");
             ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-            PowerIterationResult result = performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
+            PowerIterationResult result = env.solver().native().isSymbolicRoundingSet() ? performRoundedPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations(), storm::utility::convertNumber<ValueType>(env.solver().native().getSymbolicRoundingGranularity())) : performPowerIteration(x, b, precision, env.solver().native().getRelativeTerminationCriterion(), env.solver().native().getMaximalNumberOfIterations());
             
             if (result.status == SolverStatus::Converged) {
                 STORM_LOG_INFO("Iterative solver (power iteration) converged in " << result.iterations << " iterations.");
@@ -102,6 +102,13 @@ namespace storm {
             };
             
             PowerIterationResult performPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations) const;
+            
+            /*!
+             * Performs power iteration in which all values are rounded to multiples of the given granularity after each
+             * iteration. The values starting from x are rounded down. If upper bounds are known, values starting from
+             * the upper bounds are additionally rounded up and the iteration stops once both agree up to the precision.
+             */
+            PowerIterationResult performRoundedPowerIteration(storm::dd::Add<DdType, ValueType> const& x, storm::dd::Add<DdType, ValueType> const& b, ValueType const& precision, bool relativeTerminationCriterion, uint64_t maximalIterations, ValueType const& granularity) const;
 
         };
         
@@ -517,7 +517,10 @@ namespace storm {
             
             template<typename StateType>
             friend struct Murmur3BitVectorHash;
-            
+
+            template<typename ValueType, typename Hash>
+            friend class BitVectorHashMap;
+
         private:
             /*!
              * Creates an empty bit vector with the given number of buckets.
@@ -42,7 +42,7 @@ namespace storm {
         }
                 
         template<class ValueType, class Hash>
-        BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor) : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
+        BitVectorHashMap<ValueType, Hash>::BitVectorHashMap(uint64_t bucketSize, uint64_t initialSize, double loadFactor, boost::optional<std::string> const& storageDirectory) : loadFactor(loadFactor), bucketSize(bucketSize), currentSize(1), numberOfElements(0) {
             STORM_LOG_ASSERT(bucketSize % 64 == 0, "Bucket size must be a multiple of 64.");
 
             while (initialSize > 0) {
@@ -51,7 +51,7 @@ namespace storm {
             }
             
             // Create the underlying containers.
-            buckets = storm::storage::BitVector(bucketSize * (1ull << currentSize));
+            buckets = storm::storage::WordStorage((bucketSize >> 6) << currentSize, storageDirectory);
             occupied = storm::storage::BitVector(1ull << currentSize);
             values = std::vector<ValueType>(1ull << currentSize);
 
@@ -88,7 +88,7 @@ namespace storm {
 #endif
             
             // Create new containers and swap them with the old ones.
-            storm::storage::BitVector oldBuckets(bucketSize * (1ull << currentSize));
+            storm::storage::WordStorage oldBuckets((bucketSize >> 6) << currentSize, buckets.getDirectory());
             std::swap(oldBuckets, buckets);
             storm::storage::BitVector oldOccupied = storm::storage::BitVector(1ull << currentSize);
             std::swap(oldOccupied, occupied);
@@ -99,7 +99,7 @@ namespace storm {
             uint64_t oldSize = numberOfElements;
             numberOfElements = 0;
             for (auto bucketIndex : oldOccupied) {
-                findOrAddAndGetBucket(oldBuckets.get(bucketIndex * bucketSize, bucketSize), oldValues[bucketIndex]);
+                findOrAddAndGetBucket(getBucket(oldBuckets, bucketIndex), oldValues[bucketIndex]);
             }
             STORM_LOG_ASSERT(oldSize == numberOfElements, "Size mismatch in rehashing. Size before was " << oldSize << " and new size is " << numberOfElements << ".");
         }
@@ -118,7 +118,8 @@ namespace storm {
                 return std::make_pair(values[flagAndBucket.second], flagAndBucket.second);
             } else {
                 // Insert the new bits into the bucket.
-                buckets.set(flagAndBucket.second * bucketSize, key);
+                STORM_LOG_ASSERT(key.size() <= bucketSize, "Key is too long.");
+                std::copy_n(key.buckets, key.bucketCount(), buckets.data() + flagAndBucket.second * (bucketSize >> 6));
                 occupied.set(flagAndBucket.second);
                 values[flagAndBucket.second] = value;
                 ++numberOfElements;
@@ -179,7 +180,7 @@ namespace storm {
 #ifndef NDEBUG
                 ++numberOfFindProbingSteps;
 #endif
-                if (buckets.matches(bucket * bucketSize, key)) {
+                if (bucketMatches(bucket, key)) {
                     return std::make_pair(true, bucket);
                 }
                 ++bucket;
@@ -202,7 +203,7 @@ namespace storm {
 #ifndef NDEBUG
                 ++numberOfInsertionProbingSteps;
 #endif
-                if (buckets.matches(bucket * bucketSize, key)) {
+                if (bucketMatches(bucket, key)) {
                     return std::make_pair(true, bucket);
                 }
                 ++bucket;
@@ -216,7 +217,21 @@ namespace storm {
         
         template<class ValueType, class Hash>
         std::pair<storm::storage::BitVector, ValueType> BitVectorHashMap<ValueType, Hash>::getBucketAndValue(uint64_t bucket) const {
-            return std::make_pair(buckets.get(bucket * bucketSize, bucketSize), values[bucket]);
+            return std::make_pair(getBucket(buckets, bucket), values[bucket]);
+        }
+
+        template<class ValueType, class Hash>
+        storm::storage::BitVector BitVectorHashMap<ValueType, Hash>::getBucket(storm::storage::WordStorage const& storage, uint64_t bucket) const {
+            uint64_t wordsPerBucket = bucketSize >> 6;
+            storm::storage::BitVector result(wordsPerBucket, bucketSize);
+            std::copy_n(storage.data() + bucket * wordsPerBucket, wordsPerBucket, result.buckets);
+            return result;
+        }
+
+        template<class ValueType, class Hash>
+        bool BitVectorHashMap<ValueType, Hash>::bucketMatches(uint64_t bucket, storm::storage::BitVector const& key) const {
+            STORM_LOG_ASSERT(key.size() <= bucketSize, "Key is too long.");
+            return std::equal(key.buckets, key.buckets + key.bucketCount(), buckets.data() + bucket * (bucketSize >> 6));
         }
         
         template<class ValueType, class Hash>
@@ -3,8 +3,12 @@
 
 #include <cstdint>
 #include <functional>
+#include <string>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVector.h"
+#include "storm/storage/WordStorage.h"
 
 namespace storm {
     namespace storage {
@@ -56,8 +60,10 @@ namespace storm {
              * @param initialSize The number of buckets that is initially available.
              * @param loadFactor The load factor that determines at which point the size of the underlying storage is
              * increased.
+             * @param storageDirectory If given, the keys are held in a memory-mapped file in this directory, so the
+             * operating system can move them out of memory. The values are always held in memory.
              */
-            BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75);
+            BitVectorHashMap(uint64_t bucketSize = 64, uint64_t initialSize = 1000, double loadFactor = 0.75, boost::optional<std::string> const& storageDirectory = boost::none);
             
             BitVectorHashMap(BitVectorHashMap const&) = default;
             BitVectorHashMap(BitVectorHashMap&&) = default;
@@ -182,6 +188,24 @@ namespace storm {
              * must not be increased).
              */
             std::pair<bool, uint64_t> findBucketToInsert(storm::storage::BitVector const& key);
+
+            /*!
+             * Retrieves the key stored in the given bucket of the given storage.
+             *
+             * @param storage The storage holding the buckets.
+             * @param bucket The index of the bucket.
+             * @return The key stored in the bucket.
+             */
+            storm::storage::BitVector getBucket(storm::storage::WordStorage const& storage, uint64_t bucket) const;
+
+            /*!
+             * Checks whether the given bucket holds the given key.
+             *
+             * @param bucket The index of the bucket.
+             * @param key The key to compare with.
+             * @return True iff the bucket holds the key.
+             */
+            bool bucketMatches(uint64_t bucket, storm::storage::BitVector const& key) const;
             
             /*!
              * Inserts the given key-value pair without resizing the underlying storage. If that fails, this is
@@ -219,8 +243,8 @@ namespace storm {
             // The number of buckets is 2^currentSize.
             uint64_t currentSize;
             
-            // The buckets that hold the elements of the map.
-            storm::storage::BitVector buckets;
+            // The buckets that hold the keys of the map. Each bucket consists of bucketSize / 64 words.
+            storm::storage::WordStorage buckets;
             
             // A bit vector that stores which buckets actually hold a value.
             storm::storage::BitVector occupied;
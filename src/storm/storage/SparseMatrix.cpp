@@ -1148,6 +1148,41 @@ namespace storm {
             return matrixBuilder.build();
         }
         
+        template<typename ValueType>
+        SparseMatrix<ValueType> SparseMatrix<ValueType>::permuteRowGroupsAndColumns(std::vector<index_type> const& rowGroupPermutation, std::vector<index_type> const& columnPermutation) const {
+            STORM_LOG_ASSERT(rowGroupPermutation.size() == this->getRowGroupCount(), "Dimensions mismatch.");
+            STORM_LOG_ASSERT(columnPermutation.size() == this->getColumnCount(), "Dimensions mismatch.");
+            
+            std::vector<index_type> newRowIndications;
+            newRowIndications.reserve(this->getRowCount() + 1);
+            newRowIndications.push_back(0);
+            std::vector<MatrixEntry<index_type, ValueType>> newColumnsAndValues;
+            newColumnsAndValues.reserve(this->getEntryCount());
+            boost::optional<std::vector<index_type>> newRowGroupIndices;
+            if (!this->hasTrivialRowGrouping()) {
+                newRowGroupIndices = std::vector<index_type>();
+                newRowGroupIndices->reserve(this->getRowGroupCount() + 1);
+                newRowGroupIndices->push_back(0);
+            }
+            
+            for (auto const& oldRowGroup : rowGroupPermutation) {
+                for (index_type row = this->getRowGroupIndices()[oldRowGroup], rowEnd = this->getRowGroupIndices()[oldRowGroup + 1]; row < rowEnd; ++row) {
+                    auto rowStart = newColumnsAndValues.size();
+                    for (auto const& entry : this->getRow(row)) {
+                        newColumnsAndValues.emplace_back(columnPermutation[entry.getColumn()], entry.getValue());
+                    }
+                    // Renaming the columns destroys the ordering of the entries within the row, so we need to restore it.
+                    std::sort(newColumnsAndValues.begin() + rowStart, newColumnsAndValues.end(), [] (MatrixEntry<index_type, ValueType> const& a, MatrixEntry<index_type, ValueType> const& b) { return a.getColumn() < b.getColumn(); });
+                    newRowIndications.push_back(newColumnsAndValues.size());
+                }
+                if (newRowGroupIndices) {
+                    newRowGroupIndices->push_back(newRowIndications.size() - 1);
+                }
+            }
+            
+            return SparseMatrix<ValueType>(this->getColumnCount(), std::move(newRowIndications), std::move(newColumnsAndValues), std::move(newRowGroupIndices));
+        }
+        
         template <typename ValueType>
         SparseMatrix<ValueType> SparseMatrix<ValueType>::transpose(bool joinGroups, bool keepZeros) const {
             index_type rowCount = this->getColumnCount();
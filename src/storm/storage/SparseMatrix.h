@@ -759,6 +759,18 @@ namespace storm {
              */
             SparseMatrix selectRowsFromRowIndexSequence(std::vector<index_type> const& rowIndexSequence, bool insertDiagonalEntries = true) const;
             
+            /*!
+             * Permutes the row groups and the columns of this matrix. The rows within each row group keep their
+             * relative order. This can be used to renumber the states of a model consistently.
+             *
+             * @param rowGroupPermutation A vector that holds for each row group of the resulting matrix the index of
+             * the row group of this matrix it is taken from.
+             * @param columnPermutation A vector that holds for each column of this matrix the index of the column it
+             * is mapped to in the resulting matrix.
+             * @return The permuted matrix.
+             */
+            SparseMatrix permuteRowGroupsAndColumns(std::vector<index_type> const& rowGroupPermutation, std::vector<index_type> const& columnPermutation) const;
+            
             /*!
              * Transposes the matrix.
              *
@@ -0,0 +1,139 @@
+#include "storm/storage/WordStorage.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/utility/OsDetection.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+
+#ifndef WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace storm {
+    namespace storage {
+
+        WordStorage::WordStorage() : words(nullptr), numberOfWords(0), directory(), mapped(false) {
+            // Intentionally left empty.
+        }
+
+        WordStorage::WordStorage(uint64_t numberOfWords, boost::optional<std::string> const& directory) : words(nullptr), numberOfWords(numberOfWords), directory(directory), mapped(false) {
+            allocate();
+        }
+
+        WordStorage::WordStorage(WordStorage const& other) : words(nullptr), numberOfWords(other.numberOfWords), directory(other.directory), mapped(false) {
+            allocate();
+            std::copy_n(other.words, numberOfWords, words);
+        }
+
+        WordStorage::WordStorage(WordStorage&& other) : words(other.words), numberOfWords(other.numberOfWords), directory(std::move(other.directory)), mapped(other.mapped) {
+            other.words = nullptr;
+            other.numberOfWords = 0;
+            other.mapped = false;
+        }
+
+        WordStorage& WordStorage::operator=(WordStorage const& other) {
+            if (this != &other) {
+                WordStorage copy(other);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
+
+        WordStorage& WordStorage::operator=(WordStorage&& other) {
+            if (this != &other) {
+                release();
+                words = other.words;
+                numberOfWords = other.numberOfWords;
+                directory = std::move(other.directory);
+                mapped = other.mapped;
+                other.words = nullptr;
+                other.numberOfWords = 0;
+                other.mapped = false;
+            }
+            return *this;
+        }
+
+        WordStorage::~WordStorage() {
+            release();
+        }
+
+        uint64_t* WordStorage::data() {
+            return words;
+        }
+
+        uint64_t const* WordStorage::data() const {
+            return words;
+        }
+
+        uint64_t WordStorage::size() const {
+            return numberOfWords;
+        }
+
+        boost::optional<std::string> const& WordStorage::getDirectory() const {
+            return directory;
+        }
+
+        bool WordStorage::isFileBacked() const {
+            return mapped;
+        }
+
+        void WordStorage::allocate() {
+            if (numberOfWords == 0) {
+                return;
+            }
+            if (directory) {
+#ifndef WINDOWS
+                boost::filesystem::path filename = boost::filesystem::path(directory.get()) / boost::filesystem::unique_path("storm-words-%%%%-%%%%-%%%%-%%%%");
+                int file = open(filename.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+                STORM_LOG_THROW(file >= 0, storm::exceptions::FileIoException, "Unable to create the file '" << filename.native() << "': " << std::strerror(errno) << ".");
+
+                // The mapping keeps the file alive, so it can be deleted right away. Enlarging the file fills it with
+                // zeros without writing them to disk.
+                unlink(filename.c_str());
+                uint64_t numberOfBytes = numberOfWords * sizeof(uint64_t);
+                if (ftruncate(file, numberOfBytes) != 0) {
+                    int error = errno;
+                    close(file);
+                    STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to enlarge the file '" << filename.native() << "' to " << numberOfBytes << " bytes: " << std::strerror(error) << ".");
+                }
+                void* mapping = mmap(nullptr, numberOfBytes, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+                int error = errno;
+                close(file);
+                STORM_LOG_THROW(mapping != MAP_FAILED, storm::exceptions::FileIoException, "Unable to map the file '" << filename.native() << "' to memory: " << std::strerror(error) << ".");
+                words = static_cast<uint64_t*>(mapping);
+                mapped = true;
+                return;
+#else
+                STORM_LOG_WARN("Holding data in files is not supported on this platform, keeping it in memory instead.");
+#endif
+            }
+            words = new uint64_t[numberOfWords]();
+            mapped = false;
+        }
+
+        void WordStorage::release() {
+            if (words != nullptr) {
+#ifndef WINDOWS
+                if (mapped) {
+                    munmap(words, numberOfWords * sizeof(uint64_t));
+                } else {
+                    delete[] words;
+                }
+#else
+                delete[] words;
+#endif
+                words = nullptr;
+            }
+        }
+
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef STORM_STORAGE_WORDSTORAGE_H_
+#define STORM_STORAGE_WORDSTORAGE_H_
+
+#include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * A zero-initialized array of 64-bit words of fixed size. If a directory is given, the words are held in a
+         * temporary file in this directory that is mapped into memory. The operating system can then write them to
+         * the file and drop them from memory when memory gets scarce, while they can be accessed like ordinary memory.
+         * The file is deleted right after its creation, so it disappears once the storage is destroyed.
+         */
+        class WordStorage {
+        public:
+            /*!
+             * Creates an empty storage.
+             */
+            WordStorage();
+
+            /*!
+             * Creates a storage of the given number of words that are all zero.
+             *
+             * @param numberOfWords The number of words.
+             * @param directory If given, the words are held in a file in this directory.
+             */
+            WordStorage(uint64_t numberOfWords, boost::optional<std::string> const& directory = boost::none);
+
+            WordStorage(WordStorage const& other);
+            WordStorage(WordStorage&& other);
+            WordStorage& operator=(WordStorage const& other);
+            WordStorage& operator=(WordStorage&& other);
+
+            ~WordStorage();
+
+            uint64_t* data();
+            uint64_t const* data() const;
+            uint64_t size() const;
+
+            /*!
+             * Retrieves the directory in which the words are held (if any).
+             */
+            boost::optional<std::string> const& getDirectory() const;
+
+            /*!
+             * Retrieves whether the words are held in a file.
+             */
+            bool isFileBacked() const;
+
+        private:
+            // Allocates the (zeroed) words, either in memory or in a file in the directory.
+            void allocate();
+
+            // Releases the words.
+            void release();
+
+            // The words themselves.
+            uint64_t* words;
+
+            // The number of words.
+            uint64_t numberOfWords;
+
+            // The directory in which the words are held (if any).
+            boost::optional<std::string> directory;
+
+            // A flag indicating whether the words are mapped from a file.
+            bool mapped;
+        };
+
+    }
+}
+
+#endif /* STORM_STORAGE_WORDSTORAGE_H_ */
@@ -2,6 +2,13 @@
 
 #include <chrono>
 
+#include <boost/functional/hash.hpp>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Mdp.h"
@@ -47,7 +54,7 @@ namespace storm {
         }
         
         template<typename ModelType, typename BlockDataType>
-        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false) {
+        BisimulationDecomposition<ModelType, BlockDataType>::Options::Options() : measureDrivenInitialPartition(false), phiStates(), psiStates(), respectedAtomicPropositions(), buildQuotient(true), keepRewards(false), type(BisimulationType::Strong), bounded(false), refinementMethod(SparseRefinementMethod::Splitter) {
             // Intentionally left empty.
         }
         
@@ -230,6 +237,12 @@ namespace storm {
         
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::performPartitionRefinement() {
+            if (this->useSignatureBasedRefinement()) {
+                this->performSignatureBasedPartitionRefinement();
+                return;
+            }
+            STORM_LOG_WARN_COND(options.getRefinementMethod() != SparseRefinementMethod::Signature, "Signature-based refinement is not available for the selected bisimulation type, falling back to splitter-based refinement.");
+            
             // Insert all blocks into the splitter queue as a (potential) splitter.
             std::vector<Block<BlockDataType>*> splitterQueue;
             std::for_each(partition.getBlocks().begin(), partition.getBlocks().end(), [&] (std::unique_ptr<Block<BlockDataType>> const& block) { block->data().setSplitter(); splitterQueue.push_back(block.get()); } );
@@ -252,6 +265,143 @@ namespace storm {
             }
         }
         
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::performSignatureBasedPartitionRefinement() {
+            // The signatures of the states and hash values of the blocks they refer to. The latter is used to speed up
+            // the comparison of signatures.
+            std::vector<Signature> signatures(model.getNumberOfStates());
+            std::vector<std::size_t> signatureHashes(model.getNumberOfStates());
+            
+            auto less = [this, &signatures, &signatureHashes] (storm::storage::sparse::state_type state1, storm::storage::sparse::state_type state2) {
+                if (signatureHashes[state1] != signatureHashes[state2]) {
+                    return signatureHashes[state1] < signatureHashes[state2];
+                }
+                return this->signatureLess(signatures[state1], signatures[state2]);
+            };
+            
+            uint_fast64_t iterations = 0;
+            bool split = true;
+            while (split) {
+                ++iterations;
+                split = false;
+                
+                // Collect all blocks that may be split in this round.
+                std::vector<Block<BlockDataType>*> blocksToRefine;
+                for (auto const& block : partition.getBlocks()) {
+                    if (block->getNumberOfStates() > 1 && !block->data().absorbing()) {
+                        blocksToRefine.push_back(block.get());
+                    }
+                }
+                
+                // For every such block, we compute the signatures of its states, sort the states according to them
+                // and determine the positions at which the block needs to be split. Since this only reads the
+                // block-mapping of the partition and only reorders the states within the block, the blocks can be
+                // processed independently of each other.
+                std::vector<std::vector<storm::storage::sparse::state_type>> splitPositions(blocksToRefine.size());
+                auto processBlock = [&] (uint_fast64_t blockIndex) {
+                    Block<BlockDataType> const& block = *blocksToRefine[blockIndex];
+                    for (auto stateIt = partition.begin(block), stateIte = partition.end(block); stateIt != stateIte; ++stateIt) {
+                        Signature& signature = signatures[*stateIt];
+                        this->computeSignature(*stateIt, signature);
+                        
+                        std::size_t hash = 0;
+                        for (auto const& entry : signature) {
+                            boost::hash_combine(hash, entry.first);
+                        }
+                        signatureHashes[*stateIt] = hash;
+                    }
+                    
+                    partition.sortRange(block.getBeginIndex(), block.getEndIndex(), less);
+                    for (storm::storage::sparse::state_type position = block.getBeginIndex() + 1; position < block.getEndIndex(); ++position) {
+                        if (less(partition.getState(position - 1), partition.getState(position))) {
+                            splitPositions[blockIndex].push_back(position);
+                        }
+                    }
+                };
+                
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_for(tbb::blocked_range<uint_fast64_t>(0, blocksToRefine.size()),
+                                  [&](tbb::blocked_range<uint_fast64_t> const& range) {
+                                      for (uint_fast64_t blockIndex = range.begin(); blockIndex != range.end(); ++blockIndex) {
+                                          processBlock(blockIndex);
+                                      }
+                                  });
+#else
+                for (uint_fast64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+                    processBlock(blockIndex);
+                }
+#endif
+                
+                // Finally, perform the actual splits. As the split positions of every block are sorted, every split
+                // separates the states at the beginning of the remaining block.
+                for (uint_fast64_t blockIndex = 0; blockIndex < blocksToRefine.size(); ++blockIndex) {
+                    Block<BlockDataType>& block = *blocksToRefine[blockIndex];
+                    for (auto position : splitPositions[blockIndex]) {
+                        auto result = partition.splitBlock(block, position);
+                        
+                        // Keep track of whether this is a block with reward states.
+                        (*result.first)->data().setHasRewards(block.data().hasRewards());
+                        split = true;
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Signature-based refinement terminated after " << iterations << " iterations with " << partition.size() << " blocks.");
+            
+            this->finalizeSignatureBasedPartitionRefinement();
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        bool BisimulationDecomposition<ModelType, BlockDataType>::useSignatureBasedRefinement() const {
+            return options.getRefinementMethod() == SparseRefinementMethod::Signature && options.getType() == BisimulationType::Strong;
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::finalizeSignatureBasedPartitionRefinement() {
+            // Intentionally left empty.
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        void BisimulationDecomposition<ModelType, BlockDataType>::appendRowToSignature(uint_fast64_t row, Signature& signature) const {
+            uint_fast64_t rowStart = signature.size();
+            for (auto const& entry : model.getTransitionMatrix().getRow(row)) {
+                if (!comparator.isZero(entry.getValue())) {
+                    signature.emplace_back(partition.getBlock(entry.getColumn()).getId(), entry.getValue());
+                }
+            }
+            if (rowStart == signature.size()) {
+                return;
+            }
+            
+            // Sort the entries by blocks and sum the values of entries that refer to the same block.
+            std::sort(signature.begin() + rowStart, signature.end(), [] (typename Signature::value_type const& a, typename Signature::value_type const& b) { return a.first < b.first; });
+            uint_fast64_t lastEntry = rowStart;
+            for (uint_fast64_t entry = rowStart + 1; entry < signature.size(); ++entry) {
+                if (signature[entry].first == signature[lastEntry].first) {
+                    signature[lastEntry].second += signature[entry].second;
+                } else {
+                    ++lastEntry;
+                    signature[lastEntry] = signature[entry];
+                }
+            }
+            signature.resize(lastEntry + 1);
+        }
+        
+        template<typename ModelType, typename BlockDataType>
+        bool BisimulationDecomposition<ModelType, BlockDataType>::signatureLess(Signature const& signature1, Signature const& signature2) const {
+            if (signature1.size() != signature2.size()) {
+                return signature1.size() < signature2.size();
+            }
+            for (auto it1 = signature1.begin(), it2 = signature2.begin(), ite1 = signature1.end(); it1 != ite1; ++it1, ++it2) {
+                if (it1->first != it2->first) {
+                    return it1->first < it2->first;
+                }
+                if (!comparator.isEqual(it1->second, it2->second)) {
+                    return comparator.isLess(it1->second, it2->second);
+                }
+            }
+            return false;
+        }
+        
         template<typename ModelType, typename BlockDataType>
         std::shared_ptr<ModelType> BisimulationDecomposition<ModelType, BlockDataType>::getQuotient() const {
             STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient model from bisimulation decomposition, because it was not built.");
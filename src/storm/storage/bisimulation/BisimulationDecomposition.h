@@ -118,6 +118,17 @@ namespace storm {
                     return optimalityType.get();
                 }
                 
+                /*!
+                 * Sets the method that is used to refine the partition.
+                 */
+                void setRefinementMethod(SparseRefinementMethod method) {
+                    refinementMethod = method;
+                }
+                
+                SparseRefinementMethod getRefinementMethod() const {
+                    return this->refinementMethod;
+                }
+                
                 // A flag that indicates whether a measure driven initial partition is to be used. If this flag is set
                 // to true, the two optional pairs phiStatesAndLabel and psiStatesAndLabel must be set. Then, the
                 // measure driven initial partition wrt. to the states phi and psi is taken.
@@ -146,6 +157,9 @@ namespace storm {
                 /// when computing strong bisimulation equivalence.
                 bool bounded;
                 
+                /// The method that is used to refine the partition.
+                SparseRefinementMethod refinementMethod;
+                
                 /*!
                  * Sets the options under the assumption that the given formula is the only one that is to be checked.
                  *
@@ -213,6 +227,46 @@ namespace storm {
              */
             void performPartitionRefinement();
             
+            /*!
+             * Performs the partition refinement based on signatures. In every round, the signature of every state in a
+             * block that may still be split is computed and all blocks are split according to these signatures at
+             * once. This is repeated until no block is split anymore. The computation of the signatures and the
+             * sorting of the blocks is performed in parallel (if Intel TBB is available).
+             */
+            void performSignatureBasedPartitionRefinement();
+            
+            /*!
+             * Retrieves whether the partition refinement is to be performed based on signatures (instead of splitters).
+             */
+            virtual bool useSignatureBasedRefinement() const;
+            
+            // A signature is a list of (block, value) pairs. The entries are required to be sorted and each block may
+            // only appear once per distribution.
+            typedef std::vector<std::pair<storm::storage::sparse::state_type, ValueType>> Signature;
+            
+            /*!
+             * Computes the signature of the given state with respect to the current partition. Two states of the
+             * same block remain in the same block iff their signatures are equal (wrt. the comparator).
+             *
+             * @param state The state whose signature to compute.
+             * @param signature The signature into which to write the result. Its previous content is discarded.
+             */
+            virtual void computeSignature(storm::storage::sparse::state_type state, Signature& signature) const = 0;
+            
+            /*!
+             * A function that can update auxiliary data structures after the signature-based refinement terminated.
+             */
+            virtual void finalizeSignatureBasedPartitionRefinement();
+            
+            /*!
+             * Appends the distribution of the given row of the transition matrix over the blocks of the current
+             * partition to the signature.
+             */
+            void appendRowToSignature(uint_fast64_t row, Signature& signature) const;
+            
+            // Retrieves whether the first signature is considered to be smaller than the second one.
+            bool signatureLess(Signature const& signature1, Signature const& signature2) const;
+            
             /*!
              * Refines the partition by considering the given splitter. All blocks that become potential splitters
              * because of this refinement, are marked as splitters and inserted into the splitter vector.
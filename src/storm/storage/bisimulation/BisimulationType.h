@@ -5,6 +5,9 @@ namespace storm {
         
         enum class BisimulationType { Strong, Weak };
         enum class BisimulationTypeChoice { Strong, Weak, FromSettings };
+        
+        // The partition refinement strategies available for sparse models.
+        enum class SparseRefinementMethod { Splitter, Signature };
 
     }
 }
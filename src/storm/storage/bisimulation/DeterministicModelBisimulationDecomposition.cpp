@@ -559,6 +559,13 @@ namespace storm {
             }
         }
         
+        template<typename ModelType>
+        void DeterministicModelBisimulationDecomposition<ModelType>::computeSignature(storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+            // For deterministic models, the signature is the probability (or rate) of moving to each of the blocks.
+            signature.clear();
+            this->appendRowToSignature(state, signature);
+        }
+        
         template<typename ModelType>
         void DeterministicModelBisimulationDecomposition<ModelType>::buildQuotient() {
             // In order to create the quotient model, we need to construct
@@ -40,6 +40,8 @@ namespace storm {
             virtual void buildQuotient() override;
             
             virtual void refinePartitionBasedOnSplitter(bisimulation::Block<BlockDataType>& splitter, std::vector<bisimulation::Block<BlockDataType>*>& splitterQueue) override;
+            
+            virtual void computeSignature(storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
 
         private:
             // Post-processes the initial partition to properly initialize it.
@@ -1,5 +1,8 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
+#include <limits>
+#include <unordered_map>
+
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -17,7 +20,7 @@ namespace storm {
         
         template<typename ModelType>
         NondeterministicModelBisimulationDecomposition<ModelType>::NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>::Options const& options) : BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>(model, model.getTransitionMatrix().transpose(false), options), choiceToStateMapping(model.getNumberOfChoices()), quotientDistributions(model.getNumberOfChoices()), orderedQuotientDistributions(model.getNumberOfChoices()) {
-            STORM_LOG_THROW(options.getType() == BisimulationType::Strong, storm::exceptions::IllegalFunctionCallException, "Weak bisimulation is currently not supported for nondeterministic models.");
+            // Intentionally left empty.
         }
         
         template<typename ModelType>
@@ -85,6 +88,125 @@ namespace storm {
             }
         }
         
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::computeSignature(storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const {
+            typedef typename BisimulationDecomposition<ModelType, BlockDataType>::Signature Signature;
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            bool considerStateActionRewards = this->options.getKeepRewards() && this->model.hasRewardModel() && this->model.getUniqueRewardModel().hasStateActionRewards();
+            
+            // Determine the choices that the state can mimic.
+            std::vector<uint_fast64_t> choices;
+            bool divergent = false;
+            if (this->options.getType() == BisimulationType::Weak) {
+                divergent = collectChoicesOfInertClosure(state, choices);
+            } else {
+                for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                    choices.push_back(choice);
+                }
+            }
+            
+            // Compute the quotient distribution of every choice. Every distribution is terminated with an entry for
+            // an artificial block that holds the reward of the choice.
+            std::vector<Signature> choiceSignatures(choices.size());
+            for (uint_fast64_t index = 0; index < choices.size(); ++index) {
+                Signature& choiceSignature = choiceSignatures[index];
+                this->appendRowToSignature(choices[index], choiceSignature);
+                choiceSignature.emplace_back(std::numeric_limits<storm::storage::sparse::state_type>::max(), considerStateActionRewards ? this->model.getUniqueRewardModel().getStateActionReward(choices[index]) : storm::utility::zero<ValueType>());
+            }
+            
+            // Divergence is represented by an (otherwise impossible) empty distribution.
+            if (divergent) {
+                choiceSignatures.emplace_back();
+                choiceSignatures.back().emplace_back(std::numeric_limits<storm::storage::sparse::state_type>::max(), storm::utility::zero<ValueType>());
+            }
+            
+            // As the choices of a state are not ordered, the signature is the ordered set of quotient distributions.
+            std::sort(choiceSignatures.begin(), choiceSignatures.end(), [this] (Signature const& a, Signature const& b) { return this->signatureLess(a, b); });
+            auto uniqueEnd = std::unique(choiceSignatures.begin(), choiceSignatures.end(), [this] (Signature const& a, Signature const& b) { return !this->signatureLess(a, b) && !this->signatureLess(b, a); });
+            
+            signature.clear();
+            for (auto it = choiceSignatures.begin(); it != uniqueEnd; ++it) {
+                signature.insert(signature.end(), it->begin(), it->end());
+            }
+        }
+        
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::useSignatureBasedRefinement() const {
+            // Weak bisimulation is only available via signatures.
+            return this->options.getType() == BisimulationType::Weak || BisimulationDecomposition<ModelType, BlockDataType>::useSignatureBasedRefinement();
+        }
+        
+        template<typename ModelType>
+        boost::optional<storm::storage::sparse::state_type> NondeterministicModelBisimulationDecomposition<ModelType>::getInertSuccessor(storm::storage::sparse::state_type state, uint_fast64_t choice) const {
+            // Steps that collect a reward are never inert.
+            if (this->options.getKeepRewards() && this->model.hasRewardModel()) {
+                auto const& rewardModel = this->model.getUniqueRewardModel();
+                if (rewardModel.hasStateRewards() && !this->comparator.isZero(rewardModel.getStateReward(state))) {
+                    return boost::none;
+                }
+                if (rewardModel.hasStateActionRewards() && !this->comparator.isZero(rewardModel.getStateActionReward(choice))) {
+                    return boost::none;
+                }
+            }
+            
+            boost::optional<storm::storage::sparse::state_type> successor;
+            for (auto const& entry : this->model.getTransitionMatrix().getRow(choice)) {
+                if (this->comparator.isZero(entry.getValue())) {
+                    continue;
+                }
+                if (successor || this->partition.getBlock(entry.getColumn()) != this->partition.getBlock(state)) {
+                    return boost::none;
+                }
+                successor = entry.getColumn();
+            }
+            return successor;
+        }
+        
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::collectChoicesOfInertClosure(storm::storage::sparse::state_type state, std::vector<uint_fast64_t>& choices) const {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            
+            // We perform a depth-first search along the inert choices. A state is mapped to true as long as it is on
+            // the stack, so that we can detect cycles of inert choices.
+            bool divergent = false;
+            std::unordered_map<storm::storage::sparse::state_type, bool> onStack;
+            std::vector<std::pair<storm::storage::sparse::state_type, uint_fast64_t>> stack;
+            onStack[state] = true;
+            stack.emplace_back(state, nondeterministicChoiceIndices[state]);
+            while (!stack.empty()) {
+                storm::storage::sparse::state_type currentState = stack.back().first;
+                uint_fast64_t choice = stack.back().second;
+                if (choice == nondeterministicChoiceIndices[currentState + 1]) {
+                    onStack[currentState] = false;
+                    stack.pop_back();
+                    continue;
+                }
+                ++stack.back().second;
+                
+                boost::optional<storm::storage::sparse::state_type> successor = getInertSuccessor(currentState, choice);
+                if (successor) {
+                    auto onStackIt = onStack.find(successor.get());
+                    if (onStackIt == onStack.end()) {
+                        onStack[successor.get()] = true;
+                        stack.emplace_back(successor.get(), nondeterministicChoiceIndices[successor.get()]);
+                    } else if (onStackIt->second) {
+                        divergent = true;
+                    }
+                } else {
+                    choices.push_back(choice);
+                }
+            }
+            return divergent;
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::finalizeSignatureBasedPartitionRefinement() {
+            // The quotient distributions were not maintained during the refinement, so we recompute them wrt. the
+            // final partition.
+            this->quotientDistributions = std::vector<storm::storage::DistributionWithReward<ValueType>>(this->model.getNumberOfChoices());
+            this->initializeQuotientDistributions();
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -158,6 +280,36 @@ namespace storm {
                     
                     // Add all of the selected atomic propositions that hold in the representative state to the state
                     // representing the block.
+                    for (auto const& ap : atomicPropositions) {
+                        if (this->model.getStateLabeling().getStateHasLabel(ap, representativeState)) {
+                            newLabeling.addLabelToState(ap, blockIndex);
+                        }
+                    }
+                } else if (this->options.getType() == BisimulationType::Weak) {
+                    // Add the (distinct) non-inert choices that the block can mimic.
+                    std::vector<uint_fast64_t> choices;
+                    bool divergent = collectChoicesOfInertClosure(representativeState, choices);
+                    std::sort(choices.begin(), choices.end(), [this] (uint_fast64_t choice1, uint_fast64_t choice2) { return quotientDistributions[choice1].less(quotientDistributions[choice2], this->comparator); });
+                    auto choicesEnd = std::unique(choices.begin(), choices.end(), [this] (uint_fast64_t choice1, uint_fast64_t choice2) { return quotientDistributions[choice1].equals(quotientDistributions[choice2], this->comparator); });
+                    for (auto choiceIt = choices.begin(); choiceIt != choicesEnd; ++choiceIt) {
+                        for (auto entry : quotientDistributions[*choiceIt]) {
+                            builder.addNextValue(currentRow, entry.first, entry.second);
+                        }
+                        if (this->options.getKeepRewards() && rewardModel && rewardModel.get().hasStateActionRewards()) {
+                            stateActionRewards.get().push_back(quotientDistributions[*choiceIt].getReward());
+                        }
+                        ++currentRow;
+                    }
+                    
+                    // A divergent block may stay in the block forever, which is represented by a self-loop.
+                    if (divergent) {
+                        builder.addNextValue(currentRow, blockIndex, storm::utility::one<ValueType>());
+                        if (this->options.getKeepRewards() && rewardModel && rewardModel.get().hasStateActionRewards()) {
+                            stateActionRewards.get().push_back(storm::utility::zero<ValueType>());
+                        }
+                        ++currentRow;
+                    }
+                    
                     for (auto const& ap : atomicPropositions) {
                         if (this->model.getStateLabeling().getStateHasLabel(ap, representativeState)) {
                             newLabeling.addLabelToState(ap, blockIndex);
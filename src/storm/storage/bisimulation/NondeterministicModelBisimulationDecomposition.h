@@ -15,6 +15,10 @@ namespace storm {
         
         /*!
          * This class represents the decomposition of a nondeterministic model into its bisimulation quotient.
+         *
+         * For weak bisimulation, a (divergence-sensitive) branching bisimulation is computed in which the inert steps
+         * are the choices that move to a state of the same block with probability one. All other choices of states
+         * that can be reached via inert steps can be mimicked by the state itself.
          */
         template<typename ModelType>
         class NondeterministicModelBisimulationDecomposition : public BisimulationDecomposition<ModelType, bisimulation::DeterministicBlockData> {
@@ -41,6 +45,12 @@ namespace storm {
             
             virtual void initialize() override;
             
+            virtual void computeSignature(storm::storage::sparse::state_type state, typename BisimulationDecomposition<ModelType, BlockDataType>::Signature& signature) const override;
+            
+            virtual void finalizeSignatureBasedPartitionRefinement() override;
+            
+            virtual bool useSignatureBasedRefinement() const override;
+            
         private:
             // Creates the mapping from the choice indices to the states.
             void createChoiceToStateMapping();
@@ -48,6 +58,13 @@ namespace storm {
             // Initializes the quotient distributions wrt. to the current partition.
             void initializeQuotientDistributions();
             
+            // Retrieves the successor of the given choice if the choice is inert wrt. the current partition.
+            boost::optional<storm::storage::sparse::state_type> getInertSuccessor(storm::storage::sparse::state_type state, uint_fast64_t choice) const;
+            
+            // Collects the non-inert choices of all states reachable from the given state via inert choices. Returns
+            // true iff the given state can stay within its block forever via inert choices (i.e. it is divergent).
+            bool collectChoicesOfInertClosure(storm::storage::sparse::state_type state, std::vector<uint_fast64_t>& choices) const;
+            
             // Retrieves whether the given block possibly needs refinement.
             bool possiblyNeedsRefinement(bisimulation::Block<BlockDataType> const& block) const;
             
@@ -1,5 +1,7 @@
 #include "storm/storage/dd/BisimulationDecomposition.h"
 
+#include <sstream>
+
 #include "storm/storage/dd/bisimulation/Partition.h"
 #include "storm/storage/dd/bisimulation/PartitionRefiner.h"
 #include "storm/storage/dd/bisimulation/NondeterministicModelPartitionRefiner.h"
@@ -12,6 +14,7 @@
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/BisimulationSettings.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/InvalidOperationException.h"
@@ -59,6 +62,7 @@ namespace storm {
             auto const& generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
             verboseProgress = generalSettings.isVerboseSet();
             showProgressDelay = generalSettings.getShowProgressDelay();
+            showRefinementStatistics = storm::settings::getModule<storm::settings::modules::BisimulationSettings>().isShowRefinementStatisticsSet();
             
             auto start = std::chrono::high_resolution_clock::now();
             this->refineWrtRewardModels();
@@ -94,6 +98,11 @@ namespace storm {
             auto end = std::chrono::high_resolution_clock::now();
             
             STORM_LOG_INFO("Partition refinement completed in " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms (" << iterations << " iterations, signature: " << std::chrono::duration_cast<std::chrono::milliseconds>(refiner->getTotalSignatureTime()).count() << "ms, refinement: " << std::chrono::duration_cast<std::chrono::milliseconds>(refiner->getTotalRefinementTime()).count() << "ms).");
+            if (showRefinementStatistics) {
+                std::stringstream statisticsStream;
+                refiner->printRefinementStatistics(statisticsStream);
+                STORM_PRINT_AND_LOG(statisticsStream.str());
+            }
         }
 
         template <storm::dd::DdType DdType, typename ValueType>
@@ -120,6 +129,11 @@ namespace storm {
                 }
             }
             
+            if (!refined && showRefinementStatistics) {
+                std::stringstream statisticsStream;
+                refiner->printRefinementStatistics(statisticsStream);
+                STORM_PRINT_AND_LOG(statisticsStream.str());
+            }
             return !refined;
         }
         
@@ -87,6 +87,9 @@ namespace storm {
             
             // The delay between progress reports.
             uint64_t showProgressDelay;
+            
+            // A flag indicating whether the statistics of the refinement steps are shown.
+            bool showRefinementStatistics;
         };
         
     }
@@ -12,6 +12,7 @@
 #include "storm-config.h"
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -432,6 +433,64 @@ namespace storm {
             internalDdManager.triggerReordering();
         }
         
+        template<>
+        void DdManager<DdType::Sylvan>::triggerReordering() {
+            // Sylvan sifts groups of DD variables. We keep the DD variables of meta variables that were created
+            // together (e.g. the interleaved row and column variables) in one group and align the groups to even
+            // indices so that the interleaving of row and column variables is preserved.
+            uint64_t numberOfDdVariables = internalDdManager.getNumberOfDdVariables();
+            std::vector<std::pair<uint64_t, uint64_t>> ranges;
+            for (auto const& metaVariable : metaVariableMap) {
+                std::vector<uint64_t> indices = metaVariable.second.getIndices();
+                auto minMax = std::minmax_element(indices.begin(), indices.end());
+                ranges.emplace_back(*minMax.first - *minMax.first % 2, std::min<uint64_t>(*minMax.second | 1ull, numberOfDdVariables - 1));
+            }
+            std::sort(ranges.begin(), ranges.end());
+            
+            std::vector<uint64_t> groupSizes;
+            uint64_t nextIndex = 0;
+            for (auto const& range : ranges) {
+                if (range.first >= nextIndex) {
+                    // DD variables that do not belong to a meta variable are sifted in pairs.
+                    for (; nextIndex < range.first; nextIndex += 2) {
+                        groupSizes.push_back(2);
+                    }
+                    groupSizes.push_back(range.second - range.first + 1);
+                    nextIndex = range.second + 1;
+                } else if (range.second >= nextIndex) {
+                    groupSizes.back() += range.second - nextIndex + 1;
+                    nextIndex = range.second + 1;
+                }
+            }
+            for (; nextIndex < numberOfDdVariables; nextIndex += 2) {
+                groupSizes.push_back(std::min<uint64_t>(2, numberOfDdVariables - nextIndex));
+            }
+            
+            internalDdManager.triggerReordering(groupSizes);
+            
+            // As the DDs of the meta variables were rebuilt, we need to update the information derived from their indices.
+            for (auto& metaVariable : metaVariableMap) {
+                metaVariable.second.precomputeLowestIndex();
+            }
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::reorderIfNecessary() {
+            if (internalDdManager.isReorderingNecessary()) {
+                this->triggerReordering();
+            }
+        }
+        
+        template<DdType LibraryType>
+        uint_fast64_t DdManager<LibraryType>::getNumberOfReorderings() const {
+            return internalDdManager.getNumberOfReorderings();
+        }
+        
+        template<DdType LibraryType>
+        void DdManager<LibraryType>::executeConcurrently(std::vector<std::function<void()>> const& functions) const {
+            internalDdManager.executeConcurrently(functions);
+        }
+        
         template<DdType LibraryType>
         std::set<storm::expressions::Variable> DdManager<LibraryType>::getAllMetaVariables() const {
             std::set<storm::expressions::Variable> result;
@@ -1,7 +1,9 @@
 #ifndef STORM_STORAGE_DD_DDMANAGER_H_
 #define STORM_STORAGE_DD_DDMANAGER_H_
 
+#include <functional>
 #include <set>
+#include <vector>
 #include <unordered_map>
 #include <boost/optional.hpp>
 
@@ -270,6 +272,30 @@ namespace storm {
              */
             void triggerReordering();
             
+            /*!
+             * Triggers a reordering of the DDs managed by this manager if dynamic reordering is allowed and the DD
+             * library does not reorder on its own, but the DDs grew considerably since the last reordering. This may
+             * only be called at points where all DDs in use are held by Dd objects (e.g. not within a DD operation).
+             */
+            void reorderIfNecessary();
+            
+            /*!
+             * Retrieves the number of reorderings that were performed so far. As reorderings may change the indices
+             * of the DD variables, information that depends on them (like ODDs) needs to be recomputed whenever this
+             * number changed.
+             *
+             * @return The number of reorderings.
+             */
+            uint_fast64_t getNumberOfReorderings() const;
+            
+            /*!
+             * Executes the given functions. If the DD library is thread-safe, this is done concurrently, so the
+             * functions may perform DD operations in parallel. Otherwise, they are executed one after another.
+             *
+             * @param functions The functions to execute.
+             */
+            void executeConcurrently(std::vector<std::function<void()>> const& functions) const;
+            
             /*!
              * Retrieves the meta variable with the given name if it exists.
              *
@@ -386,6 +412,9 @@ namespace storm {
             // The manager responsible for the variables.
             std::shared_ptr<storm::expressions::ExpressionManager> manager;
         };
+        
+        template<>
+        void DdManager<DdType::Sylvan>::triggerReordering();
     }
 }
 
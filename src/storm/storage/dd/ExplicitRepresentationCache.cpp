@@ -0,0 +1,164 @@
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ModelCheckerSettings.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace dd {
+
+        template<typename ValueType>
+        uint_fast64_t getEstimatedSizeInMemory(storm::storage::SparseMatrix<ValueType> const& matrix) {
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type index_type;
+            uint_fast64_t result = matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<index_type, ValueType>) + (matrix.getRowCount() + 1) * sizeof(index_type);
+            if (!matrix.hasTrivialRowGrouping()) {
+                result += (matrix.getRowGroupCount() + 1) * sizeof(index_type);
+            }
+            return result;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        ExplicitRepresentationCache<LibraryType, ValueType>::ExplicitRepresentationCache() : ExplicitRepresentationCache(storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>().getExplicitRepresentationCacheSize() * 1024 * 1024) {
+            // Intentionally left empty.
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        ExplicitRepresentationCache<LibraryType, ValueType>::ExplicitRepresentationCache(uint_fast64_t budget) : budget(budget), size(0), numberOfReorderings(0), numberOfHits(0), numberOfMisses(0) {
+            // Intentionally left empty.
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        storm::dd::Odd ExplicitRepresentationCache<LibraryType, ValueType>::getOdd(storm::dd::Bdd<LibraryType> const& states) {
+            dropEntriesIfReordered(states.getDdManager());
+            for (auto it = odds.begin(), ite = odds.end(); it != ite; ++it) {
+                if (it->states == states) {
+                    ++numberOfHits;
+                    odds.splice(odds.begin(), odds, it);
+                    return odds.front().odd;
+                }
+            }
+
+            ++numberOfMisses;
+            storm::dd::Odd odd = states.createOdd();
+            if (budget > 0) {
+                uint_fast64_t oddSize = odd.getNodeCount() * sizeof(storm::dd::Odd);
+                odds.push_front(CachedOdd{states, odd, oddSize});
+                size += oddSize;
+                enforceBudget();
+            }
+            return odd;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> ExplicitRepresentationCache<LibraryType, ValueType>::getMatrix(storm::dd::Add<LibraryType, ValueType> const& matrix, storm::dd::Bdd<LibraryType> const& states, std::function<storm::storage::SparseMatrix<ValueType>()> const& translate) {
+            dropEntriesIfReordered(states.getDdManager());
+            for (auto it = matrices.begin(), ite = matrices.end(); it != ite; ++it) {
+                if (it->matrix == matrix && it->states == states) {
+                    ++numberOfHits;
+                    STORM_LOG_INFO("Reusing cached explicit representation of symbolic matrix.");
+                    matrices.splice(matrices.begin(), matrices, it);
+                    return matrices.front().explicitMatrix;
+                }
+            }
+
+            ++numberOfMisses;
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> result = std::make_shared<storm::storage::SparseMatrix<ValueType>>(translate());
+            if (budget > 0) {
+                uint_fast64_t matrixSize = getEstimatedSizeInMemory(*result);
+                matrices.push_front(CachedMatrix{matrix, states, result, matrixSize});
+                size += matrixSize;
+                enforceBudget();
+            }
+            return result;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        storm::storage::SparseMatrix<ValueType> ExplicitRepresentationCache<LibraryType, ValueType>::releaseMatrix(std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>&& matrix) const {
+            if (matrix.use_count() == 1) {
+                // The matrix was not cached, so nobody else refers to it. As it was created as a non-const object by
+                // getMatrix, we can take it over.
+                storm::storage::SparseMatrix<ValueType> result = std::move(const_cast<storm::storage::SparseMatrix<ValueType>&>(*matrix));
+                matrix.reset();
+                return result;
+            }
+            return *matrix;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        bool ExplicitRepresentationCache<LibraryType, ValueType>::isCached(std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& matrix) const {
+            for (auto const& entry : matrices) {
+                if (entry.explicitMatrix == matrix) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        void ExplicitRepresentationCache<LibraryType, ValueType>::setBudget(uint_fast64_t newBudget) {
+            budget = newBudget;
+            enforceBudget();
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        void ExplicitRepresentationCache<LibraryType, ValueType>::enforceBudget() {
+            // Matrices are typically much larger than ODDs, so we drop them first.
+            while (size > budget && !matrices.empty()) {
+                size -= matrices.back().size;
+                matrices.pop_back();
+            }
+            while (size > budget && !odds.empty()) {
+                size -= odds.back().size;
+                odds.pop_back();
+            }
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        void ExplicitRepresentationCache<LibraryType, ValueType>::dropEntriesIfReordered(storm::dd::DdManager<LibraryType> const& manager) {
+            if (manager.getNumberOfReorderings() != numberOfReorderings) {
+                STORM_LOG_DEBUG("Dropping cached explicit representations, because the DD variables were reordered.");
+                clear();
+                numberOfReorderings = manager.getNumberOfReorderings();
+            }
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        void ExplicitRepresentationCache<LibraryType, ValueType>::clear() {
+            odds.clear();
+            matrices.clear();
+            size = 0;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        uint_fast64_t ExplicitRepresentationCache<LibraryType, ValueType>::getNumberOfHits() const {
+            return numberOfHits;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        uint_fast64_t ExplicitRepresentationCache<LibraryType, ValueType>::getNumberOfMisses() const {
+            return numberOfMisses;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        uint_fast64_t ExplicitRepresentationCache<LibraryType, ValueType>::getSizeInMemory() const {
+            return size;
+        }
+
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        void ExplicitRepresentationCache<LibraryType, ValueType>::printStatistics(std::ostream& out) const {
+            out << "Explicit representation cache: " << numberOfHits << " hits, " << numberOfMisses << " misses, " << odds.size() << " ODDs and " << matrices.size() << " matrices cached (" << (size / 1024) << "KB)." << std::endl;
+        }
+
+        template class ExplicitRepresentationCache<storm::dd::DdType::CUDD, double>;
+        template class ExplicitRepresentationCache<storm::dd::DdType::Sylvan, double>;
+
+        template class ExplicitRepresentationCache<storm::dd::DdType::Sylvan, storm::RationalNumber>;
+        template class ExplicitRepresentationCache<storm::dd::DdType::Sylvan, storm::RationalFunction>;
+
+    }
+}
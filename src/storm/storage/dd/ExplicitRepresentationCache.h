@@ -0,0 +1,151 @@
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <ostream>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Add.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/dd/Odd.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace dd {
+
+        /*!
+         * A cache for explicit representations (ODDs and sparse matrices) obtained from symbolic ones. ODDs are
+         * identified by the BDD of the states they represent and matrices by their symbolic representation together
+         * with the BDD of the states that are used to index rows and columns. As decision diagrams are canonical,
+         * checking whether a representation is cached only requires a comparison of DD nodes.
+         *
+         * The cache has a memory budget. Whenever it is exceeded, the least recently used representations are dropped.
+         * Note that this cache holds references to the DDs of the keys, so it must not outlive their DD manager.
+         */
+        template<storm::dd::DdType LibraryType, typename ValueType>
+        class ExplicitRepresentationCache {
+        public:
+            /*!
+             * Creates a cache whose memory budget is taken from the settings.
+             */
+            ExplicitRepresentationCache();
+
+            /*!
+             * Creates a cache with the given memory budget.
+             *
+             * @param budget The number of bytes that may be used for the explicit representations. If zero, no
+             * representations are cached at all.
+             */
+            ExplicitRepresentationCache(uint_fast64_t budget);
+
+            /*!
+             * Retrieves the ODD for the given states. If it is not yet cached, it is created.
+             *
+             * @param states The states for which to retrieve the ODD.
+             * @return The ODD of the states.
+             */
+            storm::dd::Odd getOdd(storm::dd::Bdd<LibraryType> const& states);
+
+            /*!
+             * Retrieves the explicit representation of the given symbolic matrix whose row and column indices are given
+             * by the ODD of the given states. If it is not yet cached, it is created using the given translation
+             * function.
+             *
+             * @param matrix The symbolic representation of the matrix.
+             * @param states The states indexing the rows and columns of the matrix.
+             * @param translate A function that translates the symbolic matrix to its explicit representation.
+             * @return The explicit matrix.
+             */
+            std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getMatrix(storm::dd::Add<LibraryType, ValueType> const& matrix, storm::dd::Bdd<LibraryType> const& states, std::function<storm::storage::SparseMatrix<ValueType>()> const& translate);
+
+            /*!
+             * Turns the given explicit matrix (as obtained from getMatrix) into a matrix that may be handed over to a
+             * consumer that needs to own it, e.g. a linear equation solver. If the matrix is not cached (and the given
+             * pointer is its only reference), it is moved, otherwise it is copied.
+             */
+            storm::storage::SparseMatrix<ValueType> releaseMatrix(std::shared_ptr<storm::storage::SparseMatrix<ValueType> const>&& matrix) const;
+
+            /*!
+             * Retrieves whether the given explicit matrix (as obtained from getMatrix) is held by the cache. If so,
+             * consumers should refer to it rather than take it over via releaseMatrix, as that would copy it.
+             */
+            bool isCached(std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> const& matrix) const;
+
+            /*!
+             * Sets the memory budget of the cache and drops entries until it is respected.
+             *
+             * @param newBudget The number of bytes that may be used for the explicit representations. If zero, no
+             * representations are cached at all.
+             */
+            void setBudget(uint_fast64_t newBudget);
+
+            /*!
+             * Drops all cached representations.
+             */
+            void clear();
+
+            /*!
+             * Retrieves the number of lookups that could be answered from the cache.
+             */
+            uint_fast64_t getNumberOfHits() const;
+
+            /*!
+             * Retrieves the number of lookups that required creating a new explicit representation.
+             */
+            uint_fast64_t getNumberOfMisses() const;
+
+            /*!
+             * Retrieves the (estimated) number of bytes occupied by the cached explicit representations.
+             */
+            uint_fast64_t getSizeInMemory() const;
+
+            /*!
+             * Prints statistics about the usage of the cache to the given stream.
+             */
+            void printStatistics(std::ostream& out) const;
+
+        private:
+            struct CachedOdd {
+                storm::dd::Bdd<LibraryType> states;
+                storm::dd::Odd odd;
+                uint_fast64_t size;
+            };
+
+            struct CachedMatrix {
+                storm::dd::Add<LibraryType, ValueType> matrix;
+                storm::dd::Bdd<LibraryType> states;
+                std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> explicitMatrix;
+                uint_fast64_t size;
+            };
+
+            /*!
+             * Drops least recently used entries until the cache respects its budget.
+             */
+            void enforceBudget();
+
+            /*!
+             * Drops all entries if the DD variables were reordered since they were cached, because the ODDs (and
+             * thereby the explicit matrices) depend on the variable order.
+             */
+            void dropEntriesIfReordered(storm::dd::DdManager<LibraryType> const& manager);
+
+            // The number of bytes that may be occupied by the cached explicit representations.
+            uint_fast64_t budget;
+
+            // The number of bytes that are currently occupied.
+            uint_fast64_t size;
+
+            // The cached ODDs and matrices. The most recently used entries are at the front.
+            std::list<CachedOdd> odds;
+            std::list<CachedMatrix> matrices;
+
+            // The number of reorderings of the DD manager at the time the entries were cached.
+            uint_fast64_t numberOfReorderings;
+
+            uint_fast64_t numberOfHits;
+            uint_fast64_t numberOfMisses;
+        };
+
+    }
+}
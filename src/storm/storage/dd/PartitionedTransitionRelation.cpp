@@ -0,0 +1,97 @@
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
+
+#include "storm/storage/dd/DdManager.h"
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace dd {
+
+        template<storm::dd::DdType Type>
+        PartitionedTransitionRelation<Type>::PartitionedTransitionRelation(storm::dd::Bdd<Type> const& relation, std::vector<storm::dd::Bdd<Type>> const& partitions, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) : relation(relation), rowColumnMetaVariablePairs(rowColumnMetaVariablePairs) {
+            storm::dd::DdManager<Type> const& manager = relation.getDdManager();
+            for (auto const& partition : partitions) {
+                if (partition.isZero()) {
+                    continue;
+                }
+
+                Partition reducedPartition;
+                reducedPartition.relation = partition;
+                for (auto const& pair : rowColumnMetaVariablePairs) {
+                    // If the partition does not mention one of the variables, it does not constrain its value, so we
+                    // must not treat the variable as unchanged.
+                    if (partition.containsMetaVariable(pair.first) && partition.containsMetaVariable(pair.second)) {
+                        storm::dd::Bdd<Type> abstracted = reducedPartition.relation.existsAbstract({pair.first, pair.second});
+                        if ((abstracted && manager.getIdentity(pair.first, pair.second)) == reducedPartition.relation) {
+                            reducedPartition.relation = abstracted;
+                            continue;
+                        }
+                    }
+                    reducedPartition.rowMetaVariables.insert(pair.first);
+                    reducedPartition.columnMetaVariables.insert(pair.second);
+                    reducedPartition.rowColumnMetaVariablePairs.push_back(pair);
+                }
+                STORM_LOG_TRACE("Partition changes " << reducedPartition.rowColumnMetaVariablePairs.size() << " of " << rowColumnMetaVariablePairs.size() << " variables.");
+                this->partitions.push_back(std::move(reducedPartition));
+            }
+        }
+
+        template<storm::dd::DdType Type>
+        bool PartitionedTransitionRelation<Type>::represents(storm::dd::Bdd<Type> const& relation) const {
+            return this->relation == relation;
+        }
+
+        template<storm::dd::DdType Type>
+        storm::dd::Bdd<Type> PartitionedTransitionRelation<Type>::toBdd() const {
+            storm::dd::DdManager<Type> const& manager = relation.getDdManager();
+            storm::dd::Bdd<Type> result = manager.getBddZero();
+            for (auto const& partition : partitions) {
+                storm::dd::Bdd<Type> partitionBdd = partition.relation;
+                for (auto const& pair : rowColumnMetaVariablePairs) {
+                    if (partition.rowMetaVariables.find(pair.first) == partition.rowMetaVariables.end()) {
+                        partitionBdd &= manager.getIdentity(pair.first, pair.second);
+                    }
+                }
+                result |= partitionBdd;
+            }
+            return result;
+        }
+
+        template<storm::dd::DdType Type>
+        storm::dd::Bdd<Type> PartitionedTransitionRelation<Type>::image(storm::dd::Bdd<Type> const& states) const {
+            storm::dd::Bdd<Type> result = states.getDdManager().getBddZero();
+            for (auto const& partition : partitions) {
+                // Only the changed variables are quantified and renamed, the other ones keep their value.
+                result |= states.andExists(partition.relation, partition.rowMetaVariables).swapVariables(partition.rowColumnMetaVariablePairs);
+            }
+            return result;
+        }
+
+        template<storm::dd::DdType Type>
+        storm::dd::Bdd<Type> PartitionedTransitionRelation<Type>::preimage(storm::dd::Bdd<Type> const& states) const {
+            storm::dd::Bdd<Type> result = states.getDdManager().getBddZero();
+            for (auto const& partition : partitions) {
+                result |= states.swapVariables(partition.rowColumnMetaVariablePairs).andExists(partition.relation, partition.columnMetaVariables);
+            }
+            return result;
+        }
+
+        template<storm::dd::DdType Type>
+        uint64_t PartitionedTransitionRelation<Type>::getNumberOfPartitions() const {
+            return partitions.size();
+        }
+
+        template<storm::dd::DdType Type>
+        uint64_t PartitionedTransitionRelation<Type>::getNodeCount() const {
+            uint64_t result = 0;
+            for (auto const& partition : partitions) {
+                result += partition.relation.getNodeCount();
+            }
+            return result;
+        }
+
+        template class PartitionedTransitionRelation<storm::dd::DdType::CUDD>;
+        template class PartitionedTransitionRelation<storm::dd::DdType::Sylvan>;
+
+    }
+}
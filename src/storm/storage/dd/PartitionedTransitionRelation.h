@@ -0,0 +1,98 @@
+#pragma once
+
+#include <set>
+#include <vector>
+
+#include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/Bdd.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace dd {
+
+        /*!
+         * A transition relation that is kept as a disjunction of partitions (e.g. the transitions of the individual
+         * actions) instead of a single monolithic BDD. For every partition, the variable pairs that the partition
+         * keeps unchanged are quantified away when the partition is created. Images and pre-images then only rename
+         * and quantify the variables that are actually changed by a partition, so the identities of the unchanged
+         * variables (and the product of all partitions) never have to be built.
+         */
+        template<storm::dd::DdType Type>
+        class PartitionedTransitionRelation {
+        public:
+            /*!
+             * Creates a partitioned transition relation.
+             *
+             * @param relation The (monolithic) relation that is represented by the disjunction of the partitions. It is
+             * only used to identify the relation, see represents().
+             * @param partitions The partitions of the relation (over row and column variables).
+             * @param rowColumnMetaVariablePairs The pairs of row and column meta variables.
+             */
+            PartitionedTransitionRelation(storm::dd::Bdd<Type> const& relation, std::vector<storm::dd::Bdd<Type>> const& partitions, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
+            /*!
+             * Retrieves whether this partitioned relation represents the given (monolithic) relation.
+             *
+             * @param relation The relation to check.
+             * @return True iff the partitions were created for the given relation.
+             */
+            bool represents(storm::dd::Bdd<Type> const& relation) const;
+
+            /*!
+             * Retrieves the disjunction of the partitions in which the identities of the variables left unchanged by a
+             * partition are restored. This builds the monolithic relation, so it is mainly intended for checking that
+             * the partitions are correct.
+             *
+             * @return The relation represented by the partitions (over row and column variables).
+             */
+            storm::dd::Bdd<Type> toBdd() const;
+
+            /*!
+             * Computes the successors of the given states.
+             *
+             * @param states The states (over row variables) whose successors to compute.
+             * @return The successors (over row variables).
+             */
+            storm::dd::Bdd<Type> image(storm::dd::Bdd<Type> const& states) const;
+
+            /*!
+             * Computes the predecessors of the given states.
+             *
+             * @param states The states (over row variables) whose predecessors to compute.
+             * @return The predecessors (over row variables).
+             */
+            storm::dd::Bdd<Type> preimage(storm::dd::Bdd<Type> const& states) const;
+
+            /*!
+             * Retrieves the number of (non-empty) partitions.
+             */
+            uint64_t getNumberOfPartitions() const;
+
+            /*!
+             * Retrieves the number of DD nodes of all (reduced) partitions.
+             */
+            uint64_t getNodeCount() const;
+
+        private:
+            struct Partition {
+                // The relation of the partition without the variables it keeps unchanged.
+                storm::dd::Bdd<Type> relation;
+
+                // The row and column variables changed by the partition.
+                std::set<storm::expressions::Variable> rowMetaVariables;
+                std::set<storm::expressions::Variable> columnMetaVariables;
+                std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+            };
+
+            // The relation that is represented.
+            storm::dd::Bdd<Type> relation;
+
+            // The (reduced) partitions.
+            std::vector<Partition> partitions;
+
+            // The pairs of row and column meta variables of the relation.
+            std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> rowColumnMetaVariablePairs;
+        };
+
+    }
+}
@@ -1,11 +1,17 @@
 #include "storm/storage/dd/bisimulation/PartitionRefiner.h"
 
+#include <functional>
+
 #include "storm/models/symbolic/StandardRewardModel.h"
 
 #include "storm/storage/dd/DdManager.h"
 
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/BisimulationSettings.h"
+
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     namespace dd {
@@ -13,7 +19,16 @@ namespace storm {
             
             template <storm::dd::DdType DdType, typename ValueType>
             PartitionRefiner<DdType, ValueType>::PartitionRefiner(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& initialStatePartition) : status(Status::Initialized), refinements(0), statePartition(initialStatePartition), signatureComputer(model), signatureRefiner(model.getManager(), statePartition.getBlockVariable(), model.getRowAndNondeterminismVariables(), model.getColumnVariables(), !model.isNondeterministicModel(), model.getNondeterminismVariables()), totalSignatureTime(0), totalRefinementTime(0) {
-                // Intentionally left empty.
+                auto const& bisimulationSettings = storm::settings::getModule<storm::settings::modules::BisimulationSettings>();
+                
+                // The changed states of a refinement are only known for the last group of blocks, so grouping is not
+                // possible if they are required.
+                if (bisimulationSettings.getRefinementMode() == storm::settings::modules::BisimulationSettings::RefinementMode::ChangedStates) {
+                    numberOfBlockGroups = 1;
+                } else {
+                    numberOfBlockGroups = bisimulationSettings.getNumberOfBlockGroups();
+                }
+                collectStatistics = bisimulationSettings.isShowRefinementStatisticsSet();
             }
             
             template <storm::dd::DdType DdType, typename ValueType>
@@ -37,36 +52,64 @@ namespace storm {
                     
                     signatureComputer.setSignatureMode(mode);
                     
-                    std::chrono::milliseconds::rep signatureTime = 0;
-                    std::chrono::milliseconds::rep refinementTime = 0;
+                    RefinementStepStatistics statistics = {refinements, 0, 0, oldPartition.getNumberOfBlocks(), 0, std::chrono::high_resolution_clock::duration(0), std::chrono::high_resolution_clock::duration(0)};
+                    
+                    // The blocks of the old partition are split into groups and the signatures are computed and refined
+                    // group by group. As the groups consist of whole blocks, refining the partition wrt. the signatures
+                    // of one group leaves the blocks of the other groups untouched.
+                    std::vector<SignatureIterator<DdType, ValueType>> signatureIterators;
+                    for (auto const& rows : getBlockGroupRows(oldPartition)) {
+                        signatureIterators.emplace_back(signatureComputer.compute(targetPartition, rows));
+                    }
+                    storm::dd::DdManager<DdType> const& manager = oldPartition.storedAsBdd() ? oldPartition.asBdd().getDdManager() : oldPartition.asAdd().getDdManager();
                     
                     bool refined = false;
                     uint64_t index = 0;
                     Partition<DdType, ValueType> newPartition;
-                    auto signatureIterator = signatureComputer.compute(targetPartition);
-                    while (signatureIterator.hasNext() && !refined) {
+                    while (signatureIterators.front().hasNext() && !refined) {
+                        // The signatures of the groups are independent of each other, so they are computed concurrently
+                        // (if the DD library permits this). The refiner, however, refines the groups one after another.
+                        std::vector<Signature<DdType, ValueType>> signatures(signatureIterators.size());
+                        std::vector<std::function<void()>> signatureTasks;
+                        for (uint64_t group = 0; group < signatureIterators.size(); ++group) {
+                            signatureTasks.emplace_back([&signatureIterators, &signatures, group] () {
+                                signatures[group] = signatureIterators[group].next();
+                            });
+                        }
                         auto signatureStart = std::chrono::high_resolution_clock::now();
-                        auto signature = signatureIterator.next();
+                        manager.executeConcurrently(signatureTasks);
                         auto signatureEnd = std::chrono::high_resolution_clock::now();
-                        totalSignatureTime += (signatureEnd - signatureStart);
-                        STORM_LOG_TRACE("Signature " << refinements << "[" << index << "] DD has " << signature.getSignatureAdd().getNodeCount() << " nodes.");
-                                                
-                        auto refinementStart = std::chrono::high_resolution_clock::now();
-                        newPartition = signatureRefiner.refine(oldPartition, signature);
-                        auto refinementEnd = std::chrono::high_resolution_clock::now();
-                        totalRefinementTime += (refinementEnd - refinementStart);
+                        statistics.signatureTime += (signatureEnd - signatureStart);
                         
-                        signatureTime += std::chrono::duration_cast<std::chrono::milliseconds>(signatureEnd - signatureStart).count();
-                        refinementTime = std::chrono::duration_cast<std::chrono::milliseconds>(refinementEnd - refinementStart).count();
+                        newPartition = oldPartition;
+                        for (auto const& signature : signatures) {
+                            STORM_LOG_TRACE("Signature " << refinements << "[" << index << "] DD has " << signature.getSignatureAdd().getNodeCount() << " nodes.");
+                            if (collectStatistics) {
+                                ++statistics.numberOfSignatures;
+                                statistics.maximalSignatureNodeCount = std::max<uint64_t>(statistics.maximalSignatureNodeCount, signature.getSignatureAdd().getNodeCount());
+                            }
+                            
+                            auto refinementStart = std::chrono::high_resolution_clock::now();
+                            newPartition = signatureRefiner.refine(newPartition, signature);
+                            auto refinementEnd = std::chrono::high_resolution_clock::now();
+                            statistics.refinementTime += (refinementEnd - refinementStart);
+                        }
+                        ++index;
                         
                         // Potentially exit early in case we have refined the partition already.
                         if (newPartition.getNumberOfBlocks() > oldPartition.getNumberOfBlocks()) {
                             refined = true;
                         }
                     }
+                    totalSignatureTime += statistics.signatureTime;
+                    totalRefinementTime += statistics.refinementTime;
                     
                     auto totalTimeInRefinement = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count();
-                    STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in " << totalTimeInRefinement << "ms (signature: " << signatureTime << "ms, refinement: " << refinementTime << "ms).");
+                    STORM_LOG_INFO("Refinement " << refinements << " produced " << newPartition.getNumberOfBlocks() << " blocks and was completed in " << totalTimeInRefinement << "ms (signature: " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.signatureTime).count() << "ms, refinement: " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.refinementTime).count() << "ms).");
+                    if (collectStatistics) {
+                        statistics.numberOfBlocksAfter = newPartition.getNumberOfBlocks();
+                        refinementStatistics.push_back(statistics);
+                    }
                     ++refinements;
                     return newPartition;
                 } else {
@@ -83,10 +126,56 @@ namespace storm {
                 auto refinementEnd = std::chrono::high_resolution_clock::now();
                 totalRefinementTime += (refinementEnd - refinementStart);
 
+                if (collectStatistics) {
+                    refinementStatistics.push_back(RefinementStepStatistics{refinements, 1, signature.getSignatureAdd().getNodeCount(), oldPartition.getNumberOfBlocks(), newPartition.getNumberOfBlocks(), std::chrono::high_resolution_clock::duration(0), refinementEnd - refinementStart});
+                }
                 ++refinements;
                 return newPartition;
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            std::vector<boost::optional<storm::dd::Bdd<DdType>>> PartitionRefiner<DdType, ValueType>::getBlockGroupRows(Partition<DdType, ValueType> const& partition) const {
+                std::vector<boost::optional<storm::dd::Bdd<DdType>>> result;
+                
+                // The groups are formed by the most significant bits of the (used) block indices.
+                uint64_t numberOfUsedBits = 0;
+                while (numberOfUsedBits < 64 && (1ull << numberOfUsedBits) < partition.getNextFreeBlockIndex()) {
+                    ++numberOfUsedBits;
+                }
+                uint64_t numberOfGroupBits = 0;
+                while (numberOfGroupBits < numberOfUsedBits && (2ull << numberOfGroupBits) <= numberOfBlockGroups) {
+                    ++numberOfGroupBits;
+                }
+                if (numberOfGroupBits == 0) {
+                    result.push_back(boost::none);
+                    return result;
+                }
+                
+                storm::dd::Bdd<DdType> partitionBdd = partition.storedAsBdd() ? partition.asBdd() : partition.asAdd().notZero();
+                storm::dd::DdManager<DdType> const& manager = partitionBdd.getDdManager();
+                std::vector<storm::dd::Bdd<DdType>> const& blockDdVariables = manager.getMetaVariable(partition.getBlockVariable()).getDdVariables();
+                STORM_LOG_ASSERT(numberOfUsedBits <= blockDdVariables.size(), "Block indices exceed the range of the block variable.");
+                uint64_t firstGroupBit = blockDdVariables.size() - numberOfUsedBits;
+                
+                for (uint64_t group = 0; group < (1ull << numberOfGroupBits); ++group) {
+                    storm::dd::Bdd<DdType> groupBlocks = manager.getBddOne();
+                    for (uint64_t bit = 0; bit < numberOfGroupBits; ++bit) {
+                        // The block DD variables are ordered from the most significant to the least significant bit.
+                        if (group & (1ull << (numberOfGroupBits - bit - 1))) {
+                            groupBlocks &= blockDdVariables[firstGroupBit + bit];
+                        } else {
+                            groupBlocks &= !blockDdVariables[firstGroupBit + bit];
+                        }
+                    }
+                    storm::dd::Bdd<DdType> rows = partitionBdd.andExists(groupBlocks, {partition.getBlockVariable()});
+                    if (!rows.isZero()) {
+                        result.push_back(rows);
+                    }
+                }
+                STORM_LOG_TRACE("Computing signatures for " << result.size() << " groups of blocks.");
+                return result;
+            }
+            
             template <storm::dd::DdType DdType, typename ValueType>
             bool PartitionRefiner<DdType, ValueType>::refineWrtRewardModel(storm::models::symbolic::StandardRewardModel<DdType, ValueType> const& rewardModel) {
                 STORM_LOG_THROW(!rewardModel.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Symbolic bisimulation currently does not support transition rewards.");
@@ -145,6 +234,30 @@ namespace storm {
                 return totalRefinementTime;
             }
             
+            template <storm::dd::DdType DdType, typename ValueType>
+            void PartitionRefiner<DdType, ValueType>::setNumberOfBlockGroups(uint64_t numberOfBlockGroups) {
+                STORM_LOG_THROW(numberOfBlockGroups > 0, storm::exceptions::InvalidArgumentException, "The number of block groups must be positive.");
+                this->numberOfBlockGroups = numberOfBlockGroups;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void PartitionRefiner<DdType, ValueType>::setCollectStatistics(bool value) {
+                this->collectStatistics = value;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            std::vector<RefinementStepStatistics> const& PartitionRefiner<DdType, ValueType>::getRefinementStatistics() const {
+                return refinementStatistics;
+            }
+            
+            template <storm::dd::DdType DdType, typename ValueType>
+            void PartitionRefiner<DdType, ValueType>::printRefinementStatistics(std::ostream& out) const {
+                out << "Refinement statistics (" << refinementStatistics.size() << " steps):" << std::endl;
+                for (auto const& statistics : refinementStatistics) {
+                    out << "  refinement " << statistics.refinement << ": " << statistics.numberOfSignatures << " signature(s) with at most " << statistics.maximalSignatureNodeCount << " nodes, " << statistics.numberOfBlocksBefore << " -> " << statistics.numberOfBlocksAfter << " blocks (" << (statistics.numberOfBlocksAfter - statistics.numberOfBlocksBefore) << " new), signature: " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.signatureTime).count() << "ms, refinement: " << std::chrono::duration_cast<std::chrono::milliseconds>(statistics.refinementTime).count() << "ms" << std::endl;
+                }
+            }
+            
             template class PartitionRefiner<storm::dd::DdType::CUDD, double>;
             
             template class PartitionRefiner<storm::dd::DdType::Sylvan, double>;
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <ostream>
+#include <vector>
+
 #include "storm/storage/dd/bisimulation/Status.h"
 #include "storm/storage/dd/bisimulation/Partition.h"
 
@@ -17,6 +21,29 @@ namespace storm {
     namespace dd {
         namespace bisimulation {
             
+            /*!
+             * Statistics of a single refinement step, i.e. the refinement of a partition wrt. the signatures of one
+             * (target) partition.
+             */
+            struct RefinementStepStatistics {
+                // The index of the refinement step.
+                uint64_t refinement;
+                
+                // The number of signatures that were computed (e.g. one per group of blocks).
+                uint64_t numberOfSignatures;
+                
+                // The largest number of nodes of a signature DD.
+                uint64_t maximalSignatureNodeCount;
+                
+                // The number of blocks before and after the refinement step.
+                uint64_t numberOfBlocksBefore;
+                uint64_t numberOfBlocksAfter;
+                
+                // The time spent on computing the signatures and refining the partition, respectively.
+                std::chrono::high_resolution_clock::duration signatureTime;
+                std::chrono::high_resolution_clock::duration refinementTime;
+            };
+            
             template <storm::dd::DdType DdType, typename ValueType>
             class PartitionRefiner {
             public:
@@ -56,10 +83,40 @@ namespace storm {
                 std::chrono::high_resolution_clock::duration getTotalSignatureTime() const;
                 std::chrono::high_resolution_clock::duration getTotalRefinementTime() const;
                 
+                /*!
+                 * Sets the number of groups of blocks whose signatures are computed and refined separately. The
+                 * signatures of the groups are computed concurrently if the DD library supports it. The actual number
+                 * of groups is the largest power of two not exceeding the given number (and the number of blocks). A
+                 * value of one disables the grouping.
+                 */
+                void setNumberOfBlockGroups(uint64_t numberOfBlockGroups);
+                
+                /*!
+                 * Sets whether statistics are collected for every refinement step.
+                 */
+                void setCollectStatistics(bool value);
+                
+                /*!
+                 * Retrieves the statistics of the refinement steps performed so far. These are only available if the
+                 * collection of statistics is enabled.
+                 */
+                std::vector<RefinementStepStatistics> const& getRefinementStatistics() const;
+                
+                /*!
+                 * Prints the statistics of the refinement steps to the given stream.
+                 */
+                void printRefinementStatistics(std::ostream& out) const;
+                
             protected:
                 Partition<DdType, ValueType> internalRefine(SignatureComputer<DdType, ValueType>& stateSignatureComputer, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition, Partition<DdType, ValueType> const& targetPartition, SignatureMode const& mode = SignatureMode::Eager);
                 Partition<DdType, ValueType> internalRefine(Signature<DdType, ValueType> const& signature, SignatureRefiner<DdType, ValueType>& signatureRefiner, Partition<DdType, ValueType> const& oldPartition);
 
+                /*!
+                 * Retrieves the rows (states or choices) of the groups of blocks of the given partition. If no grouping
+                 * is to be performed, the result only contains boost::none, i.e. all rows.
+                 */
+                std::vector<boost::optional<storm::dd::Bdd<DdType>>> getBlockGroupRows(Partition<DdType, ValueType> const& partition) const;
+                
                 virtual bool refineWrtStateRewards(storm::dd::Add<DdType, ValueType> const& stateRewards);
                 virtual bool refineWrtStateActionRewards(storm::dd::Add<DdType, ValueType> const& stateActionRewards);
                 
@@ -81,6 +138,13 @@ namespace storm {
                 // Time measurements.
                 std::chrono::high_resolution_clock::duration totalSignatureTime;
                 std::chrono::high_resolution_clock::duration totalRefinementTime;
+                
+                // The number of groups of blocks whose signatures are computed and refined separately.
+                uint64_t numberOfBlockGroups;
+                
+                // Whether statistics are collected for every refinement step and the collected statistics.
+                bool collectStatistics;
+                std::vector<RefinementStepStatistics> refinementStatistics;
             };
             
         }
@@ -297,40 +297,47 @@ namespace storm {
                 virtual std::vector<ValueType> extractVectorInternal(storm::dd::Add<DdType, ValueType> const& vector, storm::dd::Bdd<DdType> const& variablesCube, storm::dd::Odd const& odd) = 0;
                 
                 storm::storage::SparseMatrix<ValueType> createMatrixFromEntries() {
+                    // Sort the rows and merge the remaining entries that lead to the same block, so we know the exact
+                    // number of entries of the quotient matrix.
+                    uint64_t numberOfEntries = 0;
                     for (auto& row : matrixEntries) {
                         std::sort(row.begin(), row.end(),
                                   [] (storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& a, storm::storage::MatrixEntry<uint_fast64_t, ValueType> const& b) {
                                       return a.getColumn() < b.getColumn();
                                   });
+                        mergeDuplicateEntries(row);
+                        numberOfEntries += row.size();
                     }
                     
-                    rowPermutation = std::vector<uint64_t>(matrixEntries.size());
-                    std::iota(rowPermutation.begin(), rowPermutation.end(), 0ull);
                     if (this->isNondeterministic) {
+                        rowPermutation = std::vector<uint64_t>(matrixEntries.size());
+                        std::iota(rowPermutation.begin(), rowPermutation.end(), 0ull);
                         std::stable_sort(rowPermutation.begin(), rowPermutation.end(), [this] (uint64_t first, uint64_t second) { return this->rowToState[first] < this->rowToState[second]; } );
                     }
                     
                     uint64_t rowCounter = 0;
                     uint64_t lastState = this->isNondeterministic ? rowToState[rowPermutation.front()] : 0;
-                    storm::storage::SparseMatrixBuilder<ValueType> builder(matrixEntries.size(), this->numberOfBlocks, 0, true, this->isNondeterministic);
+                    storm::storage::SparseMatrixBuilder<ValueType> builder(matrixEntries.size(), this->numberOfBlocks, numberOfEntries, true, this->isNondeterministic, this->isNondeterministic ? this->numberOfBlocks : 0);
                     if (this->isNondeterministic) {
                         builder.newRowGroup(0);
                     }
-                    for (auto& rowIdx : rowPermutation) {
+                    for (uint64_t row = 0; row < matrixEntries.size(); ++row) {
+                        uint64_t rowIdx = this->isNondeterministic ? rowPermutation[row] : row;
+                        
                         // For nondeterministic models, open a new row group.
                         if (this->isNondeterministic && rowToState[rowIdx] != lastState) {
                             builder.newRowGroup(rowCounter);
                             lastState = rowToState[rowIdx];
                         }
                         
-                        auto& row = matrixEntries[rowIdx];
-                        for (auto const& entry : row) {
+                        auto& rowEntries = matrixEntries[rowIdx];
+                        for (auto const& entry : rowEntries) {
                             builder.addNextValue(rowCounter, entry.getColumn(), entry.getValue());
                         }
                         
                         // Free storage for row.
-                        row.clear();
-                        row.shrink_to_fit();
+                        rowEntries.clear();
+                        rowEntries.shrink_to_fit();
                         
                         ++rowCounter;
                     }
@@ -344,7 +351,34 @@ namespace storm {
                 }
 
                 void addMatrixEntry(uint64_t row, uint64_t column, ValueType const& value) {
-                    this->matrixEntries[row].emplace_back(column, value);
+                    // The transitions of a representative to the states of one block are aggregated right away. For rows
+                    // with many entries, the remaining duplicates are merged when the row is sorted.
+                    uint64_t const maximalEntriesToCheck = 8;
+                    auto& rowEntries = this->matrixEntries[row];
+                    uint64_t entriesToCheck = std::min<uint64_t>(rowEntries.size(), maximalEntriesToCheck);
+                    for (auto it = rowEntries.rbegin(), ite = rowEntries.rbegin() + entriesToCheck; it != ite; ++it) {
+                        if (it->getColumn() == column) {
+                            it->setValue(it->getValue() + value);
+                            return;
+                        }
+                    }
+                    rowEntries.emplace_back(column, value);
+                }
+                
+                static void mergeDuplicateEntries(std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& row) {
+                    if (row.empty()) {
+                        return;
+                    }
+                    auto target = row.begin();
+                    for (auto it = row.begin() + 1, ite = row.end(); it != ite; ++it) {
+                        if (it->getColumn() == target->getColumn()) {
+                            target->setValue(target->getValue() + it->getValue());
+                        } else {
+                            ++target;
+                            *target = std::move(*it);
+                        }
+                    }
+                    row.erase(target + 1, row.end());
                 }
                 
                 void createMatrixEntryStorage() {
@@ -825,6 +859,11 @@ namespace storm {
                 this->quotientFormat = settings.getQuotientFormat();
             }
             
+            template<storm::dd::DdType DdType, typename ValueType>
+            QuotientExtractor<DdType, ValueType>::QuotientExtractor(storm::settings::modules::BisimulationSettings::QuotientFormat const& quotientFormat) : QuotientExtractor() {
+                this->quotientFormat = quotientFormat;
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             std::shared_ptr<storm::models::Model<ValueType>> QuotientExtractor<DdType, ValueType>::extract(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation) {
                 auto start = std::chrono::high_resolution_clock::now();
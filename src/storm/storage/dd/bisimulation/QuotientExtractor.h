@@ -21,6 +21,12 @@ namespace storm {
             public:
                 QuotientExtractor();
                 
+                /*!
+                 * Creates an extractor that extracts the quotient in the given format (and takes all other options from
+                 * the settings).
+                 */
+                QuotientExtractor(storm::settings::modules::BisimulationSettings::QuotientFormat const& quotientFormat);
+                
                 std::shared_ptr<storm::models::Model<ValueType>> extract(storm::models::symbolic::Model<DdType, ValueType> const& model, Partition<DdType, ValueType> const& partition, PreservationInformation<DdType, ValueType> const& preservationInformation);
                 
             private:
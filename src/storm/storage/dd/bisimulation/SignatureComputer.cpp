@@ -12,7 +12,7 @@ namespace storm {
         namespace bisimulation {
 
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureIterator<DdType, ValueType>::SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition) : signatureComputer(signatureComputer), partition(partition), position(0) {
+            SignatureIterator<DdType, ValueType>::SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows) : signatureComputer(signatureComputer), partition(partition), rows(rows), position(0) {
                 // Intentionally left empty.
             }
             
@@ -33,17 +33,17 @@ namespace storm {
                 
                 if (mode == SignatureMode::Eager) {
                     if (position == 0) {
-                        result = signatureComputer.getFullSignature(partition);
+                        result = signatureComputer.getFullSignature(partition, rows);
                     }
                 } else if (mode == SignatureMode::Lazy) {
                     if (position == 0) {
-                        result = signatureComputer.getQualitativeSignature(partition);
+                        result = signatureComputer.getQualitativeSignature(partition, rows);
                     } else {
-                        result = signatureComputer.getFullSignature(partition);
+                        result = signatureComputer.getFullSignature(partition, rows);
                     }
                 } else if (mode == SignatureMode::Qualitative) {
                     if (position == 0) {
-                        result = signatureComputer.getQualitativeSignature(partition);
+                        result = signatureComputer.getQualitativeSignature(partition, rows);
                     }
                 } else {
                     STORM_LOG_ASSERT(false, "Unknown signature mode.");
@@ -84,13 +84,18 @@ namespace storm {
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            SignatureIterator<DdType, ValueType> SignatureComputer<DdType, ValueType>::compute(Partition<DdType, ValueType> const& partition) {
-                return SignatureIterator<DdType, ValueType>(*this, partition);
+            SignatureIterator<DdType, ValueType> SignatureComputer<DdType, ValueType>::compute(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows) {
+                return SignatureIterator<DdType, ValueType>(*this, partition, rows);
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
             void SignatureComputer<DdType, ValueType>::setSignatureMode(SignatureMode const& newMode) {
                 this->mode = newMode;
+                
+                // Signatures may be computed concurrently, so the qualitative transition matrix is created upfront.
+                if (newMode != SignatureMode::Eager) {
+                    this->createQualitativeTransitionMatrix();
+                }
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
@@ -99,43 +104,65 @@ namespace storm {
             }
                         
             template<storm::dd::DdType DdType, typename ValueType>
-            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getFullSignature(Partition<DdType, ValueType> const& partition) const {
+            storm::dd::Add<DdType, ValueType> SignatureComputer<DdType, ValueType>::getTransitionMatrix(boost::optional<storm::dd::Bdd<DdType>> const& rows) const {
+                if (!rows) {
+                    return this->transitionMatrix;
+                }
+                if (DdType == storm::dd::DdType::Sylvan) {
+                    // Keep the encoding of missing entries that was chosen upon construction.
+                    return rows.get().ite(this->transitionMatrix, this->transitionMatrix.getDdManager().template getAddUndefined<ValueType>());
+                } else {
+                    return this->transitionMatrix * rows.get().template toAdd<ValueType>();
+                }
+            }
+            
+            template<storm::dd::DdType DdType, typename ValueType>
+            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getFullSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows) const {
+                storm::dd::Add<DdType, ValueType> transitionMatrix = this->getTransitionMatrix(rows);
                 if (partition.storedAsBdd()) {
                     if (partition.hasChangedStates()) {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
+                        return Signature<DdType, ValueType>(transitionMatrix.multiplyMatrix(partition.asBdd() && partition.changedStatesAsBdd(), columnVariables));
                     } else {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables));
+                        return Signature<DdType, ValueType>(transitionMatrix.multiplyMatrix(partition.asBdd(), columnVariables));
                     }
                 } else {
                     if (partition.hasChangedStates()) {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
+                        return Signature<DdType, ValueType>(transitionMatrix.multiplyMatrix(partition.asAdd() * partition.changedStatesAsAdd(), columnVariables));
                     } else {
-                        return Signature<DdType, ValueType>(this->transitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables));
+                        return Signature<DdType, ValueType>(transitionMatrix.multiplyMatrix(partition.asAdd(), columnVariables));
                     }
                 }
             }
             
             template<storm::dd::DdType DdType, typename ValueType>
-            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativeSignature(Partition<DdType, ValueType> const& partition) const {
-                if (!transitionMatrix01) {
-                    if (DdType == storm::dd::DdType::Sylvan || this->ensureQualitative) {
-                        this->transitionMatrix01 = this->transitionMatrix.notZero();
-                    } else {
-                        this->transitionMatrix01 = this->transitionMatrix.notZero().template toAdd<ValueType>();
-                    }
-                }
+            Signature<DdType, ValueType> SignatureComputer<DdType, ValueType>::getQualitativeSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows) const {
+                this->createQualitativeTransitionMatrix();
 
                 if (partition.storedAsBdd()) {
-                    return this->getQualitativeTransitionMatrixAsBdd().andExists(partition.asBdd(), columnVariables).template toAdd<ValueType>();
+                    storm::dd::Bdd<DdType> transitionMatrix01 = rows ? this->getQualitativeTransitionMatrixAsBdd() && rows.get() : this->getQualitativeTransitionMatrixAsBdd();
+                    return transitionMatrix01.andExists(partition.asBdd(), columnVariables).template toAdd<ValueType>();
                 } else {
                     if (this->qualitativeTransitionMatrixIsBdd()) {
-                        return Signature<DdType, ValueType>(this->getQualitativeTransitionMatrixAsBdd().andExists(partition.asAdd().toBdd(), columnVariables).template toAdd<ValueType>());
+                        storm::dd::Bdd<DdType> transitionMatrix01 = rows ? this->getQualitativeTransitionMatrixAsBdd() && rows.get() : this->getQualitativeTransitionMatrixAsBdd();
+                        return Signature<DdType, ValueType>(transitionMatrix01.andExists(partition.asAdd().toBdd(), columnVariables).template toAdd<ValueType>());
                     } else {
-                        return Signature<DdType, ValueType>(this->getQualitativeTransitionMatrixAsAdd().multiplyMatrix(partition.asAdd(), columnVariables));
+                        storm::dd::Add<DdType, ValueType> transitionMatrix01 = rows ? this->getQualitativeTransitionMatrixAsAdd() * rows.get().template toAdd<ValueType>() : this->getQualitativeTransitionMatrixAsAdd();
+                        return Signature<DdType, ValueType>(transitionMatrix01.multiplyMatrix(partition.asAdd(), columnVariables));
                     }
                 }
             }
 
+            template<storm::dd::DdType DdType, typename ValueType>
+            void SignatureComputer<DdType, ValueType>::createQualitativeTransitionMatrix() const {
+                if (!transitionMatrix01) {
+                    if (DdType == storm::dd::DdType::Sylvan || this->ensureQualitative) {
+                        this->transitionMatrix01 = this->transitionMatrix.notZero();
+                    } else {
+                        this->transitionMatrix01 = this->transitionMatrix.notZero().template toAdd<ValueType>();
+                    }
+                }
+            }
+            
             template<storm::dd::DdType DdType, typename ValueType>
             bool SignatureComputer<DdType, ValueType>::qualitativeTransitionMatrixIsBdd() const {
                 return transitionMatrix01.get().which() == 0;
@@ -20,7 +20,7 @@ namespace storm {
             template<storm::dd::DdType DdType, typename ValueType>
             class SignatureIterator {
             public:
-                SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition);
+                SignatureIterator(SignatureComputer<DdType, ValueType> const& signatureComputer, Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows = boost::none);
 
                 bool hasNext() const;
                 
@@ -33,6 +33,9 @@ namespace storm {
                 // The current partition.
                 Partition<DdType, ValueType> const& partition;
                 
+                // If set, the signatures are only computed for these rows.
+                boost::optional<storm::dd::Bdd<DdType>> rows;
+                
                 // The position in the enumeration.
                 uint64_t position;
             };
@@ -49,13 +52,25 @@ namespace storm {
 
                 void setSignatureMode(SignatureMode const& newMode);
 
-                SignatureIterator<DdType, ValueType> compute(Partition<DdType, ValueType> const& partition);
+                /*!
+                 * Computes the signatures wrt. the given partition.
+                 *
+                 * @param partition The partition wrt. which to compute the signatures.
+                 * @param rows If given, the signatures are only computed for these rows (states or choices), i.e. the
+                 * signatures of all other rows are empty.
+                 */
+                SignatureIterator<DdType, ValueType> compute(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows = boost::none);
 
                 /// Methods to compute the signatures.
-                Signature<DdType, ValueType> getFullSignature(Partition<DdType, ValueType> const& partition) const;
-                Signature<DdType, ValueType> getQualitativeSignature(Partition<DdType, ValueType> const& partition) const;
+                Signature<DdType, ValueType> getFullSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows = boost::none) const;
+                Signature<DdType, ValueType> getQualitativeSignature(Partition<DdType, ValueType> const& partition, boost::optional<storm::dd::Bdd<DdType>> const& rows = boost::none) const;
 
             private:
+                storm::dd::Add<DdType, ValueType> getTransitionMatrix(boost::optional<storm::dd::Bdd<DdType>> const& rows) const;
+                
+                /// Creates the qualitative transition matrix (if it does not exist yet).
+                void createQualitativeTransitionMatrix() const;
+                
                 bool qualitativeTransitionMatrixIsBdd() const;
                 storm::dd::Bdd<DdType> const& getQualitativeTransitionMatrixAsBdd() const;
                 storm::dd::Add<DdType, ValueType> const& getQualitativeTransitionMatrixAsAdd() const;
@@ -152,6 +152,20 @@ namespace storm {
             this->getCuddManager().ReduceHeap(this->reorderingTechnique, 0);
         }
         
+        bool InternalDdManager<DdType::CUDD>::isReorderingNecessary() const {
+            return false;
+        }
+        
+        uint_fast64_t InternalDdManager<DdType::CUDD>::getNumberOfReorderings() const {
+            return this->getCuddManager().ReadReorderings();
+        }
+        
+        void InternalDdManager<DdType::CUDD>::executeConcurrently(std::vector<std::function<void()>> const& functions) const {
+            for (auto const& function : functions) {
+                function();
+            }
+        }
+        
         void InternalDdManager<DdType::CUDD>::debugCheck() const {
             this->getCuddManager().CheckKeys();
             this->getCuddManager().DebugCheck();
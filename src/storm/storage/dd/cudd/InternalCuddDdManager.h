@@ -1,6 +1,9 @@
 #ifndef STORM_STORAGE_DD_INTERNALCUDDDDMANAGER_H_
 #define STORM_STORAGE_DD_INTERNALCUDDDDMANAGER_H_
 
+#include <functional>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -126,6 +129,28 @@ namespace storm {
              */
             void triggerReordering();
             
+            /*!
+             * Retrieves whether a reordering needs to be triggered explicitly. As CUDD reorders the DDs on its own
+             * (if dynamic reordering is allowed), this is never the case.
+             *
+             * @return False.
+             */
+            bool isReorderingNecessary() const;
+            
+            /*!
+             * Retrieves the number of reorderings that were performed so far.
+             *
+             * @return The number of reorderings.
+             */
+            uint_fast64_t getNumberOfReorderings() const;
+            
+            /*!
+             * Executes the given functions. As CUDD is not thread-safe, they are executed one after another.
+             *
+             * @param functions The functions to execute.
+             */
+            void executeConcurrently(std::vector<std::function<void()>> const& functions) const;
+            
             /*!
              * Performs a debug check if available.
              */
@@ -1,7 +1,11 @@
 #include "storm/storage/dd/sylvan/InternalSylvanDdManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <exception>
 #include <iostream>
+#include <numeric>
 
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/SylvanSettings.h"
@@ -39,12 +43,35 @@ namespace storm {
         
 #endif
         
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wc99-extensions"
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+        
+        VOID_TASK_3(execute_functions, std::function<void()> const*, functions, size_t, first, size_t, count) {
+            if (count > 1) {
+                SPAWN(execute_functions, functions, first, count / 2);
+                CALL(execute_functions, functions, first + count / 2, count - count / 2);
+                SYNC(execute_functions);
+            } else if (count == 1) {
+                functions[first]();
+            }
+        }
+        
+#pragma GCC diagnostic pop
+#pragma clang diagnostic pop
+        
         uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfInstances = 0;
         
         // It is important that the variable pairs start at an even offset, because sylvan assumes this to be true for
         // some operations.
         uint_fast64_t InternalDdManager<DdType::Sylvan>::nextFreeVariableIndex = 0;
         
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::numberOfReorderings = 0;
+        
+        // Similar to CUDD, the first reordering is triggered once the DDs consist of more than 4004 nodes.
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::nextReorderingThreshold = 4004;
+        
         uint_fast64_t findLargestPowerOfTwoFitting(uint_fast64_t number) {
             for (uint_fast64_t index = 0; index < 64; ++index) {
                 if ((number & (1ull << (63 - index))) != 0) {
@@ -54,7 +81,7 @@ namespace storm {
             return 0;
         }
         
-        InternalDdManager<DdType::Sylvan>::InternalDdManager() {
+        InternalDdManager<DdType::Sylvan>::InternalDdManager() : dynamicReorderingAllowed(storm::settings::getModule<storm::settings::modules::SylvanSettings>().isReorderingEnabled()), maximalGrowth(storm::settings::getModule<storm::settings::modules::SylvanSettings>().getReorderingMaximalGrowth()) {
             if (numberOfInstances == 0) {
                 storm::settings::modules::SylvanSettings const& settings = storm::settings::getModule<storm::settings::modules::SylvanSettings>();
                 if (settings.isNumberOfThreadsSet()) {
@@ -242,16 +269,156 @@ namespace storm {
             return false;
         }
         
-        void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool) {
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+        void InternalDdManager<DdType::Sylvan>::allowDynamicReordering(bool value) {
+            dynamicReorderingAllowed = value;
         }
         
         bool InternalDdManager<DdType::Sylvan>::isDynamicReorderingAllowed() const {
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+            return dynamicReorderingAllowed;
         }
         
         void InternalDdManager<DdType::Sylvan>::triggerReordering() {
-            STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Operation is not supported by sylvan.");
+            std::vector<uint64_t> groupSizes(nextFreeVariableIndex / 2, 2);
+            if (nextFreeVariableIndex % 2 == 1) {
+                groupSizes.push_back(1);
+            }
+            this->triggerReordering(groupSizes);
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::triggerReordering(std::vector<uint64_t> const& groupSizes) {
+            // All managers share Sylvan's node table and variables, so rebuilding the DDs of one manager with a new
+            // variable order would silently change the meaning of the DDs of all others.
+            STORM_LOG_THROW(numberOfInstances == 1, storm::exceptions::NotSupportedException, "Cannot reorder the DD variables while " << numberOfInstances << " Sylvan managers exist.");
+            STORM_LOG_ASSERT(std::accumulate(groupSizes.begin(), groupSizes.end(), 0ull) == nextFreeVariableIndex, "Groups do not cover the DD variables.");
+            
+            // A trailing group of odd size cannot be moved without breaking the interleaving of the other groups.
+            uint64_t numberOfMovableGroups = groupSizes.size();
+            if (numberOfMovableGroups > 0 && groupSizes.back() % 2 == 1) {
+                --numberOfMovableGroups;
+            }
+            STORM_LOG_ASSERT(std::all_of(groupSizes.begin(), groupSizes.begin() + numberOfMovableGroups, [] (uint64_t const& size) { return size % 2 == 0; }), "Groups must be of even size.");
+            
+            auto start = std::chrono::high_resolution_clock::now();
+            
+            // The order of the groups (i.e. the i-th entry is the group at position i) that the DDs currently have.
+            std::vector<uint64_t> currentOrder(groupSizes.size());
+            std::iota(currentOrder.begin(), currentOrder.end(), 0);
+            
+            // Rebuilds the DDs such that their groups are in the given order.
+            auto applyOrder = [&] (std::vector<uint64_t> const& newOrder) {
+                std::vector<uint64_t> currentFirstIndices(groupSizes.size());
+                std::vector<uint64_t> newFirstIndices(groupSizes.size());
+                for (uint64_t position = 0, currentIndex = 0, newIndex = 0; position < groupSizes.size(); ++position) {
+                    currentFirstIndices[currentOrder[position]] = currentIndex;
+                    currentIndex += groupSizes[currentOrder[position]];
+                    newFirstIndices[newOrder[position]] = newIndex;
+                    newIndex += groupSizes[newOrder[position]];
+                }
+                std::vector<uint64_t> permutation(nextFreeVariableIndex);
+                for (uint64_t group = 0; group < groupSizes.size(); ++group) {
+                    for (uint64_t offset = 0; offset < groupSizes[group]; ++offset) {
+                        permutation[currentFirstIndices[group] + offset] = newFirstIndices[group] + offset;
+                    }
+                }
+                this->permuteDdVariables(permutation);
+                currentOrder = newOrder;
+                return static_cast<uint64_t>(mtbdd_protected_nodecount());
+            };
+            
+            uint64_t initialSize = mtbdd_protected_nodecount();
+            uint64_t size = initialSize;
+            for (uint64_t group = 0; group < numberOfMovableGroups; ++group) {
+                std::vector<uint64_t> order = currentOrder;
+                uint64_t position = std::distance(order.begin(), std::find(order.begin(), order.end(), group));
+                uint64_t bestPosition = position;
+                uint64_t bestSize = size;
+                
+                // Move the group upwards first and then downwards, in both directions as long as the DDs do not grow
+                // too much.
+                while (position > 0) {
+                    std::swap(order[position - 1], order[position]);
+                    --position;
+                    size = applyOrder(order);
+                    if (size < bestSize) {
+                        bestSize = size;
+                        bestPosition = position;
+                    } else if (size > maximalGrowth * bestSize) {
+                        break;
+                    }
+                }
+                while (position + 1 < numberOfMovableGroups) {
+                    std::swap(order[position], order[position + 1]);
+                    ++position;
+                    size = applyOrder(order);
+                    if (size < bestSize) {
+                        bestSize = size;
+                        bestPosition = position;
+                    } else if (size > maximalGrowth * bestSize) {
+                        break;
+                    }
+                }
+                
+                // Finally, move the group to the best position encountered.
+                if (position != bestPosition) {
+                    order.erase(order.begin() + position);
+                    order.insert(order.begin() + bestPosition, group);
+                    size = applyOrder(order);
+                }
+            }
+            
+            ++numberOfReorderings;
+            nextReorderingThreshold = std::max<uint_fast64_t>(4004, 2 * size);
+            
+            auto end = std::chrono::high_resolution_clock::now();
+            STORM_LOG_DEBUG("Reordering of sylvan DDs reduced the number of nodes from " << initialSize << " to " << size << " (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+        }
+        
+        bool InternalDdManager<DdType::Sylvan>::isReorderingNecessary() const {
+            return dynamicReorderingAllowed && numberOfInstances == 1 && mtbdd_protected_nodecount() > nextReorderingThreshold;
+        }
+        
+        uint_fast64_t InternalDdManager<DdType::Sylvan>::getNumberOfReorderings() const {
+            return numberOfReorderings;
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::executeConcurrently(std::vector<std::function<void()>> const& functions) const {
+            // Exceptions must not pass the (C) frames of the tasks, so they are caught and rethrown afterwards.
+            std::vector<std::exception_ptr> exceptions(functions.size());
+            std::vector<std::function<void()>> tasks;
+            tasks.reserve(functions.size());
+            for (uint64_t index = 0; index < functions.size(); ++index) {
+                tasks.emplace_back([&functions, &exceptions, index] () {
+                    try {
+                        functions[index]();
+                    } catch (...) {
+                        exceptions[index] = std::current_exception();
+                    }
+                });
+            }
+            
+            LACE_ME;
+            CALL(execute_functions, tasks.data(), 0, tasks.size());
+            
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+        }
+        
+        void InternalDdManager<DdType::Sylvan>::permuteDdVariables(std::vector<uint64_t> const& permutation) {
+            LACE_ME;
+            MTBDDMAP map = mtbdd_map_empty();
+            mtbdd_refs_pushptr(&map);
+            for (uint64_t index = 0; index < permutation.size(); ++index) {
+                if (permutation[index] != index) {
+                    BDD variable = mtbdd_refs_push(sylvan_ithvar(static_cast<BDDVAR>(permutation[index])));
+                    map = mtbdd_map_add(map, static_cast<uint32_t>(index), variable);
+                    mtbdd_refs_pop(1);
+                }
+            }
+            mtbdd_permute_protected(map);
+            mtbdd_refs_popptr(1);
         }
         
         void InternalDdManager<DdType::Sylvan>::debugCheck() const {
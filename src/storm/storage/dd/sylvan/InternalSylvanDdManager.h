@@ -1,6 +1,9 @@
 #ifndef STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 #define STORM_STORAGE_DD_SYLVAN_INTERNALSYLVANDDMANAGER_H_
 
+#include <functional>
+#include <vector>
+
 #include <boost/optional.hpp>
 
 #include "storm/storage/dd/DdType.h"
@@ -123,10 +126,48 @@ namespace storm {
             bool isDynamicReorderingAllowed() const;
             
             /*!
-             * Triggers a reordering of the DDs managed by this manager.
+             * Triggers a reordering of the DDs managed by this manager. The DD variables are sifted in groups of two
+             * adjacent variables.
              */
             void triggerReordering();
             
+            /*!
+             * Triggers a reordering of the DDs managed by this manager in which the given groups of DD variables are
+             * sifted as blocks, i.e. the variables of a group stay adjacent and keep their relative order. Since Sylvan
+             * cannot swap adjacent levels in place, every move of a group rebuilds all (protected) DDs with the new
+             * variable order. The DDs thus keep their semantics (in terms of the meta variables), but the indices of
+             * the DD variables are changed. As Sylvan's node table is shared by all managers, this is only possible if
+             * no other manager exists.
+             *
+             * @param groupSizes The sizes of the groups of DD variables in the order of their positions. Their sum
+             * must equal the number of DD variables and all groups but the last one need to be of even size, because
+             * some operations (like the relational product) rely on row and column variables to be interleaved.
+             */
+            void triggerReordering(std::vector<uint64_t> const& groupSizes);
+            
+            /*!
+             * Retrieves whether dynamic reordering is allowed, this is the only manager and the DDs grew considerably
+             * since the last reordering.
+             *
+             * @return True iff a reordering is to be triggered.
+             */
+            bool isReorderingNecessary() const;
+            
+            /*!
+             * Retrieves the number of reorderings that were performed so far.
+             *
+             * @return The number of reorderings.
+             */
+            uint_fast64_t getNumberOfReorderings() const;
+            
+            /*!
+             * Executes the given functions as tasks of Sylvan's workers, so they may perform DD operations in parallel.
+             * If a function throws an exception, it is rethrown once all functions are done.
+             *
+             * @param functions The functions to execute.
+             */
+            void executeConcurrently(std::vector<std::function<void()>> const& functions) const;
+            
             /*!
              * Performs a debug check if available.
              */
@@ -143,6 +184,16 @@ namespace storm {
             // Helper function to create the BDD whose encodings are below a given bound.
             BDD getBddEncodingLessOrEqualThanRec(uint64_t minimalValue, uint64_t maximalValue, uint64_t bound, BDD cube, uint64_t remainingDdVariables) const;
             
+            // Helper function that renames the DD variables of all (protected) DDs such that the variable with index i
+            // gets the index permutation[i].
+            void permuteDdVariables(std::vector<uint64_t> const& permutation);
+            
+            // A flag indicating whether dynamic reordering is allowed.
+            bool dynamicReorderingAllowed;
+            
+            // The factor by which the DDs may grow while sifting a group of variables.
+            double maximalGrowth;
+            
             // A counter for the number of instances of this class. This is used to determine when to initialize and
             // quit the sylvan. This is because Sylvan does not know the concept of managers but implicitly has a
             // 'global' manager.
@@ -151,6 +202,13 @@ namespace storm {
             // The index of the next free variable index. This needs to be shared across all instances since the sylvan
             // manager is implicitly 'global'.
             static uint_fast64_t nextFreeVariableIndex;
+            
+            // The number of reorderings performed so far. As the indices of the DD variables change upon reordering,
+            // this can be used to detect that information depending on the indices (e.g. ODDs) became outdated.
+            static uint_fast64_t numberOfReorderings;
+            
+            // The number of nodes at which the next reordering is triggered if dynamic reordering is allowed.
+            static uint_fast64_t nextReorderingThreshold;
         };
         
         template<>
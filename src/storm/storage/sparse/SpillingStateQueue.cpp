@@ -0,0 +1,164 @@
+#include "storm/storage/sparse/SpillingStateQueue.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            template <typename StateType>
+            SpillingStateQueue<StateType>::SpillingStateQueue(uint64_t maximalNumberOfStatesInMemory, std::string const& directory) : blockSize(maximalNumberOfStatesInMemory / 2), bitsPerState(0), recordSize(0), readPosition(0), numberOfSpilledStates(0), maximalNumberOfSpilledStates(0) {
+                STORM_LOG_THROW(blockSize > 0, storm::exceptions::InvalidArgumentException, "At least two states need to be kept in memory.");
+                filename = boost::filesystem::path(directory) / boost::filesystem::unique_path("storm-states-%%%%-%%%%-%%%%-%%%%");
+                file.open(filename.native(), std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc);
+                STORM_LOG_THROW(file.is_open(), storm::exceptions::FileIoException, "Unable to create the file '" << filename.native() << "' for the states to explore.");
+            }
+
+            template <typename StateType>
+            SpillingStateQueue<StateType>::~SpillingStateQueue() {
+                file.close();
+                boost::system::error_code errorCode;
+                boost::filesystem::remove(filename, errorCode);
+            }
+
+            template <typename StateType>
+            void SpillingStateQueue<StateType>::push(storm::storage::BitVector const& state, StateType const& index) {
+                // As long as nothing was written, the states are appended to the front, so they can be taken from there.
+                if (numberOfSpilledStates == 0 && back.empty() && front.size() < blockSize) {
+                    front.emplace_back(state, index);
+                } else {
+                    back.emplace_back(state, index);
+                    if (back.size() >= blockSize) {
+                        writeBack();
+                    }
+                }
+            }
+
+            template <typename StateType>
+            std::pair<storm::storage::BitVector, StateType> SpillingStateQueue<StateType>::pop() {
+                if (front.empty()) {
+                    if (numberOfSpilledStates > 0) {
+                        readFront();
+                    } else {
+                        std::swap(front, back);
+                    }
+                }
+                STORM_LOG_ASSERT(!front.empty(), "Cannot take a state from an empty queue.");
+                std::pair<storm::storage::BitVector, StateType> result = std::move(front.front());
+                front.pop_front();
+                return result;
+            }
+
+            template <typename StateType>
+            bool SpillingStateQueue<StateType>::empty() const {
+                return front.empty() && back.empty() && numberOfSpilledStates == 0;
+            }
+
+            template <typename StateType>
+            uint64_t SpillingStateQueue<StateType>::size() const {
+                return front.size() + back.size() + numberOfSpilledStates;
+            }
+
+            template <typename StateType>
+            uint64_t SpillingStateQueue<StateType>::getMaximalNumberOfSpilledStates() const {
+                return maximalNumberOfSpilledStates;
+            }
+
+            template <typename StateType>
+            void SpillingStateQueue<StateType>::writeBack() {
+                if (recordSize == 0) {
+                    bitsPerState = back.front().first.size();
+                    recordSize = ((bitsPerState + 63) / 64) * sizeof(uint64_t) + sizeof(StateType);
+                }
+
+                // Serialize the block into a buffer, so it can be written at once.
+                uint64_t wordsPerState = (bitsPerState + 63) / 64;
+                std::vector<char> buffer(back.size() * recordSize);
+                char* position = buffer.data();
+                for (auto const& stateIndexPair : back) {
+                    STORM_LOG_ASSERT(stateIndexPair.first.size() == bitsPerState, "All states in the queue must have the same size.");
+                    for (uint64_t word = 0; word < wordsPerState; ++word) {
+                        uint64_t bitIndex = word * 64;
+                        uint64_t value = stateIndexPair.first.getAsInt(bitIndex, std::min<uint64_t>(64, bitsPerState - bitIndex));
+                        std::copy_n(reinterpret_cast<char const*>(&value), sizeof(uint64_t), position);
+                        position += sizeof(uint64_t);
+                    }
+                    std::copy_n(reinterpret_cast<char const*>(&stateIndexPair.second), sizeof(StateType), position);
+                    position += sizeof(StateType);
+                }
+
+                file.seekp((readPosition + numberOfSpilledStates) * recordSize);
+                file.write(buffer.data(), buffer.size());
+                STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to write states to the file '" << filename.native() << "'.");
+
+                numberOfSpilledStates += back.size();
+                maximalNumberOfSpilledStates = std::max(maximalNumberOfSpilledStates, numberOfSpilledStates);
+                back.clear();
+            }
+
+            template <typename StateType>
+            void SpillingStateQueue<StateType>::readFront() {
+                uint64_t numberOfStates = std::min(blockSize, numberOfSpilledStates);
+                std::vector<char> buffer(numberOfStates * recordSize);
+                file.seekg(readPosition * recordSize);
+                file.read(buffer.data(), buffer.size());
+                STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to read states from the file '" << filename.native() << "'.");
+
+                uint64_t wordsPerState = (bitsPerState + 63) / 64;
+                char const* position = buffer.data();
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    storm::storage::BitVector bitVector(bitsPerState);
+                    for (uint64_t word = 0; word < wordsPerState; ++word) {
+                        uint64_t value;
+                        std::copy_n(position, sizeof(uint64_t), reinterpret_cast<char*>(&value));
+                        position += sizeof(uint64_t);
+                        uint64_t bitIndex = word * 64;
+                        bitVector.setFromInt(bitIndex, std::min<uint64_t>(64, bitsPerState - bitIndex), value);
+                    }
+                    StateType index;
+                    std::copy_n(position, sizeof(StateType), reinterpret_cast<char*>(&index));
+                    position += sizeof(StateType);
+                    front.emplace_back(std::move(bitVector), index);
+                }
+
+                readPosition += numberOfStates;
+                numberOfSpilledStates -= numberOfStates;
+
+                // Reclaim the space of the states that were read once they take up at least half of the file. As the
+                // remaining states are moved at most once per state read, this only doubles the cost of reading.
+                if (readPosition >= numberOfSpilledStates) {
+                    compact();
+                }
+            }
+
+            template <typename StateType>
+            void SpillingStateQueue<StateType>::compact() {
+                // As the part that was read is at least as large as the remaining part, they do not overlap.
+                std::vector<char> buffer;
+                for (uint64_t moved = 0; moved < numberOfSpilledStates; moved += blockSize) {
+                    uint64_t numberOfStates = std::min(blockSize, numberOfSpilledStates - moved);
+                    buffer.resize(numberOfStates * recordSize);
+                    file.seekg((readPosition + moved) * recordSize);
+                    file.read(buffer.data(), buffer.size());
+                    file.seekp(moved * recordSize);
+                    file.write(buffer.data(), buffer.size());
+                    STORM_LOG_THROW(file.good(), storm::exceptions::FileIoException, "Unable to move states within the file '" << filename.native() << "'.");
+                }
+                file.flush();
+                readPosition = 0;
+
+                boost::system::error_code errorCode;
+                boost::filesystem::resize_file(filename, numberOfSpilledStates * recordSize, errorCode);
+                STORM_LOG_THROW(!errorCode, storm::exceptions::FileIoException, "Unable to shrink the file '" << filename.native() << "' (error: " << errorCode.message() << ").");
+            }
+
+            template class SpillingStateQueue<uint32_t>;
+            template class SpillingStateQueue<uint_fast64_t>;
+        }
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef STORM_STORAGE_SPARSE_SPILLINGSTATEQUEUE_H_
+#define STORM_STORAGE_SPARSE_SPILLINGSTATEQUEUE_H_
+
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <utility>
+
+#include <boost/filesystem.hpp>
+
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            // A first-in first-out queue of states and their indices that keeps a bounded number of states in memory.
+            // The states at the front and the back of the queue are held in memory, while the ones in between are
+            // written to a temporary file in blocks and read back once they reach the front of the queue.
+            template <typename StateType>
+            class SpillingStateQueue {
+            public:
+                /*!
+                 * Creates an empty queue.
+                 *
+                 * @param maximalNumberOfStatesInMemory The number of states that are kept in memory. Must be at least two.
+                 * @param directory The directory in which to create the temporary file.
+                 */
+                SpillingStateQueue(uint64_t maximalNumberOfStatesInMemory, std::string const& directory);
+
+                SpillingStateQueue(SpillingStateQueue const& other) = delete;
+                SpillingStateQueue& operator=(SpillingStateQueue const& other) = delete;
+
+                ~SpillingStateQueue();
+
+                /*!
+                 * Appends the given state to the queue. All states in the queue must have the same size.
+                 */
+                void push(storm::storage::BitVector const& state, StateType const& index);
+
+                /*!
+                 * Removes the state at the front of the queue and returns it. The queue must not be empty.
+                 */
+                std::pair<storm::storage::BitVector, StateType> pop();
+
+                bool empty() const;
+                uint64_t size() const;
+
+                // Retrieves the largest number of states that were stored on disk at the same time.
+                uint64_t getMaximalNumberOfSpilledStates() const;
+
+            private:
+                // Appends the states at the back of the queue to the file.
+                void writeBack();
+
+                // Reads the next block of states from the file to the front of the queue.
+                void readFront();
+
+                // Moves the states that were not yet read to the start of the file and shrinks it accordingly.
+                void compact();
+
+                // The number of states that are written and read at once.
+                uint64_t blockSize;
+
+                // The states at the front and at the back of the queue. All states in the file are located in between.
+                std::deque<std::pair<storm::storage::BitVector, StateType>> front;
+                std::deque<std::pair<storm::storage::BitVector, StateType>> back;
+
+                // The temporary file and the stream to access it.
+                boost::filesystem::path filename;
+                std::fstream file;
+
+                // The size of the states in bits. It is known once the first state is written to the file.
+                uint64_t bitsPerState;
+
+                // The number of bytes of a state and its index in the file.
+                uint64_t recordSize;
+
+                // The position (in records) of the first state in the file that was not yet read and the number of
+                // states that were not yet read.
+                uint64_t readPosition;
+                uint64_t numberOfSpilledStates;
+
+                uint64_t maximalNumberOfSpilledStates;
+            };
+
+        }
+    }
+}
+
+#endif /* STORM_STORAGE_SPARSE_SPILLINGSTATEQUEUE_H_ */
@@ -2,6 +2,9 @@
 #define STORM_STORAGE_SPARSE_STATESTORAGE_H_
 
 #include <cstdint>
+#include <string>
+
+#include <boost/optional.hpp>
 
 #include "storm/storage/BitVectorHashMap.h"
 
@@ -12,8 +15,9 @@ namespace storm {
             // A structure holding information about the reachable state space while building it.
             template <typename StateType>
             struct StateStorage {
-                // Creates an empty state storage structure for storing states of the given bit width.
-                StateStorage(uint64_t bitsPerState);
+                // Creates an empty state storage structure for storing states of the given bit width. If a directory is
+                // given, the states are held in a memory-mapped file in this directory.
+                StateStorage(uint64_t bitsPerState, boost::optional<std::string> const& storageDirectory = boost::none);
                 
                 // This member stores all the states and maps them to their unique indices.
                 storm::storage::BitVectorHashMap<StateType> stateToId;
@@ -1,46 +1,166 @@
 #include "storm/storage/sparse/StateValuations.h"
 
-#include "storm/utility/vector.h"
+#include <algorithm>
+#include <sstream>
+
+#include <boost/algorithm/string/join.hpp>
+
+#include "storm/generator/VariableInformation.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     namespace storage {
         namespace sparse {
-            
-            StateValuations::StateValuations(std::vector<storm::expressions::SimpleValuation> const& valuations) : valuations(valuations) {
+
+            StateValuations::Column::Column(storm::expressions::Variable const& variable, bool boolean, uint_fast64_t sourceBitOffset, uint_fast64_t bitWidth, int_fast64_t offset) : variable(variable), boolean(boolean), sourceBitOffset(sourceBitOffset), bitWidth(bitWidth), offset(offset) {
                 // Intentionally left empty.
             }
-                        
-            StateValuations::StateValuations(std::vector<storm::expressions::SimpleValuation>&& valuations) : valuations(std::move(valuations)) {
-                // Intentionally left empty.
+
+            StateValuations::StateValuations(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager, storm::generator::VariableInformation const& variableInformation, uint_fast64_t numberOfStates) : manager(manager), statesWithValuation(numberOfStates) {
+                for (auto const& locationVariable : variableInformation.locationVariables) {
+                    columns.emplace_back(locationVariable.variable, false, locationVariable.bitOffset, locationVariable.bitWidth, 0);
+                }
+                for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                    columns.emplace_back(booleanVariable.variable, true, booleanVariable.bitOffset, 1, 0);
+                }
+                for (auto const& integerVariable : variableInformation.integerVariables) {
+                    columns.emplace_back(integerVariable.variable, false, integerVariable.bitOffset, integerVariable.bitWidth, integerVariable.lowerBound);
+                }
+                std::sort(columns.begin(), columns.end(), [] (Column const& first, Column const& second) { return first.variable < second.variable; } );
+                for (auto& column : columns) {
+                    column.values = storm::storage::BitVector(numberOfStates * column.bitWidth);
+                }
+            }
+
+            StateValuations::StateValuations(StateValuations const& other, uint_fast64_t numberOfStates) : manager(other.manager), statesWithValuation(numberOfStates) {
+                columns.reserve(other.columns.size());
+                for (auto const& column : other.columns) {
+                    columns.emplace_back(column.variable, column.boolean, column.sourceBitOffset, column.bitWidth, column.offset);
+                    columns.back().values = storm::storage::BitVector(numberOfStates * column.bitWidth);
+                }
             }
-            
+
+            void StateValuations::setStateValuation(state_type const& state, storm::storage::BitVector const& compressedState) {
+                for (auto& column : columns) {
+                    if (column.bitWidth != 0) {
+                        column.values.setFromInt(state * column.bitWidth, column.bitWidth, compressedState.getAsInt(column.sourceBitOffset, column.bitWidth));
+                    }
+                }
+                statesWithValuation.set(state);
+            }
+
+            void StateValuations::copyStateValuation(state_type const& state, StateValuations const& other, state_type const& otherState) {
+                for (uint_fast64_t columnIndex = 0; columnIndex < columns.size(); ++columnIndex) {
+                    Column& column = columns[columnIndex];
+                    if (column.bitWidth != 0) {
+                        column.values.setFromInt(state * column.bitWidth, column.bitWidth, other.columns[columnIndex].values.getAsInt(otherState * column.bitWidth, column.bitWidth));
+                    }
+                }
+                statesWithValuation.set(state, other.statesWithValuation.get(otherState));
+            }
+
+            StateValuations::Column const& StateValuations::getColumn(storm::expressions::Variable const& variable) const {
+                auto columnIt = std::lower_bound(columns.begin(), columns.end(), variable, [] (Column const& column, storm::expressions::Variable const& otherVariable) { return column.variable < otherVariable; } );
+                STORM_LOG_THROW(columnIt != columns.end() && columnIt->variable == variable, storm::exceptions::InvalidArgumentException, "The variable '" << variable.getName() << "' is not stored in the state valuations.");
+                return *columnIt;
+            }
+
+            int_fast64_t StateValuations::getValue(Column const& column, state_type const& state) const {
+                if (column.bitWidth == 0) {
+                    return column.offset;
+                }
+                return static_cast<int_fast64_t>(column.values.getAsInt(state * column.bitWidth, column.bitWidth)) + column.offset;
+            }
+
             std::string StateValuations::getStateInfo(state_type const& state) const {
-                return getStateValuation(state).toString();
+                std::vector<Column const*> selectedColumns;
+                selectedColumns.reserve(columns.size());
+                for (auto const& column : columns) {
+                    selectedColumns.push_back(&column);
+                }
+                return getStateInfo(state, selectedColumns);
+            }
+
+            std::string StateValuations::getStateInfo(state_type const& state, std::set<storm::expressions::Variable> const& selectedVariables) const {
+                std::vector<Column const*> selectedColumns;
+                selectedColumns.reserve(selectedVariables.size());
+                for (auto const& variable : selectedVariables) {
+                    selectedColumns.push_back(&getColumn(variable));
+                }
+                return getStateInfo(state, selectedColumns);
+            }
+
+            std::string StateValuations::getStateInfo(state_type const& state, std::vector<Column const*> const& selectedColumns) const {
+                if (!statesWithValuation.get(state)) {
+                    return "[]";
+                }
+                std::vector<std::string> assignments;
+                assignments.reserve(selectedColumns.size());
+                for (auto const& column : selectedColumns) {
+                    std::stringstream stream;
+                    stream << column->variable.getName() << "=";
+                    if (column->boolean) {
+                        stream << std::boolalpha << (getValue(*column, state) != 0) << std::noboolalpha;
+                    } else {
+                        stream << getValue(*column, state);
+                    }
+                    assignments.push_back(stream.str());
+                }
+                return "[" + boost::join(assignments, ", ") + "]";
             }
-            
-            storm::expressions::SimpleValuation const& StateValuations::getStateValuation(storm::storage::sparse::state_type const& state) const {
-                return valuations[state];
+
+            storm::expressions::SimpleValuation StateValuations::getStateValuation(state_type const& state) const {
+                if (!statesWithValuation.get(state)) {
+                    return storm::expressions::SimpleValuation();
+                }
+                storm::expressions::SimpleValuation result(manager);
+                for (auto const& column : columns) {
+                    if (column.boolean) {
+                        result.setBooleanValue(column.variable, getValue(column, state) != 0);
+                    } else {
+                        result.setIntegerValue(column.variable, getValue(column, state));
+                    }
+                }
+                return result;
+            }
+
+            bool StateValuations::getBooleanValue(state_type const& state, storm::expressions::Variable const& booleanVariable) const {
+                Column const& column = getColumn(booleanVariable);
+                STORM_LOG_THROW(column.boolean, storm::exceptions::InvalidArgumentException, "The variable '" << booleanVariable.getName() << "' is not a boolean variable.");
+                return getValue(column, state) != 0;
+            }
+
+            int_fast64_t StateValuations::getIntegerValue(state_type const& state, storm::expressions::Variable const& integerVariable) const {
+                Column const& column = getColumn(integerVariable);
+                STORM_LOG_THROW(!column.boolean, storm::exceptions::InvalidArgumentException, "The variable '" << integerVariable.getName() << "' is not an integer variable.");
+                return getValue(column, state);
             }
 
             uint_fast64_t StateValuations::getNumberOfStates() const {
-                return valuations.size();
+                return statesWithValuation.size();
             }
-            
+
             StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-                return StateValuations(storm::utility::vector::filterVector(valuations, selectedStates));
+                StateValuations result(*this, selectedStates.getNumberOfSetBits());
+                state_type newState = 0;
+                for (auto const& selectedState : selectedStates) {
+                    result.copyStateValuation(newState, *this, selectedState);
+                    ++newState;
+                }
+                return result;
             }
 
             StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-                std::vector<storm::expressions::SimpleValuation> selectedValuations;
-                selectedValuations.reserve(selectedStates.size());
-                for (auto const& selectedState : selectedStates){
-                    if (selectedState < valuations.size()) {
-                        selectedValuations.push_back(valuations[selectedState]);
-                    } else {
-                        selectedValuations.emplace_back();
+                StateValuations result(*this, selectedStates.size());
+                for (state_type newState = 0; newState < selectedStates.size(); ++newState) {
+                    if (selectedStates[newState] < getNumberOfStates()) {
+                        result.copyStateValuation(newState, *this, selectedStates[newState]);
                     }
                 }
-                return StateValuations(std::move(selectedValuations));
+                return result;
             }
         }
     }
@@ -3,54 +3,137 @@
 
 #include <cstdint>
 #include <string>
+#include <memory>
+#include <set>
 
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/BitVector.h"
+#include "storm/storage/expressions/Variable.h"
 #include "storm/storage/expressions/SimpleValuation.h"
 #include "storm/models/sparse/StateAnnotation.h"
 
 namespace storm {
+    namespace expressions {
+        class ExpressionManager;
+    }
+
+    namespace generator {
+        struct VariableInformation;
+    }
+
     namespace storage {
         namespace sparse {
-            
+
             // A structure holding information about the reachable state space that can be retrieved from the outside.
+            // The values of each variable are stored in a separate column that packs the values of all states with
+            // the number of bits the variable occupies in the compressed states of the model generation.
             class StateValuations : public storm::models::sparse::StateAnnotation {
-            
+
             public:
                 /*!
-                 * Constructs a state information object for the given number of states.
+                 * Constructs a state information object for the given number of states. Initially, no state has a
+                 * valuation, so the valuations need to be set via setStateValuation.
+                 *
+                 * @param manager The manager responsible for the variables.
+                 * @param variableInformation The information about how the variables are packed within the compressed states.
+                 * @param numberOfStates The number of states.
                  */
-                StateValuations(std::vector<storm::expressions::SimpleValuation> const& valuations);
-                StateValuations(std::vector<storm::expressions::SimpleValuation>&& valuations);
-                
+                StateValuations(std::shared_ptr<storm::expressions::ExpressionManager const> const& manager, storm::generator::VariableInformation const& variableInformation, uint_fast64_t numberOfStates);
+
                 virtual ~StateValuations() = default;
-                
+
+                /*!
+                 * Sets the valuation of the given state to the one encoded by the given compressed state.
+                 *
+                 * @param state The state whose valuation to set.
+                 * @param compressedState The compressed state whose layout is described by the variable information
+                 * this object was constructed with.
+                 */
+                void setStateValuation(storm::storage::sparse::state_type const& state, storm::storage::BitVector const& compressedState);
+
                 virtual std::string getStateInfo(storm::storage::sparse::state_type const& state) const override;
-                
-                storm::expressions::SimpleValuation const& getStateValuation(storm::storage::sparse::state_type const& state) const;
-                
+
+                /*!
+                 * Retrieves a string representation of the valuation of the given state that is restricted to the
+                 * selected variables. Other than materializing the valuation, this only reads the selected columns.
+                 */
+                std::string getStateInfo(storm::storage::sparse::state_type const& state, std::set<storm::expressions::Variable> const& selectedVariables) const;
+
+                /*!
+                 * Materializes the valuation of the given state. If the state has no valuation, the result is empty.
+                 */
+                storm::expressions::SimpleValuation getStateValuation(storm::storage::sparse::state_type const& state) const;
+
+                /*!
+                 * Retrieves the value of the given variable in the given state without materializing the valuation.
+                 */
+                bool getBooleanValue(storm::storage::sparse::state_type const& state, storm::expressions::Variable const& booleanVariable) const;
+                int_fast64_t getIntegerValue(storm::storage::sparse::state_type const& state, storm::expressions::Variable const& integerVariable) const;
+
                 // Returns the number of states that this object describes.
                 uint_fast64_t getNumberOfStates() const;
-                
+
                 /*
                  * Derive new state valuations from this by selecting the given states.
                  */
                 StateValuations selectStates(storm::storage::BitVector const& selectedStates) const;
-                
+
                 /*
                  * Derive new state valuations from this by selecting the given states.
                  * If an invalid state index is selected, the corresponding valuation will be empty.
                  */
                 StateValuations selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const;
-                
-                
+
+
             private:
-                
-                // A mapping from state indices to their variable valuations.
-                std::vector<storm::expressions::SimpleValuation> valuations;
-                
+                // The values of one variable for all states.
+                struct Column {
+                    Column(storm::expressions::Variable const& variable, bool boolean, uint_fast64_t sourceBitOffset, uint_fast64_t bitWidth, int_fast64_t offset);
+
+                    // The variable whose values are stored.
+                    storm::expressions::Variable variable;
+
+                    // A flag indicating whether the variable is a boolean one.
+                    bool boolean;
+
+                    // The bit offset of the variable in the compressed states.
+                    uint_fast64_t sourceBitOffset;
+
+                    // The number of bits used to store one value. The value of state i is stored at bit i * bitWidth.
+                    uint_fast64_t bitWidth;
+
+                    // The value that is added to the stored bits to obtain the value of the variable.
+                    int_fast64_t offset;
+
+                    // The packed values.
+                    storm::storage::BitVector values;
+                };
+
+                /*!
+                 * Creates state valuations with the layout of the given ones, but for the given number of states.
+                 */
+                StateValuations(StateValuations const& other, uint_fast64_t numberOfStates);
+
+                /*!
+                 * Copies the valuation of the given state of the other state valuations to the given state.
+                 */
+                void copyStateValuation(storm::storage::sparse::state_type const& state, StateValuations const& other, storm::storage::sparse::state_type const& otherState);
+
+                Column const& getColumn(storm::expressions::Variable const& variable) const;
+                int_fast64_t getValue(Column const& column, storm::storage::sparse::state_type const& state) const;
+                std::string getStateInfo(storm::storage::sparse::state_type const& state, std::vector<Column const*> const& selectedColumns) const;
+
+                // The manager responsible for the variables.
+                std::shared_ptr<storm::expressions::ExpressionManager const> manager;
+
+                // The columns, sorted by their variables.
+                std::vector<Column> columns;
+
+                // The states for which a valuation is stored.
+                storm::storage::BitVector statesWithValuation;
+
             };
-            
+
         }
     }
 }
@@ -0,0 +1,104 @@
+#include "storm/transformer/StatePermuter.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/builder.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/permutation.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace transformer {
+
+        template<typename ValueType, typename RewardModelType>
+        typename StatePermuter<ValueType, RewardModelType>::ReturnType StatePermuter<ValueType, RewardModelType>::transform(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<storm::storage::sparse::state_type> const& permutation) {
+            STORM_LOG_THROW(permutation.size() == originalModel.getNumberOfStates() && storm::utility::permutation::isValidPermutation(permutation), storm::exceptions::InvalidArgumentException, "The given vector is not a permutation of the states of the model.");
+            STORM_LOG_THROW(!originalModel.isOfType(storm::models::ModelType::S2pg), storm::exceptions::NotSupportedException, "Permuting the states of a " << originalModel.getType() << " is not supported.");
+
+            ReturnType result;
+            result.newToOldStateIndexMapping = permutation;
+            result.oldToNewStateIndexMapping = storm::utility::permutation::invertPermutation(permutation);
+
+            storm::storage::SparseMatrix<ValueType> const& originalMatrix = originalModel.getTransitionMatrix();
+
+            // Compute the order in which the choices of the original model appear in the permuted model.
+            std::vector<uint_fast64_t> choicePermutation;
+            choicePermutation.reserve(originalMatrix.getRowCount());
+            for (auto const& oldState : permutation) {
+                for (uint_fast64_t choice = originalMatrix.getRowGroupIndices()[oldState]; choice < originalMatrix.getRowGroupIndices()[oldState + 1]; ++choice) {
+                    choicePermutation.push_back(choice);
+                }
+            }
+
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(originalMatrix.permuteRowGroupsAndColumns(permutation, result.oldToNewStateIndexMapping), storm::models::sparse::StateLabeling(originalModel.getNumberOfStates()));
+            for (auto const& label : originalModel.getStateLabeling().getLabels()) {
+                components.stateLabeling.addLabel(label, storm::utility::permutation::permuteBitVector(originalModel.getStateLabeling().getStates(label), permutation));
+            }
+            for (auto const& rewardModel : originalModel.getRewardModels()) {
+                components.rewardModels.emplace(rewardModel.first, transformRewardModel(rewardModel.second, originalMatrix, permutation, result.oldToNewStateIndexMapping, choicePermutation));
+            }
+            if (originalModel.hasChoiceLabeling()) {
+                storm::models::sparse::ChoiceLabeling choiceLabeling(choicePermutation.size());
+                for (auto const& label : originalModel.getChoiceLabeling().getLabels()) {
+                    choiceLabeling.addLabel(label, storm::utility::permutation::permuteBitVector(originalModel.getChoiceLabeling().getChoices(label), choicePermutation));
+                }
+                components.choiceLabeling = std::move(choiceLabeling);
+            }
+            if (originalModel.hasStateValuations()) {
+                components.stateValuations = originalModel.getStateValuations().selectStates(permutation);
+            }
+            if (originalModel.hasChoiceOrigins()) {
+                components.choiceOrigins = originalModel.getChoiceOrigins()->selectChoices(choicePermutation);
+            }
+
+            // Transform the model specific components.
+            if (originalModel.isOfType(storm::models::ModelType::Ctmc)) {
+                components.exitRates = storm::utility::permutation::permuteVector(dynamic_cast<storm::models::sparse::Ctmc<ValueType, RewardModelType> const&>(originalModel).getExitRateVector(), permutation);
+                components.rateTransitions = true;
+            } else if (originalModel.isOfType(storm::models::ModelType::MarkovAutomaton)) {
+                auto const& ma = dynamic_cast<storm::models::sparse::MarkovAutomaton<ValueType, RewardModelType> const&>(originalModel);
+                components.markovianStates = storm::utility::permutation::permuteBitVector(ma.getMarkovianStates(), permutation);
+                components.exitRates = storm::utility::permutation::permuteVector(ma.getExitRates(), permutation);
+                // Note that the transition matrix of the MA already contains probabilities.
+                components.rateTransitions = false;
+            }
+
+            result.model = storm::utility::builder::buildModelFromComponents(originalModel.getType(), std::move(components));
+            return result;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        RewardModelType StatePermuter<ValueType, RewardModelType>::transformRewardModel(RewardModelType const& originalRewardModel, storm::storage::SparseMatrix<ValueType> const& originalTransitionMatrix, std::vector<storm::storage::sparse::state_type> const& permutation, std::vector<storm::storage::sparse::state_type> const& inversePermutation, std::vector<uint_fast64_t> const& choicePermutation) {
+            typedef typename RewardModelType::ValueType RewardValueType;
+            boost::optional<std::vector<RewardValueType>> stateRewardVector;
+            boost::optional<std::vector<RewardValueType>> stateActionRewardVector;
+            boost::optional<storm::storage::SparseMatrix<RewardValueType>> transitionRewardMatrix;
+            if (originalRewardModel.hasStateRewards()) {
+                stateRewardVector = storm::utility::permutation::permuteVector(originalRewardModel.getStateRewardVector(), permutation);
+            }
+            if (originalRewardModel.hasStateActionRewards()) {
+                stateActionRewardVector = storm::utility::permutation::permuteVector(originalRewardModel.getStateActionRewardVector(), choicePermutation);
+            }
+            if (originalRewardModel.hasTransitionRewards()) {
+                // The transition rewards need to be grouped like the transitions in order to permute the row groups.
+                storm::storage::SparseMatrix<RewardValueType> groupedTransitionRewards = originalRewardModel.getTransitionRewardMatrix();
+                bool hasTrivialRowGrouping = groupedTransitionRewards.hasTrivialRowGrouping();
+                groupedTransitionRewards.setRowGroupIndices(originalTransitionMatrix.getRowGroupIndices());
+                transitionRewardMatrix = groupedTransitionRewards.permuteRowGroupsAndColumns(permutation, inversePermutation);
+                if (hasTrivialRowGrouping) {
+                    transitionRewardMatrix->makeRowGroupingTrivial();
+                }
+            }
+            return RewardModelType(std::move(stateRewardVector), std::move(stateActionRewardVector), std::move(transitionRewardMatrix));
+        }
+
+        template class StatePermuter<double>;
+#ifdef STORM_HAVE_CARL
+        template class StatePermuter<storm::RationalNumber>;
+        template class StatePermuter<storm::RationalFunction>;
+#endif
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace transformer {
+
+        /*
+         * Renumbers the states of a sparse model. The transition matrix, the state and choice labelings, the reward
+         * models, the state valuations, the choice origins as well as model specific components (exit rates, Markovian
+         * states) are permuted consistently.
+         */
+        template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        class StatePermuter {
+        public:
+
+            struct ReturnType {
+                // The permuted model.
+                std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> model;
+                // Gives for each state of the permuted model the corresponding state of the original model.
+                std::vector<storm::storage::sparse::state_type> newToOldStateIndexMapping;
+                // Gives for each state of the original model the corresponding state of the permuted model.
+                std::vector<storm::storage::sparse::state_type> oldToNewStateIndexMapping;
+            };
+
+            /*!
+             * Permutes the states of the given model.
+             *
+             * @param originalModel The model whose states are to be renumbered.
+             * @param permutation Holds at position i the index of the state of the original model that is to become
+             * state i of the resulting model.
+             */
+            static ReturnType transform(storm::models::sparse::Model<ValueType, RewardModelType> const& originalModel, std::vector<storm::storage::sparse::state_type> const& permutation);
+
+            /*!
+             * Maps the given state-based values of the permuted model back to the states of the original model.
+             */
+            template<typename T>
+            static std::vector<T> restoreOriginalOrder(std::vector<T> const& values, ReturnType const& transformationResult) {
+                std::vector<T> result(values.size());
+                for (uint_fast64_t newState = 0; newState < values.size(); ++newState) {
+                    result[transformationResult.newToOldStateIndexMapping[newState]] = values[newState];
+                }
+                return result;
+            }
+
+        private:
+            static RewardModelType transformRewardModel(RewardModelType const& originalRewardModel, storm::storage::SparseMatrix<ValueType> const& originalTransitionMatrix, std::vector<storm::storage::sparse::state_type> const& permutation, std::vector<storm::storage::sparse::state_type> const& inversePermutation, std::vector<uint_fast64_t> const& choicePermutation);
+        };
+    }
+}
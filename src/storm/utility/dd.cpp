@@ -1,11 +1,15 @@
 #include "storm/utility/dd.h"
 
+#include <algorithm>
+#include <chrono>
+
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -45,17 +49,97 @@ namespace storm {
                 return reachableStates;
             }
             
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeReachableStatesByChaining(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
+                
+                auto start = std::chrono::high_resolution_clock::now();
+                storm::dd::DdManager<Type> const& manager = initialStates.getDdManager();
+                
+                // Sort the variable pairs by their position in the DDs.
+                std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> sortedPairs = rowColumnMetaVariablePairs;
+                std::sort(sortedPairs.begin(), sortedPairs.end(), [&manager] (std::pair<storm::expressions::Variable, storm::expressions::Variable> const& first, std::pair<storm::expressions::Variable, storm::expressions::Variable> const& second) { return manager.getMetaVariable(first.first).getLowestIndex() < manager.getMetaVariable(second.first).getLowestIndex(); });
+                
+                // Determine the topmost variable that is changed by each partition.
+                std::vector<std::pair<uint64_t, storm::dd::Bdd<Type>>> partitions;
+                for (auto const& partition : transitionPartitions) {
+                    if (partition.isZero()) {
+                        continue;
+                    }
+                    
+                    uint64_t top = 0;
+                    for (; top < sortedPairs.size(); ++top) {
+                        auto const& pair = sortedPairs[top];
+                        if (!partition.containsMetaVariable(pair.first) || !partition.containsMetaVariable(pair.second)) {
+                            break;
+                        }
+                        storm::dd::Bdd<Type> unchanged = partition.existsAbstract({pair.first, pair.second}) && manager.getIdentity(pair.first, pair.second);
+                        if (unchanged != partition) {
+                            break;
+                        }
+                    }
+                    partitions.emplace_back(top, partition);
+                }
+                std::stable_sort(partitions.begin(), partitions.end(), [] (std::pair<uint64_t, storm::dd::Bdd<Type>> const& first, std::pair<uint64_t, storm::dd::Bdd<Type>> const& second) { return first.first > second.first; });
+                
+                STORM_LOG_TRACE("Computing reachable states by chaining " << partitions.size() << " transition relation partition(s).");
+                storm::dd::Bdd<Type> reachableStates = initialStates;
+                
+                bool changed = true;
+                uint_fast64_t iteration = 0;
+                do {
+                    changed = false;
+                    for (auto const& partition : partitions) {
+                        storm::dd::Bdd<Type> newReachableStates = reachableStates.relationalProduct(partition.second, rowMetaVariables, columnMetaVariables) && !reachableStates;
+                        if (!newReachableStates.isZero()) {
+                            changed = true;
+                            reachableStates |= newReachableStates;
+                        }
+                    }
+                    
+                    ++iteration;
+                    STORM_LOG_TRACE("Iteration " << iteration << " of reachability computation completed: " << reachableStates.getNonZeroCount() << " reachable states found.");
+                } while (changed);
+                
+                auto end = std::chrono::high_resolution_clock::now();
+                STORM_LOG_TRACE("Reachability computation completed in " << iteration << " iterations (" << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << "ms).");
+                
+                return reachableStates;
+            }
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs) {
                 return ddManager.getIdentity(rowColumnMetaVariablePairs, false);
             }
             
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> roundToGranularity(storm::dd::Add<Type, ValueType> const& values, ValueType const& granularity, bool roundUp) {
+                storm::dd::Add<Type, ValueType> granularityAdd = values.getDdManager().getConstant(granularity);
+                storm::dd::Add<Type, ValueType> scaledValues = values / granularityAdd;
+                return (roundUp ? scaledValues.ceil() : scaledValues.floor()) * granularityAdd;
+            }
+            
+            template <typename ValueType>
+            bool isGranularityNegligible(ValueType const& granularity, ValueType const& precision) {
+                return granularity * storm::utility::convertNumber<ValueType>(100.0) <= precision;
+            }
+            
             template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, storm::dd::Bdd<storm::dd::DdType::CUDD> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStates(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, storm::dd::Bdd<storm::dd::DdType::Sylvan> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
 
+            template storm::dd::Bdd<storm::dd::DdType::CUDD> computeReachableStatesByChaining(storm::dd::Bdd<storm::dd::DdType::CUDD> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::CUDD>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            template storm::dd::Bdd<storm::dd::DdType::Sylvan> computeReachableStatesByChaining(storm::dd::Bdd<storm::dd::DdType::Sylvan> const& initialStates, std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+
             template storm::dd::Bdd<storm::dd::DdType::CUDD> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::CUDD> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
             template storm::dd::Bdd<storm::dd::DdType::Sylvan> getRowColumnDiagonal(storm::dd::DdManager<storm::dd::DdType::Sylvan> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
+            template storm::dd::Add<storm::dd::DdType::CUDD, double> roundToGranularity(storm::dd::Add<storm::dd::DdType::CUDD, double> const& values, double const& granularity, bool roundUp);
+            template storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> roundToGranularity(storm::dd::Add<storm::dd::DdType::CUDD, storm::RationalNumber> const& values, storm::RationalNumber const& granularity, bool roundUp);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, double> roundToGranularity(storm::dd::Add<storm::dd::DdType::Sylvan, double> const& values, double const& granularity, bool roundUp);
+            template storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> roundToGranularity(storm::dd::Add<storm::dd::DdType::Sylvan, storm::RationalNumber> const& values, storm::RationalNumber const& granularity, bool roundUp);
+
+            template bool isGranularityNegligible(double const& granularity, double const& precision);
+            template bool isGranularityNegligible(storm::RationalNumber const& granularity, storm::RationalNumber const& precision);
+
         }
     }
 }
@@ -23,14 +23,61 @@ namespace storm {
     namespace utility {
         namespace dd {
             
+            // The strategies that can be used to compute the reachable states symbolically.
+            enum class ReachabilityStrategy { Bfs, Chaining };
+            
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> computeReachableStates(storm::dd::Bdd<Type> const& initialStates, storm::dd::Bdd<Type> const& transitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables);
             
+            /*!
+             * Computes the reachable states by chaining, i.e. the transition relation is given as a disjunction of
+             * partitions (e.g. the transitions of the individual actions) and the images wrt. the partitions are added
+             * to the reachable states one after the other. The partitions are fired in the order of their topmost
+             * variable that is not kept unchanged, starting with the partitions that only change the variables at the
+             * bottom of the DDs. Compared to a BFS over the monolithic relation, this typically reduces the number of
+             * iterations as well as the size of the intermediate DDs.
+             *
+             * @param initialStates The initial states.
+             * @param transitionPartitions The partitions of the transition relation (over row and column variables).
+             * @param rowMetaVariables The row meta variables.
+             * @param columnMetaVariables The column meta variables.
+             * @param rowColumnMetaVariablePairs The pairs of row and column meta variables.
+             * @return The reachable states.
+             */
+            template <storm::dd::DdType Type>
+            storm::dd::Bdd<Type> computeReachableStatesByChaining(storm::dd::Bdd<Type> const& initialStates, std::vector<storm::dd::Bdd<Type>> const& transitionPartitions, std::set<storm::expressions::Variable> const& rowMetaVariables, std::set<storm::expressions::Variable> const& columnMetaVariables, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            
             template <storm::dd::DdType Type, typename ValueType>
             storm::dd::Add<Type, ValueType> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
 
             template <storm::dd::DdType Type>
             storm::dd::Bdd<Type> getRowColumnDiagonal(storm::dd::DdManager<Type> const& ddManager, std::vector<std::pair<storm::expressions::Variable, storm::expressions::Variable>> const& rowColumnMetaVariablePairs);
+            
+            /*!
+             * Rounds all values of the given ADD to multiples of the given granularity. This bounds the number of
+             * distinct values (and thereby typically the size) of the ADD. Rounding down (up) never increases
+             * (decreases) a value, so lower (upper) bounds remain bounds (up to floating point errors).
+             *
+             * @param values The values to round.
+             * @param granularity The granularity to which to round.
+             * @param roundUp If true, values are rounded up and otherwise down.
+             * @return The rounded values.
+             */
+            template <storm::dd::DdType Type, typename ValueType>
+            storm::dd::Add<Type, ValueType> roundToGranularity(storm::dd::Add<Type, ValueType> const& values, ValueType const& granularity, bool roundUp);
+
+            /*!
+             * Retrieves whether the given granularity is negligible compared to the given precision. Iterations that
+             * round their values to the granularity, but cannot bound them from above, may get stuck as soon as the
+             * changes in one iteration fall below the granularity. This only happens at a point where an unrounded
+             * iteration would stop as well, if the granularity is (much) smaller than the precision.
+             *
+             * @param granularity The granularity to which values are rounded.
+             * @param precision The precision of the termination criterion.
+             * @return True iff the granularity is at least a factor of 100 smaller than the precision.
+             */
+            template <typename ValueType>
+            bool isGranularityNegligible(ValueType const& granularity, ValueType const& precision);
                         
         }
     }
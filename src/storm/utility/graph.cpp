@@ -8,6 +8,7 @@
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -336,6 +337,13 @@ namespace storm {
                 storm::dd::Bdd<Type> lastIterationStates = manager.getBddZero();
                 storm::dd::Bdd<Type> statesWithProbabilityGreater0 = psiStates;
                 
+                // If the model provides a partitioned representation of the given transition matrix, we use it to
+                // compute the predecessors.
+                storm::dd::PartitionedTransitionRelation<Type> const* partitionedTransitionRelation = nullptr;
+                if (model.hasPartitionedTransitionRelation() && model.getPartitionedTransitionRelation().represents(transitionMatrix)) {
+                    partitionedTransitionRelation = &model.getPartitionedTransitionRelation();
+                }
+                
                 uint_fast64_t iterations = 0;
                 while (lastIterationStates != statesWithProbabilityGreater0) {
                     if (stepBound && iterations >= stepBound.get()) {
@@ -343,7 +351,11 @@ namespace storm {
                     }
                     
                     lastIterationStates = statesWithProbabilityGreater0;
-                    statesWithProbabilityGreater0 = statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    if (partitionedTransitionRelation) {
+                        statesWithProbabilityGreater0 = partitionedTransitionRelation->preimage(statesWithProbabilityGreater0);
+                    } else {
+                        statesWithProbabilityGreater0 = statesWithProbabilityGreater0.inverseRelationalProduct(transitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    }
                     statesWithProbabilityGreater0 &= phiStates;
                     statesWithProbabilityGreater0 |= lastIterationStates;
                     ++iterations;
@@ -917,10 +929,24 @@ namespace storm {
                 storm::dd::Bdd<Type> statesWithProbabilityGreater0E = psiStates;
                 
                 uint_fast64_t iterations = 0;
-                storm::dd::Bdd<Type> abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
+                
+                // If the model provides a partitioned representation of the given transition matrix, we use it to
+                // compute the predecessors. As the partitions do not contain the nondeterminism variables, we do not
+                // need to abstract from them in this case.
+                storm::dd::PartitionedTransitionRelation<Type> const* partitionedTransitionRelation = nullptr;
+                storm::dd::Bdd<Type> abstractedTransitionMatrix;
+                if (model.hasPartitionedTransitionRelation() && model.getPartitionedTransitionRelation().represents(transitionMatrix)) {
+                    partitionedTransitionRelation = &model.getPartitionedTransitionRelation();
+                } else {
+                    abstractedTransitionMatrix = transitionMatrix.existsAbstract(model.getNondeterminismVariables());
+                }
                 while (lastIterationStates != statesWithProbabilityGreater0E) {
                     lastIterationStates = statesWithProbabilityGreater0E;
-                    statesWithProbabilityGreater0E = statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    if (partitionedTransitionRelation) {
+                        statesWithProbabilityGreater0E = partitionedTransitionRelation->preimage(statesWithProbabilityGreater0E);
+                    } else {
+                        statesWithProbabilityGreater0E = statesWithProbabilityGreater0E.inverseRelationalProduct(abstractedTransitionMatrix, model.getRowVariables(), model.getColumnVariables());
+                    }
                     statesWithProbabilityGreater0E &= phiStates;
                     statesWithProbabilityGreater0E |= lastIterationStates;
                     ++iterations;
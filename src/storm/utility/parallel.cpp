@@ -0,0 +1,26 @@
+#include "storm/utility/parallel.h"
+
+#include <thread>
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ResourceSettings.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            uint_fast64_t getNumberOfThreads() {
+#ifdef STORM_HAVE_INTELTBB
+                uint_fast64_t numberOfThreads = storm::settings::getModule<storm::settings::modules::ResourceSettings>().getNumberOfThreads();
+                if (numberOfThreads == 0) {
+                    numberOfThreads = std::thread::hardware_concurrency();
+                }
+                return numberOfThreads > 0 ? numberOfThreads : 1;
+#else
+                return 1;
+#endif
+            }
+
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+
+#include "storm-config.h"
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/tbb.h"
+#endif
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * Retrieves the number of threads that may be used for parallel computations. This is the number of threads
+             * set in the resource settings (or the number of hardware threads, if none is set), independently of the DD
+             * library that is used, and one if Intel TBB is not available.
+             */
+            uint_fast64_t getNumberOfThreads();
+
+            /*!
+             * Retrieves the number of levels of a (binary) recursion in which both branches are to be executed in
+             * parallel so that there are sufficiently many tasks to keep all threads busy.
+             *
+             * @param workload An estimate of the amount of work of the recursion.
+             * @param minimalWorkload The minimal workload for which the recursion is parallelized at all.
+             */
+            inline uint_fast64_t getNumberOfParallelRecursionLevels(uint_fast64_t workload, uint_fast64_t minimalWorkload) {
+                uint_fast64_t numberOfThreads = getNumberOfThreads();
+                if (numberOfThreads == 1 || workload < minimalWorkload) {
+                    return 0;
+                }
+
+                // We create (roughly) four tasks per thread to compensate for unbalanced branches.
+                uint_fast64_t levels = 2;
+                while ((1ull << levels) < numberOfThreads * 4) {
+                    ++levels;
+                }
+                return levels;
+            }
+
+            /*!
+             * Executes the given function such that tasks it spawns (e.g. via invoke) use at most the configured number
+             * of threads.
+             */
+            template<typename Function>
+            void execute(Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::task_arena arena(static_cast<int>(getNumberOfThreads()));
+                arena.execute(function);
+#else
+                function();
+#endif
+            }
+
+            /*!
+             * Executes the two given functions. If possible, this is done in parallel.
+             */
+            template<typename Function1, typename Function2>
+            void invoke(Function1 const& function1, Function2 const& function2) {
+#ifdef STORM_HAVE_INTELTBB
+                tbb::parallel_invoke(function1, function2);
+#else
+                function1();
+                function2();
+#endif
+            }
+
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include "storm/utility/permutation.h"
+
+#include <algorithm>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/vector.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+        namespace permutation {
+
+            std::string toString(OrderKind const& order) {
+                switch (order) {
+                    case OrderKind::None:
+                        return "none";
+                    case OrderKind::ReverseCuthillMcKee:
+                        return "rcm";
+                    case OrderKind::Topological:
+                        return "scc";
+                    case OrderKind::BackwardBfs:
+                        return "backwardbfs";
+                }
+                return "invalid";
+            }
+
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> createReverseCuthillMcKeePermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                if (numberOfStates == 0) {
+                    return std::vector<storm::storage::sparse::state_type>();
+                }
+                storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+
+                // The ordering works on the undirected graph, so the degree of a state takes both directions into account.
+                std::vector<uint_fast64_t> degrees(numberOfStates, 0);
+                for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+                    degrees[state] = transitionMatrix.getRowGroup(state).getNumberOfEntries() + backwardTransitions.getRow(state).getNumberOfEntries();
+                }
+                auto lowerDegree = [&degrees] (storm::storage::sparse::state_type const& a, storm::storage::sparse::state_type const& b) { return degrees[a] < degrees[b] || (degrees[a] == degrees[b] && a < b); };
+
+                // Each connected component is started from a state of minimal degree.
+                std::vector<storm::storage::sparse::state_type> startCandidates = storm::utility::vector::buildVectorForRange(0, numberOfStates);
+                std::sort(startCandidates.begin(), startCandidates.end(), lowerDegree);
+
+                std::vector<storm::storage::sparse::state_type> result;
+                result.reserve(numberOfStates);
+                storm::storage::BitVector visited(numberOfStates, false);
+                std::vector<storm::storage::sparse::state_type> neighbours;
+                for (auto const& startState : startCandidates) {
+                    if (visited.get(startState)) {
+                        continue;
+                    }
+
+                    // The result vector doubles as the queue of the breadth-first search.
+                    uint_fast64_t queueHead = result.size();
+                    result.push_back(startState);
+                    visited.set(startState);
+                    while (queueHead < result.size()) {
+                        storm::storage::sparse::state_type currentState = result[queueHead++];
+
+                        neighbours.clear();
+                        for (auto const& entry : transitionMatrix.getRowGroup(currentState)) {
+                            if (!visited.get(entry.getColumn())) {
+                                visited.set(entry.getColumn());
+                                neighbours.push_back(entry.getColumn());
+                            }
+                        }
+                        for (auto const& entry : backwardTransitions.getRow(currentState)) {
+                            if (!visited.get(entry.getColumn())) {
+                                visited.set(entry.getColumn());
+                                neighbours.push_back(entry.getColumn());
+                            }
+                        }
+                        std::sort(neighbours.begin(), neighbours.end(), lowerDegree);
+                        result.insert(result.end(), neighbours.begin(), neighbours.end());
+                    }
+                }
+
+                std::reverse(result.begin(), result.end());
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> createTopologicalPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+                storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(transitionMatrix);
+                sccDecomposition.sortTopologically(transitionMatrix);
+
+                // Since the SCCs are sorted such that every SCC only reaches preceding SCCs, successors get lower indices
+                // than their predecessors (apart from transitions within an SCC).
+                std::vector<storm::storage::sparse::state_type> result;
+                result.reserve(transitionMatrix.getRowGroupCount());
+                for (auto const& scc : sccDecomposition) {
+                    result.insert(result.end(), scc.begin(), scc.end());
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> createBackwardBfsPermutation(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& targetStates) {
+                uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
+                STORM_LOG_THROW(targetStates.size() == numberOfStates, storm::exceptions::InvalidArgumentException, "The number of target states does not match the number of states.");
+                storm::storage::SparseMatrix<ValueType> backwardTransitions = transitionMatrix.transpose(true);
+
+                std::vector<storm::storage::sparse::state_type> result(targetStates.begin(), targetStates.end());
+                result.reserve(numberOfStates);
+                storm::storage::BitVector visited = targetStates;
+                for (uint_fast64_t queueHead = 0; queueHead < result.size(); ++queueHead) {
+                    for (auto const& entry : backwardTransitions.getRow(result[queueHead])) {
+                        if (!visited.get(entry.getColumn())) {
+                            visited.set(entry.getColumn());
+                            result.push_back(entry.getColumn());
+                        }
+                    }
+                }
+
+                // States that can not reach a target state keep their relative order and are moved to the end.
+                for (auto const& state : ~visited) {
+                    result.push_back(state);
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> createPermutation(OrderKind const& order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& targetStates) {
+                std::vector<storm::storage::sparse::state_type> result;
+                switch (order) {
+                    case OrderKind::ReverseCuthillMcKee:
+                        result = createReverseCuthillMcKeePermutation(transitionMatrix);
+                        break;
+                    case OrderKind::Topological:
+                        result = createTopologicalPermutation(transitionMatrix);
+                        break;
+                    case OrderKind::BackwardBfs:
+                        result = createBackwardBfsPermutation(transitionMatrix, targetStates);
+                        break;
+                    case OrderKind::None:
+                        STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Can not create a permutation for order kind '" << toString(order) << "'.");
+                }
+                STORM_LOG_ASSERT(isValidPermutation(result), "The computed state order is not a permutation.");
+                return result;
+            }
+
+            std::vector<storm::storage::sparse::state_type> invertPermutation(std::vector<storm::storage::sparse::state_type> const& permutation) {
+                std::vector<storm::storage::sparse::state_type> result(permutation.size());
+                for (uint_fast64_t index = 0; index < permutation.size(); ++index) {
+                    result[permutation[index]] = index;
+                }
+                return result;
+            }
+
+            bool isValidPermutation(std::vector<storm::storage::sparse::state_type> const& permutation) {
+                storm::storage::BitVector occurring(permutation.size(), false);
+                for (auto const& index : permutation) {
+                    if (index >= permutation.size() || occurring.get(index)) {
+                        return false;
+                    }
+                    occurring.set(index);
+                }
+                return true;
+            }
+
+            storm::storage::BitVector permuteBitVector(storm::storage::BitVector const& bitVector, std::vector<storm::storage::sparse::state_type> const& permutation) {
+                storm::storage::BitVector result(permutation.size(), false);
+                for (uint_fast64_t index = 0; index < permutation.size(); ++index) {
+                    if (bitVector.get(permutation[index])) {
+                        result.set(index);
+                    }
+                }
+                return result;
+            }
+
+            template std::vector<storm::storage::sparse::state_type> createPermutation(OrderKind const& order, storm::storage::SparseMatrix<double> const& transitionMatrix, storm::storage::BitVector const& targetStates);
+#ifdef STORM_HAVE_CARL
+            template std::vector<storm::storage::sparse::state_type> createPermutation(OrderKind const& order, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix, storm::storage::BitVector const& targetStates);
+            template std::vector<storm::storage::sparse::state_type> createPermutation(OrderKind const& order, storm::storage::SparseMatrix<storm::RationalFunction> const& transitionMatrix, storm::storage::BitVector const& targetStates);
+#endif
+        }
+    }
+}
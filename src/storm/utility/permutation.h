@@ -0,0 +1,80 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace storage {
+        class BitVector;
+
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace utility {
+        namespace permutation {
+
+            /*!
+             * The available strategies for renumbering the states of a model.
+             */
+            enum class OrderKind {
+                // Keeps the order given by the model.
+                None,
+                // Reverse Cuthill-McKee ordering of the (symmetrized) transition graph that reduces the bandwidth of the matrix.
+                ReverseCuthillMcKee,
+                // Orders the SCCs of the transition graph such that every SCC only reaches SCCs that precede it.
+                Topological,
+                // Breadth-first order of a backwards search that starts in the target states.
+                BackwardBfs
+            };
+
+            std::string toString(OrderKind const& order);
+
+            /*!
+             * Computes a permutation of the states (row groups) of the given matrix according to the given ordering.
+             *
+             * @param order The ordering strategy to use. Must not be OrderKind::None.
+             * @param transitionMatrix The transition matrix whose states are to be ordered.
+             * @param targetStates The states from which a backward search starts (only relevant for OrderKind::BackwardBfs).
+             * @return A vector that contains at position i the (old) index of the state that is supposed to get index i.
+             * Every state occurs exactly once.
+             */
+            template<typename ValueType>
+            std::vector<storm::storage::sparse::state_type> createPermutation(OrderKind const& order, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& targetStates);
+
+            /*!
+             * Inverts the given permutation, i.e. if the input maps new indices to old ones, the output maps old indices
+             * to new ones and vice versa.
+             */
+            std::vector<storm::storage::sparse::state_type> invertPermutation(std::vector<storm::storage::sparse::state_type> const& permutation);
+
+            /*!
+             * Checks whether the given vector is a permutation of {0, ..., n-1} where n is the size of the vector.
+             */
+            bool isValidPermutation(std::vector<storm::storage::sparse::state_type> const& permutation);
+
+            /*!
+             * Permutes the given bit vector such that the i-th bit of the result is the bit at position permutation[i]
+             * of the input.
+             */
+            storm::storage::BitVector permuteBitVector(storm::storage::BitVector const& bitVector, std::vector<storm::storage::sparse::state_type> const& permutation);
+
+            /*!
+             * Permutes the given vector such that the i-th entry of the result is the entry at position permutation[i]
+             * of the input.
+             */
+            template<typename T>
+            std::vector<T> permuteVector(std::vector<T> const& vector, std::vector<storm::storage::sparse::state_type> const& permutation) {
+                std::vector<T> result;
+                result.reserve(permutation.size());
+                for (auto const& oldIndex : permutation) {
+                    result.push_back(vector[oldIndex]);
+                }
+                return result;
+            }
+
+        }
+    }
+}
@@ -0,0 +1,102 @@
+#include "storm/utility/sha256.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+
+namespace storm {
+    namespace utility {
+
+        namespace {
+            // The round constants as given in FIPS 180-4.
+            const std::array<uint32_t, 64> roundConstants = {{
+                0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+                0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+                0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+                0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+                0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+                0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+                0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+                0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+            }};
+
+            inline uint32_t rotateRight(uint32_t value, unsigned bits) {
+                return (value >> bits) | (value << (32 - bits));
+            }
+
+            void processBlock(std::array<uint32_t, 8>& state, unsigned char const* block) {
+                std::array<uint32_t, 64> schedule;
+                for (unsigned i = 0; i < 16; ++i) {
+                    schedule[i] = (static_cast<uint32_t>(block[4 * i]) << 24) | (static_cast<uint32_t>(block[4 * i + 1]) << 16) | (static_cast<uint32_t>(block[4 * i + 2]) << 8) | static_cast<uint32_t>(block[4 * i + 3]);
+                }
+                for (unsigned i = 16; i < 64; ++i) {
+                    uint32_t s0 = rotateRight(schedule[i - 15], 7) ^ rotateRight(schedule[i - 15], 18) ^ (schedule[i - 15] >> 3);
+                    uint32_t s1 = rotateRight(schedule[i - 2], 17) ^ rotateRight(schedule[i - 2], 19) ^ (schedule[i - 2] >> 10);
+                    schedule[i] = schedule[i - 16] + s0 + schedule[i - 7] + s1;
+                }
+
+                uint32_t a = state[0], b = state[1], c = state[2], d = state[3], e = state[4], f = state[5], g = state[6], h = state[7];
+                for (unsigned i = 0; i < 64; ++i) {
+                    uint32_t s1 = rotateRight(e, 6) ^ rotateRight(e, 11) ^ rotateRight(e, 25);
+                    uint32_t choice = (e & f) ^ (~e & g);
+                    uint32_t temp1 = h + s1 + choice + roundConstants[i] + schedule[i];
+                    uint32_t s0 = rotateRight(a, 2) ^ rotateRight(a, 13) ^ rotateRight(a, 22);
+                    uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+                    uint32_t temp2 = s0 + majority;
+                    h = g;
+                    g = f;
+                    f = e;
+                    e = d + temp1;
+                    d = c;
+                    c = b;
+                    b = a;
+                    a = temp1 + temp2;
+                }
+                state[0] += a;
+                state[1] += b;
+                state[2] += c;
+                state[3] += d;
+                state[4] += e;
+                state[5] += f;
+                state[6] += g;
+                state[7] += h;
+            }
+        }
+
+        std::string sha256(std::string const& data) {
+            std::array<uint32_t, 8> state = {{0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19}};
+
+            // Process all complete blocks of the data.
+            unsigned char const* bytes = reinterpret_cast<unsigned char const*>(data.data());
+            std::size_t completeBlocksLength = data.size() - data.size() % 64;
+            for (std::size_t offset = 0; offset < completeBlocksLength; offset += 64) {
+                processBlock(state, bytes + offset);
+            }
+
+            // Pad the remaining data with a one bit, zeros and the length of the data in bits.
+            std::array<unsigned char, 128> lastBlocks;
+            lastBlocks.fill(0);
+            std::size_t remainingLength = data.size() - completeBlocksLength;
+            std::copy(bytes + completeBlocksLength, bytes + data.size(), lastBlocks.begin());
+            lastBlocks[remainingLength] = 0x80;
+            std::size_t paddedLength = remainingLength < 56 ? 64 : 128;
+            uint64_t bitLength = static_cast<uint64_t>(data.size()) * 8;
+            for (unsigned i = 0; i < 8; ++i) {
+                lastBlocks[paddedLength - 1 - i] = static_cast<unsigned char>(bitLength >> (8 * i));
+            }
+            for (std::size_t offset = 0; offset < paddedLength; offset += 64) {
+                processBlock(state, lastBlocks.data() + offset);
+            }
+
+            std::stringstream digestStream;
+            digestStream << std::hex << std::setfill('0');
+            for (auto const& word : state) {
+                digestStream << std::setw(8) << word;
+            }
+            return digestStream.str();
+        }
+
+    }
+}
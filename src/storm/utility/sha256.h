@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+
+namespace storm {
+    namespace utility {
+
+        /*!
+         * Computes the SHA-256 digest of the given data.
+         *
+         * @param data The data to hash.
+         * @return The digest as a string of 64 lowercase hexadecimal digits.
+         */
+        std::string sha256(std::string const& data);
+
+    }
+}
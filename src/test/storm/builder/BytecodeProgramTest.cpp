@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/BytecodeProgram.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/expressions/ExpressionEvaluator.h"
+
+TEST(BytecodeProgramTest, AgreesWithEvaluator) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString("dtmc\n\nmodule test\n\tb : bool init false;\n\tx : [-3..5] init 0;\n\ty : [2..4] init 2;\n\n\t[] true -> 1 : true;\nendmodule\n", "test.pm");
+    storm::expressions::ExpressionManager const& manager = program.getManager();
+    storm::generator::VariableInformation variableInformation(program);
+
+    storm::expressions::Expression b = manager.getVariableExpression("b");
+    storm::expressions::Expression x = manager.getVariableExpression("x");
+    storm::expressions::Expression y = manager.getVariableExpression("y");
+
+    std::vector<storm::expressions::Expression> expressions = {
+        x + y > manager.integer(3) && !b,
+        storm::expressions::ite(b, x * y, -x),
+        x / y,
+        storm::expressions::floor(x / y) + storm::expressions::ceil(x / y),
+        storm::expressions::minimum(x, y) - storm::expressions::maximum(x, manager.integer(1)),
+        x ^ y,
+        storm::expressions::implies(b, x == y) || storm::expressions::xclusiveor(b, x != manager.integer(2)),
+        x * manager.rational(0.5) <= y - manager.integer(2),
+        storm::expressions::iff(b, x >= y),
+        x / y == manager.rational(0.5),
+        // Rationals are compared exactly, so values that only differ slightly are not equal.
+        x / y != x / y + manager.rational(1e-12)
+    };
+
+    storm::generator::BytecodeProgram bytecode(variableInformation);
+    std::vector<uint64_t> indices;
+    for (auto const& expression : expressions) {
+        ASSERT_TRUE(bytecode.canCompile(expression));
+        indices.push_back(bytecode.addExpression(expression));
+    }
+
+    storm::expressions::ExpressionEvaluator<double> evaluator(manager);
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (bool bValue : {false, true}) {
+        for (int_fast64_t xValue = -3; xValue <= 5; ++xValue) {
+            for (int_fast64_t yValue = 2; yValue <= 4; ++yValue) {
+                for (auto const& booleanVariable : variableInformation.booleanVariables) {
+                    state.set(booleanVariable.bitOffset, bValue);
+                }
+                for (auto const& integerVariable : variableInformation.integerVariables) {
+                    int_fast64_t value = integerVariable.variable.getName() == "x" ? xValue : yValue;
+                    state.setFromInt(integerVariable.bitOffset, integerVariable.bitWidth, value - integerVariable.lowerBound);
+                }
+                storm::generator::unpackStateIntoEvaluator(state, variableInformation, evaluator);
+                bytecode.execute(state);
+
+                for (uint64_t index = 0; index < expressions.size(); ++index) {
+                    if (expressions[index].hasBooleanType()) {
+                        EXPECT_EQ(evaluator.asBool(expressions[index]), bytecode.getBooleanValue(indices[index])) << expressions[index];
+                    } else if (expressions[index].hasIntegerType()) {
+                        EXPECT_EQ(evaluator.asInt(expressions[index]), bytecode.getIntegerValue(indices[index])) << expressions[index];
+                    } else {
+                        EXPECT_NEAR(evaluator.asRational(expressions[index]), bytecode.getRationalValue(indices[index]), 1e-12) << expressions[index];
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(BytecodeProgramTest, RejectsNonStateVariables) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::BytecodeProgram bytecode(variableInformation);
+
+    storm::expressions::Variable p = program.getManager().declareRationalVariable("p");
+    EXPECT_TRUE(bytecode.canCompile(program.getManager().getVariableExpression("s") > program.getManager().integer(2)));
+    EXPECT_FALSE(bytecode.canCompile(p.getExpression() > program.getManager().rational(0.5)));
+}
+
+TEST(BytecodeProgramTest, BuildModels) {
+    std::vector<std::string> files = {STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", STORM_TEST_RESOURCES_DIR "/dtmc/brp-16-2.pm", STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm", STORM_TEST_RESOURCES_DIR "/mdp/csma2-2.nm", STORM_TEST_RESOURCES_DIR "/ma/simple.ma"};
+    for (auto const& file : files) {
+        storm::prism::Program program = storm::parser::PrismParser::parse(file);
+
+        storm::generator::NextStateGeneratorOptions options;
+        options.setBuildAllRewardModels().setBuildAllLabels();
+        std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+        options.setBytecode();
+        std::shared_ptr<storm::models::sparse::Model<double>> bytecodeModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+        EXPECT_EQ(model->getNumberOfStates(), bytecodeModel->getNumberOfStates()) << file;
+        EXPECT_EQ(model->getNumberOfTransitions(), bytecodeModel->getNumberOfTransitions()) << file;
+        EXPECT_EQ(model->getNumberOfChoices(), bytecodeModel->getNumberOfChoices()) << file;
+        EXPECT_TRUE(model->getTransitionMatrix() == bytecodeModel->getTransitionMatrix()) << file;
+    }
+}
@@ -12,6 +12,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/DdJaniModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
@@ -292,6 +293,75 @@ TEST(DdJaniModelBuilderTest_Cudd, Mdp) {
     EXPECT_EQ(59ul, mdp->getNumberOfChoices());
 }
 
+TEST(DdJaniModelBuilderTest_Cudd, ChainingReachability) {
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double>::Options options;
+    options.reachabilityStrategy = storm::utility::dd::ReachabilityStrategy::Chaining;
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double> builder;
+    
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm");
+    storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = builder.build(janiModel, options);
+    EXPECT_EQ(273ul, model->getNumberOfStates());
+    EXPECT_EQ(397ul, model->getNumberOfTransitions());
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    model = builder.build(janiModel, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+    EXPECT_EQ(169ul, mdp->getNumberOfStates());
+    EXPECT_EQ(436ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(254ul, mdp->getNumberOfChoices());
+}
+
+TEST(DdJaniModelBuilderTest_Cudd, VariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::jani::Model dtmcModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::jani::Model mdpModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double> builder;
+    
+    for (auto const& ordering : {storm::builder::DdVariableOrdering::Declaration, storm::builder::DdVariableOrdering::Force, storm::builder::DdVariableOrdering::ModuleForce}) {
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::CUDD, double>::Options options;
+        options.variableOrdering = ordering;
+        
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = builder.build(dtmcModel, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+        
+        model = builder.build(mdpModel, options);
+        EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+        EXPECT_EQ(272ul, mdp->getNumberOfStates());
+        EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+    }
+}
+
+TEST(DdJaniModelBuilderTest_Sylvan, VariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::jani::Model dtmcModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::jani::Model mdpModel = modelDescription.toJani(true).preprocess().asJaniModel();
+    storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double> builder;
+    
+    for (auto const& ordering : {storm::builder::DdVariableOrdering::Declaration, storm::builder::DdVariableOrdering::Force, storm::builder::DdVariableOrdering::ModuleForce}) {
+        storm::builder::DdJaniModelBuilder<storm::dd::DdType::Sylvan, double>::Options options;
+        options.variableOrdering = ordering;
+        
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = builder.build(dtmcModel, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+        
+        model = builder.build(mdpModel, options);
+        EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+        EXPECT_EQ(272ul, mdp->getNumberOfStates());
+        EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+    }
+}
+
 TEST(DdJaniModelBuilderTest_Cudd, IllegalSynchronizingWrites) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2-illegalSynchronizingWrite.nm");
     storm::jani::Model janiModel = modelDescription.toJani(true).preprocess().asJaniModel();
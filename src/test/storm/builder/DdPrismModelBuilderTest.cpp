@@ -10,6 +10,7 @@
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/parser/PrismParser.h"
 #include "storm/builder/DdPrismModelBuilder.h"
+#include "storm/builder/DdVariableOrdering.h"
 
 TEST(DdPrismModelBuilderTest_Sylvan, Dtmc) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -319,3 +320,59 @@ TEST(DdPrismModelBuilderTest_Cudd, Composition) {
     EXPECT_EQ(21ul, mdp->getNumberOfChoices());
 }
 
+
+TEST(DdPrismModelBuilderTest_Cudd, VariableOrdering) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program dtmcProgram = modelDescription.preprocess().asPrismProgram();
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    storm::prism::Program mdpProgram = modelDescription.preprocess().asPrismProgram();
+    
+    for (auto const& ordering : {storm::builder::DdVariableOrdering::Declaration, storm::builder::DdVariableOrdering::Force, storm::builder::DdVariableOrdering::ModuleForce}) {
+        storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>::Options options;
+        options.variableOrdering = ordering;
+        
+        std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(dtmcProgram, options);
+        EXPECT_EQ(8607ul, model->getNumberOfStates());
+        EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+        
+        model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD>().build(mdpProgram, options);
+        EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+        std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD>>();
+        EXPECT_EQ(272ul, mdp->getNumberOfStates());
+        EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+        EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+    }
+}
+
+TEST(DdPrismModelBuilderTest_Sylvan, ChainingReachability) {
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.reachabilityStrategy = storm::utility::dd::ReachabilityStrategy::Chaining;
+    
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/coin2-2.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    EXPECT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>> mdp = model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>();
+    EXPECT_EQ(272ul, mdp->getNumberOfStates());
+    EXPECT_EQ(492ul, mdp->getNumberOfTransitions());
+    EXPECT_EQ(400ul, mdp->getNumberOfChoices());
+}
+
+TEST(DdPrismModelBuilderTest, ForceOrder) {
+    // Items 0 and 2 as well as 1 and 3 are related, so they should end up next to each other.
+    std::vector<std::vector<uint64_t>> hyperedges = {{0, 2}, {1, 3}, {0, 2}};
+    std::vector<uint64_t> order = storm::builder::computeForceOrder(4, hyperedges);
+    ASSERT_EQ(4ul, order.size());
+    std::vector<uint64_t> positions(4);
+    for (uint64_t position = 0; position < order.size(); ++position) {
+        positions[order[position]] = position;
+    }
+    EXPECT_EQ(1ul, std::max(positions[0], positions[2]) - std::min(positions[0], positions[2]));
+    EXPECT_EQ(1ul, std::max(positions[1], positions[3]) - std::min(positions[1], positions[3]));
+}
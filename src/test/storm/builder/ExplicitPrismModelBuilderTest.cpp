@@ -3,8 +3,15 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/parser/PrismParser.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/logic/Formulas.h"
+#include "storm/api/verification.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 
+#include <boost/filesystem.hpp>
+
 
 TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
@@ -34,6 +41,110 @@ TEST(ExplicitPrismModelBuilderTest, Dtmc) {
     EXPECT_EQ(2505ul, model->getNumberOfTransitions());
 }
 
+TEST(ExplicitPrismModelBuilderTest, SpillStatesToExplore) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    
+    storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+    builderOptions.explorationOrder = storm::builder::ExplorationOrder::Bfs;
+    builderOptions.spillDirectory = boost::filesystem::temp_directory_path().string();
+    builderOptions.spillThreshold = 16;
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(), builderOptions).build();
+    EXPECT_EQ(8607ul, model->getNumberOfStates());
+    EXPECT_EQ(15113ul, model->getNumberOfTransitions());
+}
+
+TEST(ExplicitPrismModelBuilderTest, TerminalStatesFromFormula) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    
+    // The die is only thrown to one via s=3, so this state is not expanded if its probability is already known.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [ G !(s=3) ]");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(*formula)).build();
+    EXPECT_EQ(12ul, model->getNumberOfStates());
+    
+    formula = formulaParser.parseSingleFormulaFromString("P=? [ F (\"two\" | s=3) ]");
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(*formula)).build();
+    EXPECT_EQ(12ul, model->getNumberOfStates());
+    
+    formula = formulaParser.parseSingleFormulaFromString("P=? [ !(s=1) U<=5 (s=3 & d=0) ]");
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(*formula)).build();
+    EXPECT_EQ(8ul, model->getNumberOfStates());
+    
+    // The next operator depends on the successors of the states, so no state can be treated as terminal.
+    formula = formulaParser.parseSingleFormulaFromString("P=? [ X s=3 ]");
+    model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(*formula)).build();
+    EXPECT_EQ(13ul, model->getNumberOfStates());
+}
+
+TEST(ExplicitPrismModelBuilderTest, TerminalStatesWithNestedOperators) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::parser::FormulaParser formulaParser(program);
+    
+    // The probability to throw two is 1/6 initially, but only 1/8 if s=3 is not expanded, so the nested operator
+    // must not let s=3 become terminal.
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [ F (P>0.15 [ F \"two\" ] | s=3) ]");
+    storm::generator::NextStateGeneratorOptions options(*formula);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    options.clearTerminalStates();
+    std::shared_ptr<storm::models::sparse::Model<double>> fullModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(13ul, fullModel->getNumberOfStates());
+    
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+    std::unique_ptr<storm::modelchecker::CheckResult> fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, storm::api::createTask<double>(formula, true));
+    EXPECT_NEAR(1.0, fullResult->asExplicitQuantitativeCheckResult<double>()[*fullModel->getInitialStates().begin()], 1e-6);
+    EXPECT_NEAR(fullResult->asExplicitQuantitativeCheckResult<double>()[*fullModel->getInitialStates().begin()], result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    
+    // The same holds for operators nested in a state formula.
+    formula = formulaParser.parseSingleFormulaFromString("P>0.15 [ F \"two\" ] | s=3");
+    options = storm::generator::NextStateGeneratorOptions(*formula);
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    options.clearTerminalStates();
+    fullModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    
+    result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+    fullResult = storm::api::verifyWithSparseEngine<double>(fullModel, storm::api::createTask<double>(formula, true));
+    EXPECT_TRUE(fullResult->asExplicitQualitativeCheckResult()[*fullModel->getInitialStates().begin()]);
+    EXPECT_EQ(fullResult->asExplicitQualitativeCheckResult()[*fullModel->getInitialStates().begin()], result->asExplicitQualitativeCheckResult()[*model->getInitialStates().begin()]);
+}
+
+TEST(ExplicitPrismModelBuilderTest, Prob01Pruning) {
+    // Choosing s=1 reaches the goal right away, so s=2 and its successors do not influence the maximal probability.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString("mdp\n\nmodule test\n\ts : [0..6] init 0;\n\n\t[] s=0 -> (s'=1);\n\t[] s=0 -> (s'=2);\n\t[] s=1 -> true;\n\t[] s=2 -> 0.5 : (s'=3) + 0.5 : (s'=4);\n\t[] s=3 -> (s'=5);\n\t[] s=4 -> (s'=6);\n\t[] s=5 -> (s'=1);\n\t[] s=6 -> true;\nendmodule\n\nlabel \"goal\" = s=1;\n", "pruning.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("Pmax=? [ F \"goal\" ]");
+    storm::generator::NextStateGeneratorOptions options(*formula);
+    options.setProb01Pruning();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(3ul, model->getNumberOfStates());
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+    EXPECT_NEAR(1.0, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    
+    // For the minimal probability, the choice of s=2 matters, so all states are expanded.
+    formula = formulaParser.parseSingleFormulaFromString("Pmin=? [ F \"goal\" ]");
+    options = storm::generator::NextStateGeneratorOptions(*formula);
+    options.setProb01Pruning();
+    model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(7ul, model->getNumberOfStates());
+    result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+    EXPECT_NEAR(0.5, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    
+    // The state s=3 is deferred after s=1 is decided, but must be explored once the undecided state s=8 reaches it.
+    program = storm::parser::PrismParser::parseFromString("mdp\n\nmodule test\n\ts : [0..8] init 0;\n\n\t[] s=0 -> 0.5 : (s'=1) + 0.5 : (s'=7);\n\t[] s=1 -> (s'=2);\n\t[] s=1 -> (s'=3);\n\t[] s=2 -> true;\n\t[] s=3 -> 0.5 : (s'=4) + 0.5 : (s'=5);\n\t[] s=4 -> (s'=2);\n\t[] s=5 -> true;\n\t[] s=7 -> (s'=8);\n\t[] s=8 -> (s'=3);\nendmodule\n\nlabel \"goal\" = s=2;\n", "deferred.nm");
+    formulaParser = storm::parser::FormulaParser(program);
+    formula = formulaParser.parseSingleFormulaFromString("Pmax=? [ F \"goal\" ]");
+    options = storm::generator::NextStateGeneratorOptions(*formula);
+    options.setProb01Pruning();
+    for (auto explorationOrder : {storm::builder::ExplorationOrder::Bfs, storm::builder::ExplorationOrder::Dfs}) {
+        storm::builder::ExplicitModelBuilder<double>::Options builderOptions;
+        builderOptions.explorationOrder = explorationOrder;
+        model = storm::builder::ExplicitModelBuilder<double>(program, options, builderOptions).build();
+        EXPECT_EQ(8ul, model->getNumberOfStates());
+        result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(0.75, result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], 1e-6);
+    }
+}
+
 TEST(ExplicitPrismModelBuilderTest, Ctmc) {
 
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/ctmc/cluster2.sm", true);
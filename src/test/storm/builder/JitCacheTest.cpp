@@ -0,0 +1,95 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <fstream>
+
+#include "storm/builder/jit/JitCache.h"
+
+namespace {
+    void writeFile(boost::filesystem::path const& file, std::string const& content) {
+        std::ofstream out(file.native());
+        out << content;
+    }
+}
+
+TEST(JitCacheTest, PrivateDirectory) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-test-%%%%-%%%%");
+    boost::filesystem::create_directory(directory);
+    boost::filesystem::permissions(directory, boost::filesystem::all_all);
+
+    // The permissions of an existing directory are restricted.
+    storm::builder::jit::JitCache cache(directory);
+    EXPECT_TRUE(cache.prepare());
+    EXPECT_EQ(boost::filesystem::owner_all, boost::filesystem::status(directory).permissions() & boost::filesystem::all_all);
+
+    // Missing directories are created.
+    storm::builder::jit::JitCache nestedCache(directory / "nested" / "cache");
+    EXPECT_TRUE(nestedCache.prepare());
+    EXPECT_TRUE(boost::filesystem::is_directory(nestedCache.getDirectory()));
+    EXPECT_EQ(boost::filesystem::owner_all, boost::filesystem::status(nestedCache.getDirectory()).permissions() & boost::filesystem::all_all);
+
+    boost::filesystem::remove_all(directory);
+}
+
+TEST(JitCacheTest, Key) {
+    EXPECT_FALSE(storm::builder::jit::JitCache::getBuildIdentifier().empty());
+    EXPECT_EQ(storm::builder::jit::JitCache::getKey("content", "c++ -O3"), storm::builder::jit::JitCache::getKey("content", "c++ -O3"));
+    EXPECT_NE(storm::builder::jit::JitCache::getKey("content", "c++ -O3"), storm::builder::jit::JitCache::getKey("content2", "c++ -O3"));
+    EXPECT_NE(storm::builder::jit::JitCache::getKey("content", "c++ -O3"), storm::builder::jit::JitCache::getKey("content", "c++ -O2"));
+    EXPECT_EQ(64ul, storm::builder::jit::JitCache::getKey("content", "c++ -O3").size());
+}
+
+TEST(JitCacheTest, Dependencies) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-test-%%%%-%%%%");
+    boost::filesystem::create_directory(directory);
+    boost::filesystem::path file = directory / "header.h.gch";
+    boost::filesystem::path dependencyFile = directory / "header.h.d";
+    boost::filesystem::path dependency = directory / "dependency with space.h";
+    writeFile(file, "");
+    writeFile(dependency, "");
+
+    // No dependencies were recorded.
+    EXPECT_FALSE(storm::builder::jit::JitCache::isUpToDate(file, dependencyFile));
+
+    // The first dependency (the compiled file) no longer exists, which is ignored.
+    std::string escapedDependency = (directory / "dependency\\ with\\ space.h").string();
+    writeFile(dependencyFile, file.string() + ": " + (directory / "moved.h").string() + " \\\n " + escapedDependency + "\n");
+    std::time_t time = boost::filesystem::last_write_time(file);
+    boost::filesystem::last_write_time(dependency, time - 10);
+    EXPECT_TRUE(storm::builder::jit::JitCache::isUpToDate(file, dependencyFile));
+
+    // The dependency was changed after the file was created.
+    boost::filesystem::last_write_time(dependency, time + 10);
+    EXPECT_FALSE(storm::builder::jit::JitCache::isUpToDate(file, dependencyFile));
+
+    // The dependency was removed.
+    boost::filesystem::remove(dependency);
+    EXPECT_FALSE(storm::builder::jit::JitCache::isUpToDate(file, dependencyFile));
+
+    boost::filesystem::remove_all(directory);
+}
+
+TEST(JitCacheTest, Libraries) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-test-%%%%-%%%%");
+    storm::builder::jit::JitCache cache(directory);
+    ASSERT_TRUE(cache.prepare());
+
+    std::string source = "int main() { return 0; }\n";
+    std::string filename = "model-" + storm::builder::jit::JitCache::getKey(source, "c++") + ".so";
+    EXPECT_FALSE(static_cast<bool>(cache.findLibrary(filename, source)));
+
+    boost::filesystem::path library = directory / "library.so";
+    writeFile(library, "library");
+    boost::optional<boost::filesystem::path> cachedLibrary = cache.storeLibrary(filename, source, library);
+    ASSERT_TRUE(static_cast<bool>(cachedLibrary));
+    EXPECT_FALSE(boost::filesystem::exists(library));
+    EXPECT_TRUE(boost::filesystem::exists(cachedLibrary.get()));
+
+    // The library is only found for the source it was compiled from, even if the key is the same.
+    boost::optional<boost::filesystem::path> foundLibrary = cache.findLibrary(filename, source);
+    ASSERT_TRUE(static_cast<bool>(foundLibrary));
+    EXPECT_EQ(cachedLibrary.get(), foundLibrary.get());
+    EXPECT_FALSE(static_cast<bool>(cache.findLibrary(filename, "int main() { return 1; }\n")));
+
+    boost::filesystem::remove_all(directory);
+}
@@ -0,0 +1,51 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include <cmath>
+
+#include "storm/api/verification.h"
+#include "storm/builder/ParallelCompositionBuilder.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/parser/FormulaParser.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+    // Builds a component that fails with rate 5 and ends up in one of two (bisimilar) failed states.
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> buildComponent() {
+        storm::storage::SparseMatrixBuilder<double> builder(3, 3);
+        builder.addNextValue(0, 1, 2.0);
+        builder.addNextValue(0, 2, 3.0);
+        builder.addNextValue(1, 1, 1.0);
+        builder.addNextValue(2, 2, 1.0);
+
+        storm::models::sparse::StateLabeling labeling(3);
+        labeling.addLabel("init");
+        labeling.addLabelToState("init", 0);
+        labeling.addLabel("failed");
+        labeling.addLabelToState("failed", 1);
+        labeling.addLabelToState("failed", 2);
+
+        return std::make_shared<storm::models::sparse::Ctmc<double>>(builder.build(), labeling);
+    }
+}
+
+TEST(ParallelCompositionBuilderTest, ComposeMinimized) {
+    std::vector<std::shared_ptr<storm::models::sparse::Ctmc<double>>> components = {buildComponent(), buildComponent(), buildComponent()};
+
+    storm::parser::FormulaParser formulaParser;
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("P=? [F<=1 \"failed\"]");
+
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> product = storm::builder::ParallelCompositionBuilder<double>::compose(storm::builder::ParallelCompositionBuilder<double>::compose(components[0], components[1], true), components[2], true);
+    EXPECT_EQ(27ul, product->getNumberOfStates());
+
+    std::shared_ptr<storm::models::sparse::Ctmc<double>> minimized = storm::builder::ParallelCompositionBuilder<double>::composeMinimized(components, true, {formula});
+    // The states of the minimized composition correspond to the number of failed components.
+    EXPECT_EQ(4ul, minimized->getNumberOfStates());
+
+    double expected = std::pow(1.0 - std::exp(-5.0), 3);
+    std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(product, storm::api::createTask<double>(formula, true));
+    EXPECT_NEAR(expected, result->asExplicitQuantitativeCheckResult<double>()[*product->getInitialStates().begin()], 1e-6);
+    result = storm::api::verifyWithSparseEngine<double>(minimized, storm::api::createTask<double>(formula, true));
+    EXPECT_NEAR(expected, result->asExplicitQuantitativeCheckResult<double>()[*minimized->getInitialStates().begin()], 1e-6);
+}
@@ -0,0 +1,46 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/generator/PrismGuardIndex.h"
+#include "storm/generator/VariableInformation.h"
+#include "storm/generator/CompressedState.h"
+
+TEST(PrismGuardIndexTest, ProgramCounter) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm").substituteConstants();
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::PrismGuardIndex index(program.getModule(0), variableInformation);
+
+    ASSERT_TRUE(index.hasIndexVariable());
+    EXPECT_EQ("s", index.getIndexVariable().getName());
+
+    storm::generator::IntegerVariableInformation const& s = variableInformation.integerVariables.front().variable.getName() == "s" ? variableInformation.integerVariables.front() : variableInformation.integerVariables.back();
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    for (int_fast64_t value = 0; value <= 7; ++value) {
+        state.setFromInt(s.bitOffset, s.bitWidth, value - s.lowerBound);
+        storm::storage::BitVector const& candidates = index.getCandidateCommands(state);
+
+        // Each value of s enables exactly the command that tests for it.
+        EXPECT_EQ(1ull, candidates.getNumberOfSetBits());
+        EXPECT_TRUE(candidates.get(value));
+    }
+}
+
+TEST(PrismGuardIndexTest, NoDiscriminatingVariable) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString("dtmc\n\nmodule test\n\tx : [0..3] init 0;\n\n\t[] x+1<3 -> 1 : (x'=x+1);\n\t[] x+1>=3 -> 1 : (x'=0);\nendmodule\n", "test.pm");
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::PrismGuardIndex index(program.getModule(0), variableInformation);
+
+    EXPECT_FALSE(index.hasIndexVariable());
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    EXPECT_EQ(2ull, index.getCandidateCommands(state).getNumberOfSetBits());
+}
+
+TEST(PrismGuardIndexTest, Trivial) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm").substituteConstants();
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::PrismGuardIndex index(program.getModule(0));
+
+    EXPECT_FALSE(index.hasIndexVariable());
+    storm::generator::CompressedState state(variableInformation.getTotalBitOffset(true));
+    EXPECT_EQ(program.getModule(0).getNumberOfCommands(), index.getCandidateCommands(state).getNumberOfSetBits());
+}
@@ -0,0 +1,42 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/PrismPartialOrderReduction.h"
+
+namespace {
+    // Two independent counters of which only the first one is observed by the label.
+    std::string const independentProcesses = "mdp\n\nmodule p1\n\tx1 : [0..3] init 0;\n\n\t[] x1<3 -> 0.5 : (x1'=x1+1) + 0.5 : (x1'=min(x1+2,3));\nendmodule\n\nmodule p2\n\tx2 : [0..3] init 0;\n\n\t[] x2<3 -> 0.5 : (x2'=x2+1) + 0.5 : (x2'=min(x2+2,3));\nendmodule\n\nlabel \"goal\" = x1=3;\n";
+}
+
+TEST(PrismPartialOrderReductionTest, DetectsSafeCommands) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(independentProcesses, "independent.nm").substituteConstants();
+    storm::expressions::Variable x1 = program.getManager().getVariable("x1");
+
+    storm::generator::PrismPartialOrderReduction partialOrderReduction(program, {x1});
+    ASSERT_TRUE(partialOrderReduction.hasSafeCommands());
+    EXPECT_TRUE(partialOrderReduction.getSafeCommands(0).empty());
+    EXPECT_TRUE(partialOrderReduction.getSafeCommands(1).get(0));
+
+    // If the second process reads the variable of the first one, none of the commands is independent.
+    program = storm::parser::PrismParser::parseFromString("mdp\n\nmodule p1\n\tx1 : [0..3] init 0;\n\n\t[] x1<3 -> (x1'=x1+1);\nendmodule\n\nmodule p2\n\tx2 : [0..3] init 0;\n\n\t[] x2<x1 -> (x2'=x2+1);\nendmodule\n", "dependent.nm").substituteConstants();
+    EXPECT_FALSE(storm::generator::PrismPartialOrderReduction(program, {}).hasSafeCommands());
+}
+
+TEST(PrismPartialOrderReductionTest, BuildReducedModel) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(independentProcesses, "independent.nm");
+
+    storm::generator::NextStateGeneratorOptions options;
+    options.addLabel("goal");
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    options.setPartialOrderReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    // The second counter is run to completion before the first one moves.
+    EXPECT_EQ(16ull, model->getNumberOfStates());
+    EXPECT_EQ(7ull, reducedModel->getNumberOfStates());
+    EXPECT_EQ(1ull, reducedModel->getStates("goal").getNumberOfSetBits());
+}
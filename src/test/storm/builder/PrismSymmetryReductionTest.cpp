@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/generator/PrismSymmetryReduction.h"
+#include "storm/generator/VariableInformation.h"
+
+namespace {
+    std::string const symmetricProcesses = "mdp\n\nglobal done : bool init false;\n\nmodule p1\n\tx1 : [0..2] init 0;\n\tb1 : bool init false;\n\n\t[] x1<2 -> 0.5 : (x1'=x1+1) + 0.5 : (b1'=!b1);\n\t[] x1=2 -> (done'=true);\nendmodule\n\nmodule p2 = p1 [x1=x2, b1=b2] endmodule\nmodule p3 = p1 [x1=x3, b1=b3] endmodule\n";
+
+    // Labels that do not distinguish the processes (up to the order of the operands) and one that does.
+    std::string const labels = "\nlabel \"all\" = x1=2 & x2=2 & x3=2;\nlabel \"some\" = x3=2 | x1=2 | x2=2;\nlabel \"pair\" = (b1 & b2) | (b2 & b3) | (b1 & b3);\nlabel \"first\" = x1=2;\n";
+}
+
+TEST(PrismSymmetryReductionTest, DetectsRenamedModules) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(symmetricProcesses, "symmetric.nm").substituteConstants();
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::PrismSymmetryReduction symmetryReduction(program, variableInformation);
+
+    ASSERT_TRUE(symmetryReduction.hasSymmetries());
+    ASSERT_EQ(1ull, symmetryReduction.getNumberOfProcessGroups());
+    EXPECT_EQ(3ull, symmetryReduction.getNumberOfProcesses(0));
+}
+
+TEST(PrismSymmetryReductionTest, RejectsAsymmetricAccess) {
+    // The observer distinguishes the first process from the others.
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(symmetricProcesses + "\nmodule observer\n\tseen : bool init false;\n\n\t[] x1=2 & !seen -> (seen'=true);\nendmodule\n", "asymmetric.nm").substituteConstants();
+    storm::generator::VariableInformation variableInformation(program);
+    storm::generator::PrismSymmetryReduction symmetryReduction(program, variableInformation);
+    EXPECT_FALSE(symmetryReduction.hasSymmetries());
+
+    // The copy increments by a different amount.
+    program = storm::parser::PrismParser::parseFromString("dtmc\n\nconst int s1 = 1;\nconst int s2 = 2;\n\nmodule p1\n\tx1 : [0..4] init 0;\n\n\t[] x1<3 -> (x1'=x1+s1);\nendmodule\n\nmodule p2 = p1 [x1=x2, s1=s2] endmodule\n", "asymmetric.pm").substituteConstants();
+    variableInformation = storm::generator::VariableInformation(program);
+    EXPECT_FALSE(storm::generator::PrismSymmetryReduction(program, variableInformation).hasSymmetries());
+}
+
+TEST(PrismSymmetryReductionTest, BuildQuotient) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(symmetricProcesses, "symmetric.nm");
+
+    storm::generator::NextStateGeneratorOptions options;
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    options.setSymmetryReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    // The reduced model has one state per multiset of local states of the processes.
+    EXPECT_EQ(368ull, model->getNumberOfStates());
+    EXPECT_EQ(92ull, reducedModel->getNumberOfStates());
+    EXPECT_EQ(1ull, reducedModel->getInitialStates().getNumberOfSetBits());
+}
+
+TEST(PrismSymmetryReductionTest, PreservesProbabilities) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(symmetricProcesses + labels, "symmetric.nm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F<=8 \"all\"];Pmin=? [F<=3 \"some\"];Pmax=? [F<=4 \"pair\"];Pmin=? [F<=6 \"pair\"]", program));
+
+    storm::generator::NextStateGeneratorOptions options(formulas);
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    options.setSymmetryReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> reducedModel = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(92ull, reducedModel->getNumberOfStates());
+
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        std::unique_ptr<storm::modelchecker::CheckResult> reducedResult = storm::api::verifyWithSparseEngine<double>(reducedModel, storm::api::createTask<double>(formula, true));
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()], reducedResult->asExplicitQuantitativeCheckResult<double>()[*reducedModel->getInitialStates().begin()], 1e-6);
+    }
+}
+
+TEST(PrismSymmetryReductionTest, DisabledByAsymmetricLabel) {
+    storm::prism::Program program = storm::parser::PrismParser::parseFromString(symmetricProcesses + labels, "symmetric.nm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F<=4 \"first\"]", program));
+
+    storm::generator::NextStateGeneratorOptions options(formulas);
+    options.setSymmetryReduction();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+    EXPECT_EQ(368ull, model->getNumberOfStates());
+}
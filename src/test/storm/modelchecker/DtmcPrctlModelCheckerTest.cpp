@@ -26,6 +26,7 @@
 #include "storm/environment/solver/GmmxxSolverEnvironment.h"
 #include "storm/environment/solver/EigenSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/exceptions/InvalidEnvironmentException.h"
 
 namespace {
     
@@ -368,6 +369,23 @@ namespace {
         }
     };
 
+    class DdCuddNativeRoundedPowerEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Dd;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Dtmc<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            env.solver().native().setSymbolicRoundingGranularity(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            return env;
+        }
+    };
+
     class DdSylvanRationalSearchEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
@@ -491,6 +509,7 @@ namespace {
             HybridSylvanNativeRationalSearchEnvironment,
             DdSylvanNativePowerEnvironment,
             DdCuddNativeJacobiEnvironment,
+            DdCuddNativeRoundedPowerEnvironment,
             DdSylvanRationalSearchEnvironment
         > TestingTypes;
     
@@ -574,4 +593,29 @@ namespace {
     }
 
 
+
+    TEST(DtmcPrctlModelCheckerTest, RoundedPowerIterationCoarseGranularity) {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F \"one\"]; R=? [F \"done\"]", program));
+        auto model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, formulas)->template as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>();
+        storm::modelchecker::SymbolicDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>> checker(*model);
+        storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> initialStates(model->getReachableStates(), model->getInitialStates());
+        
+        // The granularity is only one order of magnitude below the precision.
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Power);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        env.solver().native().setSymbolicRoundingGranularity(storm::utility::convertNumber<storm::RationalNumber>(1e-7));
+        
+        // Probabilities are bounded from above, so the iteration only stops once lower and upper values are close.
+        std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+        result->filter(initialStates);
+        EXPECT_NEAR(1.0 / 6.0, result->asQuantitativeCheckResult<double>().getMin(), 1e-6);
+        
+        // Without upper bounds, the rounded values could get stuck far from the solution.
+        EXPECT_THROW(checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[1])), storm::exceptions::InvalidEnvironmentException);
+    }
+
 }
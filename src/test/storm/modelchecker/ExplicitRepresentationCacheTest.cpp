@@ -0,0 +1,47 @@
+#include "gtest/gtest.h"
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/symbolic/Dtmc.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
+#include "storm/modelchecker/results/HybridQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/storage/dd/ExplicitRepresentationCache.h"
+
+TEST(ExplicitRepresentationCacheTest, HybridDie) {
+    std::string formulasString = "P=? [F \"two\"]";
+    formulasString += "; P=? [F \"three\"]";
+
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    std::shared_ptr<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>> model = storm::api::buildSymbolicModel<storm::dd::DdType::CUDD, double>(program, formulas)->template as<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>>();
+
+    // Use a fixed budget, so the test does not depend on the settings.
+    model->getExplicitRepresentationCache().setBudget(16 * 1024 * 1024);
+
+    storm::Environment env;
+    storm::modelchecker::HybridDtmcPrctlModelChecker<storm::models::symbolic::Dtmc<storm::dd::DdType::CUDD, double>> checker(*model);
+    storm::modelchecker::SymbolicQualitativeCheckResult<storm::dd::DdType::CUDD> initialStates(model->getReachableStates(), model->getInitialStates());
+
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[0]));
+    result->filter(initialStates);
+    EXPECT_NEAR(1.0 / 6.0, result->asHybridQuantitativeCheckResult<storm::dd::DdType::CUDD, double>().getMin(), 1e-6);
+    EXPECT_EQ(0ull, model->getExplicitRepresentationCache().getNumberOfHits());
+    EXPECT_EQ(2ull, model->getExplicitRepresentationCache().getNumberOfMisses());
+
+    // Both properties lead to the same maybe states and the same (explicit) equation system.
+    result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[1]));
+    result->filter(initialStates);
+    EXPECT_NEAR(1.0 / 6.0, result->asHybridQuantitativeCheckResult<storm::dd::DdType::CUDD, double>().getMin(), 1e-6);
+    EXPECT_EQ(2ull, model->getExplicitRepresentationCache().getNumberOfHits());
+    EXPECT_EQ(2ull, model->getExplicitRepresentationCache().getNumberOfMisses());
+
+    model->getExplicitRepresentationCache().clear();
+    EXPECT_EQ(0ull, model->getExplicitRepresentationCache().getSizeInMemory());
+}
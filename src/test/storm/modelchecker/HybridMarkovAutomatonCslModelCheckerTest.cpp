@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/symbolic/MarkovAutomaton.h"
+#include "storm/models/symbolic/Mdp.h"
+#include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/csl/HybridMarkovAutomatonCslModelChecker.h"
+#include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
+#include "storm/storage/jani/Model.h"
+#include "storm/environment/Environment.h"
+
+namespace {
+
+    template<storm::dd::DdType DdType>
+    void checkHybridAgainstSparse(std::string const& programFile, std::string const& formulasAsString) {
+        storm::Environment env;
+        storm::prism::Program program = storm::api::parseProgram(programFile);
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+
+        std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> sparseModel = storm::api::buildSparseModel<double>(program, formulas)->template as<storm::models::sparse::MarkovAutomaton<double>>();
+        ASSERT_TRUE(sparseModel->isClosed());
+        ASSERT_EQ(1ull, sparseModel->getInitialStates().getNumberOfSetBits());
+        uint64_t initialState = *sparseModel->getInitialStates().begin();
+
+        // The symbolic Markov automaton is built from the JANI representation of the program.
+        std::shared_ptr<storm::models::symbolic::MarkovAutomaton<DdType, double>> symbolicModel = storm::api::buildSymbolicModel<DdType, double>(program.toJani(), formulas)->template as<storm::models::symbolic::MarkovAutomaton<DdType, double>>();
+        EXPECT_EQ(sparseModel->getNumberOfStates(), symbolicModel->getNumberOfStates());
+        EXPECT_FALSE(symbolicModel->hasHybridStates());
+
+        storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<double>> sparseChecker(*sparseModel);
+        storm::modelchecker::HybridMarkovAutomatonCslModelChecker<storm::models::symbolic::MarkovAutomaton<DdType, double>> hybridChecker(*symbolicModel);
+        storm::modelchecker::SymbolicQualitativeCheckResult<DdType> initialStatesFilter(symbolicModel->getReachableStates(), symbolicModel->getInitialStates());
+
+        for (auto const& formula : formulas) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formula);
+            ASSERT_TRUE(hybridChecker.canHandle(task)) << *formula;
+
+            std::unique_ptr<storm::modelchecker::CheckResult> sparseResult = sparseChecker.check(env, task);
+            std::unique_ptr<storm::modelchecker::CheckResult> hybridResult = hybridChecker.check(env, task);
+            hybridResult->filter(initialStatesFilter);
+
+            double expected = sparseResult->asExplicitQuantitativeCheckResult<double>()[initialState];
+            EXPECT_NEAR(expected, hybridResult->asQuantitativeCheckResult<double>().getMin(), 1e-6) << *formula;
+        }
+    }
+
+    template<storm::dd::DdType DdType>
+    void checkHybridMdpLongRunAverage() {
+        storm::Environment env;
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("LRAmax=? [\"two\"];LRAmin=? [\"seven\"];LRAmin=? [\"done\"];R{\"coinflips\"}max=? [LRA]", program));
+        std::shared_ptr<storm::models::symbolic::Mdp<DdType, double>> mdp = storm::api::buildSymbolicModel<DdType, double>(program, formulas)->template as<storm::models::symbolic::Mdp<DdType, double>>();
+
+        storm::modelchecker::HybridMdpPrctlModelChecker<storm::models::symbolic::Mdp<DdType, double>> checker(*mdp);
+        storm::modelchecker::SymbolicQualitativeCheckResult<DdType> initialStatesFilter(mdp->getReachableStates(), mdp->getInitialStates());
+        std::vector<double> expectedValues = {1.0 / 36.0, 1.0 / 6.0, 1.0, 0.0};
+
+        for (uint64_t index = 0; index < formulas.size(); ++index) {
+            storm::modelchecker::CheckTask<storm::logic::Formula, double> task(*formulas[index]);
+            ASSERT_TRUE(checker.canHandle(task)) << *formulas[index];
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, task);
+            result->filter(initialStatesFilter);
+            EXPECT_NEAR(expectedValues[index], result->asQuantitativeCheckResult<double>().getMin(), 1e-6) << *formulas[index];
+        }
+    }
+
+    std::string const simpleFormulas = "Pmax=? [F s=4];Pmin=? [F s=4];Tmax=? [F s>2];Tmin=? [F s>2];LRAmax=? [s=4];LRAmin=? [s=3];Pmax=? [F<=1 s=4];Pmin=? [F[0.5,2] s>2]";
+    std::string const serverFormulas = "Pmax=? [F s=3];Tmin=? [F s=5];Tmax=? [F s=5];LRAmax=? [s=4];LRAmin=? [s=0]";
+
+}
+
+TEST(HybridMarkovAutomatonCslModelCheckerTest, Simple_Cudd) {
+    checkHybridAgainstSparse<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/ma/simple.ma", simpleFormulas);
+}
+
+TEST(HybridMarkovAutomatonCslModelCheckerTest, Simple_Sylvan) {
+    checkHybridAgainstSparse<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/ma/simple.ma", simpleFormulas);
+}
+
+TEST(HybridMarkovAutomatonCslModelCheckerTest, Server_Cudd) {
+    checkHybridAgainstSparse<storm::dd::DdType::CUDD>(STORM_TEST_RESOURCES_DIR "/ma/server.ma", serverFormulas);
+}
+
+TEST(HybridMarkovAutomatonCslModelCheckerTest, Server_Sylvan) {
+    checkHybridAgainstSparse<storm::dd::DdType::Sylvan>(STORM_TEST_RESOURCES_DIR "/ma/server.ma", serverFormulas);
+}
+
+TEST(HybridMarkovAutomatonCslModelCheckerTest, MdpLongRunAverage_Cudd) {
+    checkHybridMdpLongRunAverage<storm::dd::DdType::CUDD>();
+}
+
+TEST(HybridMarkovAutomatonCslModelCheckerTest, MdpLongRunAverage_Sylvan) {
+    checkHybridMdpLongRunAverage<storm::dd::DdType::Sylvan>();
+}
@@ -219,6 +219,21 @@ namespace {
             return env;
         }
     };
+    class DdSylvanDoubleRoundedValueIterationEnvironment {
+    public:
+        static const storm::dd::DdType ddType = storm::dd::DdType::Sylvan;
+        static const storm::settings::modules::CoreSettings::Engine engine = storm::settings::modules::CoreSettings::Engine::Dd;
+        static const bool isExact = false;
+        typedef double ValueType;
+        typedef storm::models::symbolic::Mdp<ddType, ValueType> ModelType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration);
+            env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+            env.solver().minMax().setSymbolicRoundingGranularity(storm::utility::convertNumber<storm::RationalNumber>(1e-12));
+            return env;
+        }
+    };
     class DdCuddDoublePolicyIterationEnvironment {
     public:
         static const storm::dd::DdType ddType = storm::dd::DdType::CUDD;
@@ -347,6 +362,7 @@ namespace {
             HybridSylvanRationalPolicyIterationEnvironment,
             DdCuddDoubleValueIterationEnvironment,
             DdSylvanDoubleValueIterationEnvironment,
+            DdSylvanDoubleRoundedValueIterationEnvironment,
             DdCuddDoublePolicyIterationEnvironment,
             DdSylvanRationalRationalSearchEnvironment
         > TestingTypes;
@@ -0,0 +1,94 @@
+#include "gtest/gtest.h"
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm/logic/Formulas.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/incremental/SparseVerificationSession.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/utility/prism.h"
+
+namespace {
+    template<typename ModelType>
+    std::pair<std::shared_ptr<ModelType>, std::vector<std::shared_ptr<storm::logic::Formula const>>> buildModelFormulas(std::string const& pathToPrismFile, std::string const& formulasAsString) {
+        std::pair<std::shared_ptr<ModelType>, std::vector<std::shared_ptr<storm::logic::Formula const>>> result;
+        storm::prism::Program program = storm::api::parseProgram(pathToPrismFile);
+        program = storm::utility::prism::preprocess(program, "");
+        result.second = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+        result.first = storm::api::buildSparseModel<double>(program, result.second)->template as<ModelType>();
+        return result;
+    }
+}
+
+TEST(SparseVerificationSessionTest, Die) {
+    std::string formulasString = "P=? [F \"one\"]";
+    formulasString += "; P>0.2 [F \"one\"]";
+    formulasString += "; R=? [F \"done\"]";
+    auto modelFormulas = buildModelFormulas<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", formulasString);
+    auto model = modelFormulas.first;
+    uint_fast64_t initialState = *model->getInitialStates().begin();
+
+    auto session = storm::api::createVerificationSession(model);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[0]));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(0ull, session->getNumberOfCacheHits());
+
+    // Only the threshold changed, so the previous solution can be reused.
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[1]));
+    EXPECT_FALSE(result->asExplicitQualitativeCheckResult()[initialState]);
+    EXPECT_EQ(1ull, session->getNumberOfCacheHits());
+
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[2]));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[2]));
+    EXPECT_NEAR(11.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(2ull, session->getNumberOfCacheHits());
+
+    // A model with the same structure keeps the cached information.
+    auto rebuiltModel = buildModelFormulas<storm::models::sparse::Dtmc<double>>(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", formulasString).first;
+    EXPECT_TRUE(session->updateModel(rebuiltModel));
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[0]));
+    EXPECT_NEAR(1.0 / 6.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(3ull, session->getNumberOfCacheHits());
+}
+
+TEST(SparseVerificationSessionTest, Dice) {
+    std::string formulasString = "Pmin=? [F \"two\"]";
+    formulasString += "; Pmax=? [F \"three\"]";
+    formulasString += "; Pmax>0.05 [F \"three\"]";
+    formulasString += "; Rmin=? [F \"done\"]";
+    auto modelFormulas = buildModelFormulas<storm::models::sparse::Mdp<double>>(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm", formulasString);
+    auto model = modelFormulas.first;
+    uint_fast64_t initialState = *model->getInitialStates().begin();
+
+    auto session = storm::api::createVerificationSession(model);
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[0]));
+    EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[1]));
+    EXPECT_NEAR(2.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(0ull, session->getNumberOfCacheHits());
+
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[2]));
+    EXPECT_TRUE(result->asExplicitQualitativeCheckResult()[initialState]);
+    EXPECT_EQ(1ull, session->getNumberOfCacheHits());
+
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[3]));
+    EXPECT_NEAR(22.0 / 3.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+
+    session->clearCache();
+    result = storm::api::verifyWithSparseEngine(*session, storm::api::createTask<double>(modelFormulas.second[1]));
+    EXPECT_NEAR(2.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    EXPECT_EQ(1ull, session->getNumberOfCacheHits());
+}
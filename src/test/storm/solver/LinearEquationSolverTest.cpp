@@ -80,6 +80,34 @@ namespace {
         }
     };
     
+    class NativeDoubleGaussSeidelRcmEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+            env.solver().native().setStateOrdering(storm::utility::permutation::OrderKind::ReverseCuthillMcKee);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
+    class NativeDoubleJacobiBackwardBfsEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+            env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Jacobi);
+            env.solver().native().setStateOrdering(storm::utility::permutation::OrderKind::BackwardBfs);
+            env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+            return env;
+        }
+    };
+    
     class NativeDoubleSorEnvironment {
     public:
         typedef double ValueType;
@@ -297,6 +325,8 @@ namespace {
             NativeDoubleIntervalIterationEnvironment,
             NativeDoubleJacobiEnvironment,
             NativeDoubleGaussSeidelEnvironment,
+            NativeDoubleGaussSeidelRcmEnvironment,
+            NativeDoubleJacobiBackwardBfsEnvironment,
             NativeDoubleSorEnvironment,
             NativeDoubleWalkerChaeEnvironment,
             NativeRationalRationalSearchEnvironment,
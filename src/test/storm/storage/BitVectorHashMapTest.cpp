@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include <boost/filesystem.hpp>
+
 #include "storm/storage/BitVector.h"
 #include "storm/storage/BitVectorHashMap.h"
 
@@ -67,3 +69,43 @@ TEST(BitVectorHashMapTest, FindOrAdd) {
     EXPECT_EQ(5ul, map.findOrAdd(fifth, 0));
     EXPECT_EQ(6ul, map.findOrAdd(sixth, 0));
 }
+
+TEST(BitVectorHashMapTest, FileBacked) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-test-%%%%-%%%%");
+    boost::filesystem::create_directory(directory);
+
+    {
+        // The map starts small, so the keys are moved to new files when it grows.
+        storm::storage::BitVectorHashMap<uint32_t> map(128, 3, 0.75, directory.string());
+        for (uint32_t i = 0; i < 1000; ++i) {
+            storm::storage::BitVector key(128);
+            key.setFromInt(0, 32, i);
+            key.set(127, i % 3 == 0);
+            EXPECT_EQ(i, map.findOrAdd(key, i));
+        }
+        EXPECT_EQ(1000ul, map.size());
+
+        // The files are deleted right away.
+        EXPECT_TRUE(boost::filesystem::is_empty(directory));
+
+        for (uint32_t i = 0; i < 1000; ++i) {
+            storm::storage::BitVector key(128);
+            key.setFromInt(0, 32, i);
+            key.set(127, i % 3 == 0);
+            EXPECT_EQ(i, map.getValue(key));
+            key.set(126);
+            EXPECT_FALSE(map.contains(key));
+        }
+
+        storm::storage::BitVectorHashMap<uint32_t> copy(map);
+        uint64_t numberOfElements = 0;
+        for (auto const& keyValuePair : copy) {
+            EXPECT_EQ(keyValuePair.second, keyValuePair.first.getAsInt(0, 32));
+            EXPECT_EQ(keyValuePair.second % 3 == 0, keyValuePair.first.get(127));
+            ++numberOfElements;
+        }
+        EXPECT_EQ(1000ul, numberOfElements);
+    }
+
+    boost::filesystem::remove_all(directory);
+}
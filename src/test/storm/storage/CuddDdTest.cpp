@@ -716,6 +716,34 @@ TEST(CuddDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(CuddDd, AddToLargeMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 299);
+    
+    // A dense matrix with 90000 entries, which is large enough for the translation to be parallelized.
+    storm::dd::Add<storm::dd::DdType::CUDD, double> dd = manager->template getIdentity<double>(x.first) * manager->template getConstant<double>(1000) + manager->template getIdentity<double>(x.second) + manager->template getConstant<double>(1);
+    dd *= manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>();
+    
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+    
+    ASSERT_EQ(300ul, matrix.getRowCount());
+    EXPECT_EQ(300ul, matrix.getColumnCount());
+    ASSERT_EQ(90000ul, matrix.getNonzeroEntryCount());
+    bool entriesCorrect = true;
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        uint_fast64_t column = 0;
+        for (auto const& entry : matrix.getRow(row)) {
+            entriesCorrect &= entry.getColumn() == column && entry.getValue() == static_cast<double>(row * 1000 + column + 1);
+            ++column;
+        }
+        entriesCorrect &= column == 300;
+    }
+    EXPECT_TRUE(entriesCorrect);
+}
+
 TEST(CuddDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::CUDD>> manager(new storm::dd::DdManager<storm::dd::DdType::CUDD>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
@@ -56,3 +56,76 @@ TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     EXPECT_EQ(26ul, result->getNumberOfTransitions());
     EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
 }
+
+TEST(NondeterministicModelBisimulationDecomposition, TwoDiceSignature) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+
+    // Build the die model without its reward model.
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, storm::generator::NextStateGeneratorOptions(false, true)).build();
+
+    ASSERT_EQ(model->getType(), storm::models::ModelType::Mdp);
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = model->as<storm::models::sparse::Mdp<double>>();
+    
+    typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>::Options options;
+    options.setRefinementMethod(storm::storage::SparseRefinementMethod::Signature);
+    
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> bisim(*mdp, options);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(result = bisim.getQuotient());
+    
+    EXPECT_EQ(storm::models::ModelType::Mdp, result->getType());
+    EXPECT_EQ(77ul, result->getNumberOfStates());
+    EXPECT_EQ(183ul, result->getNumberOfTransitions());
+    EXPECT_EQ(97ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+
+    options.respectedAtomicPropositions = std::set<std::string>({"two"});
+    
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> bisim2(*mdp, options);
+    ASSERT_NO_THROW(bisim2.computeBisimulationDecomposition());
+    ASSERT_NO_THROW(result = bisim2.getQuotient());
+    
+    EXPECT_EQ(storm::models::ModelType::Mdp, result->getType());
+    EXPECT_EQ(11ul, result->getNumberOfStates());
+    EXPECT_EQ(26ul, result->getNumberOfTransitions());
+    EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+}
+
+TEST(NondeterministicModelBisimulationDecomposition, Weak) {
+    // State 0 moves to state 1 with probability one, which then reaches the goal state 2 or the sink 3.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true, 0);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, 1.0);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 2, 0.5);
+    builder.addNextValue(1, 3, 0.5);
+    builder.newRowGroup(2);
+    builder.addNextValue(2, 2, 1.0);
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 3, 1.0);
+    
+    storm::models::sparse::StateLabeling labeling(4);
+    labeling.addLabel("init");
+    labeling.addLabelToState("init", 0);
+    labeling.addLabel("goal");
+    labeling.addLabelToState("goal", 2);
+    storm::models::sparse::Mdp<double> mdp(builder.build(), labeling);
+    
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> strongBisim(mdp);
+    ASSERT_NO_THROW(strongBisim.computeBisimulationDecomposition());
+    EXPECT_EQ(4ul, strongBisim.getQuotient()->getNumberOfStates());
+    
+    typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>::Options options;
+    options.setType(storm::storage::BisimulationType::Weak);
+    
+    // States 0 and 1 are merged, because the only step of state 0 is inert.
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>> weakBisim(mdp, options);
+    ASSERT_NO_THROW(weakBisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Model<double>> result;
+    ASSERT_NO_THROW(result = weakBisim.getQuotient());
+    
+    EXPECT_EQ(storm::models::ModelType::Mdp, result->getType());
+    EXPECT_EQ(3ul, result->getNumberOfStates());
+    EXPECT_EQ(4ul, result->getNumberOfTransitions());
+    EXPECT_EQ(3ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
+}
@@ -694,3 +694,39 @@ TEST(SparseMatrix, IsSubmatrix) {
     ASSERT_FALSE(matrix3.isSubmatrixOf(matrix));
     ASSERT_FALSE(matrix3.isSubmatrixOf(matrix2));
 }
+
+TEST(SparseMatrix, PermuteRowGroupsAndColumns) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 6, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(2, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 0, 0.3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 1, 0.7));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+    
+    // New state 0 is old state 2, new state 1 is old state 0 and new state 2 is old state 1.
+    std::vector<uint_fast64_t> rowGroupPermutation = {2, 0, 1};
+    std::vector<uint_fast64_t> columnPermutation = {1, 2, 0};
+    storm::storage::SparseMatrix<double> permutedMatrix;
+    ASSERT_NO_THROW(permutedMatrix = matrix.permuteRowGroupsAndColumns(rowGroupPermutation, columnPermutation));
+    
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder2(4, 3, 6, true, true, 3);
+    ASSERT_NO_THROW(matrixBuilder2.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder2.addNextValue(0, 1, 0.3));
+    ASSERT_NO_THROW(matrixBuilder2.addNextValue(0, 2, 0.7));
+    ASSERT_NO_THROW(matrixBuilder2.newRowGroup(1));
+    ASSERT_NO_THROW(matrixBuilder2.addNextValue(1, 2, 1.0));
+    ASSERT_NO_THROW(matrixBuilder2.addNextValue(2, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder2.addNextValue(2, 1, 0.5));
+    ASSERT_NO_THROW(matrixBuilder2.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder2.addNextValue(3, 0, 1.0));
+    storm::storage::SparseMatrix<double> expectedMatrix;
+    ASSERT_NO_THROW(expectedMatrix = matrixBuilder2.build());
+    
+    ASSERT_TRUE(permutedMatrix == expectedMatrix);
+}
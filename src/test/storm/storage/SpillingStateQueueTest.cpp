@@ -0,0 +1,83 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/storage/sparse/SpillingStateQueue.h"
+
+#include <iterator>
+
+#include <boost/filesystem.hpp>
+
+TEST(SpillingStateQueueTest, FirstInFirstOut) {
+    storm::storage::sparse::SpillingStateQueue<uint32_t> queue(4, boost::filesystem::temp_directory_path().string());
+    EXPECT_TRUE(queue.empty());
+
+    // States of 70 bits span two words, the second of which is only partially used.
+    uint32_t nextToPush = 0;
+    uint32_t nextToPop = 0;
+    for (uint32_t round = 0; round < 10; ++round) {
+        for (uint32_t i = 0; i < 7; ++i, ++nextToPush) {
+            storm::storage::BitVector state(70);
+            state.setFromInt(0, 32, nextToPush);
+            state.set(69, nextToPush % 2 == 0);
+            queue.push(state, nextToPush);
+        }
+        for (uint32_t i = 0; i < 4; ++i, ++nextToPop) {
+            std::pair<storm::storage::BitVector, uint32_t> stateIndexPair = queue.pop();
+            ASSERT_EQ(nextToPop, stateIndexPair.second);
+            ASSERT_EQ(70ull, stateIndexPair.first.size());
+            EXPECT_EQ(nextToPop, stateIndexPair.first.getAsInt(0, 32));
+            EXPECT_EQ(nextToPop % 2 == 0, stateIndexPair.first.get(69));
+        }
+    }
+    EXPECT_EQ(30ull, queue.size());
+    EXPECT_LT(0ull, queue.getMaximalNumberOfSpilledStates());
+
+    while (!queue.empty()) {
+        ASSERT_EQ(nextToPop, queue.pop().second);
+        ++nextToPop;
+    }
+    EXPECT_EQ(nextToPush, nextToPop);
+}
+
+TEST(SpillingStateQueueTest, ReclaimsReadStates) {
+    boost::filesystem::path directory = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("storm-test-%%%%-%%%%");
+    boost::filesystem::create_directory(directory);
+
+    uint32_t nextToPush = 0;
+    uint32_t nextToPop = 0;
+    {
+        storm::storage::sparse::SpillingStateQueue<uint32_t> queue(4, directory.string());
+        auto pushState = [&] () {
+            storm::storage::BitVector state(70);
+            state.setFromInt(0, 32, nextToPush);
+            queue.push(state, nextToPush);
+            ++nextToPush;
+        };
+        for (uint32_t i = 0; i < 20; ++i) {
+            pushState();
+        }
+
+        // The queue is never drained, but the file must not hold more than twice the states in the queue.
+        ASSERT_EQ(1, std::distance(boost::filesystem::directory_iterator(directory), boost::filesystem::directory_iterator()));
+        boost::filesystem::path filename = boost::filesystem::directory_iterator(directory)->path();
+        uint64_t recordSize = 2 * sizeof(uint64_t) + sizeof(uint32_t);
+        for (uint32_t round = 0; round < 200; ++round) {
+            pushState();
+            pushState();
+            for (uint32_t i = 0; i < 2; ++i, ++nextToPop) {
+                std::pair<storm::storage::BitVector, uint32_t> stateIndexPair = queue.pop();
+                ASSERT_EQ(nextToPop, stateIndexPair.second);
+                EXPECT_EQ(nextToPop, stateIndexPair.first.getAsInt(0, 32));
+            }
+            ASSERT_LE(boost::filesystem::file_size(filename), 2 * queue.size() * recordSize);
+        }
+        EXPECT_EQ(20ull, queue.size());
+
+        while (!queue.empty()) {
+            ASSERT_EQ(nextToPop, queue.pop().second);
+            ++nextToPop;
+        }
+    }
+    EXPECT_EQ(nextToPush, nextToPop);
+    EXPECT_TRUE(boost::filesystem::is_empty(directory));
+    boost::filesystem::remove_all(directory);
+}
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/parser/PrismParser.h"
+#include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+TEST(StateValuationsTest, Die) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    storm::generator::NextStateGeneratorOptions options;
+    options.setBuildStateValuations();
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program, options).build();
+
+    ASSERT_TRUE(model->hasStateValuations());
+    storm::storage::sparse::StateValuations const& valuations = model->getStateValuations();
+    ASSERT_EQ(13ull, valuations.getNumberOfStates());
+
+    storm::expressions::Variable s = program.getManager().getVariable("s");
+    storm::expressions::Variable d = program.getManager().getVariable("d");
+    std::set<std::pair<int_fast64_t, int_fast64_t>> seenValues;
+    for (uint_fast64_t state = 0; state < valuations.getNumberOfStates(); ++state) {
+        storm::expressions::SimpleValuation valuation = valuations.getStateValuation(state);
+        EXPECT_EQ(valuation.getIntegerValue(s), valuations.getIntegerValue(state, s));
+        EXPECT_EQ(valuation.getIntegerValue(d), valuations.getIntegerValue(state, d));
+        EXPECT_EQ("[s=" + std::to_string(valuation.getIntegerValue(s)) + "]", valuations.getStateInfo(state, {s}));
+        seenValues.emplace(valuation.getIntegerValue(s), valuation.getIntegerValue(d));
+    }
+    // All states have distinct valuations.
+    EXPECT_EQ(13ull, seenValues.size());
+    EXPECT_THROW(valuations.getBooleanValue(0, s), storm::exceptions::InvalidArgumentException);
+
+    storm::storage::BitVector selectedStates(valuations.getNumberOfStates());
+    selectedStates.set(3);
+    selectedStates.set(7);
+    storm::storage::sparse::StateValuations selectedValuations = valuations.selectStates(selectedStates);
+    ASSERT_EQ(2ull, selectedValuations.getNumberOfStates());
+    EXPECT_EQ(valuations.getStateInfo(3), selectedValuations.getStateInfo(0));
+    EXPECT_EQ(valuations.getStateInfo(7), selectedValuations.getStateInfo(1));
+
+    storm::storage::sparse::StateValuations permutedValuations = valuations.selectStates(std::vector<storm::storage::sparse::state_type>({7, 100, 3}));
+    ASSERT_EQ(3ull, permutedValuations.getNumberOfStates());
+    EXPECT_EQ(valuations.getStateInfo(7), permutedValuations.getStateInfo(0));
+    EXPECT_EQ("[]", permutedValuations.getStateInfo(1));
+    EXPECT_EQ(valuations.getStateInfo(3), permutedValuations.getStateInfo(2));
+}
@@ -3,6 +3,7 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Odd.h"
@@ -717,6 +718,52 @@ TEST(SylvanDd, SwapTest) {
     EXPECT_TRUE(dd1 == manager->template getIdentity<double>(x.second));
 }
 
+TEST(SylvanDd, ReorderingTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    
+    // The order in which the variables are created is bad for the identities below.
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x1 = manager->addMetaVariable("x1", 0, 7);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x2 = manager->addMetaVariable("x2", 0, 7);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y1 = manager->addMetaVariable("y1", 0, 7);
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> y2 = manager->addMetaVariable("y2", 0, 7);
+    
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> bdd = manager->getIdentity(x1.first, y1.first) && manager->getIdentity(x2.first, y2.first);
+    storm::dd::Bdd<storm::dd::DdType::Sylvan> relation = manager->getIdentity(x1.first, x1.second) && manager->getIdentity(x2.first, x2.second) && manager->getIdentity(y1.first, y1.second) && manager->getIdentity(y2.first, y2.second);
+    uint64_t nodeCount = bdd.getNodeCount();
+    uint64_t numberOfReorderings = manager->getNumberOfReorderings();
+    
+    ASSERT_NO_THROW(manager->triggerReordering());
+    EXPECT_EQ(numberOfReorderings + 1, manager->getNumberOfReorderings());
+    EXPECT_LT(bdd.getNodeCount(), nodeCount);
+    
+    // The DDs (as well as the meta variables) still represent the same functions.
+    EXPECT_EQ(64ul, bdd.getNonZeroCount());
+    EXPECT_TRUE(bdd == (manager->getIdentity(x1.first, y1.first) && manager->getIdentity(x2.first, y2.first)));
+    EXPECT_TRUE((bdd && manager->getEncoding(x1.first, 3) && manager->getEncoding(x2.first, 5)) == (manager->getEncoding(x1.first, 3) && manager->getEncoding(y1.first, 3) && manager->getEncoding(x2.first, 5) && manager->getEncoding(y2.first, 5)));
+    EXPECT_TRUE(bdd.relationalProduct(relation, {x1.first, x2.first, y1.first, y2.first}, {x1.second, x2.second, y1.second, y2.second}) == bdd);
+    
+    storm::dd::Odd odd = bdd.createOdd();
+    EXPECT_EQ(64ul, odd.getTotalOffset());
+}
+
+TEST(SylvanDd, ReorderingWithSeveralManagersTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 7);
+    
+    // As the managers share Sylvan's node table, reordering is refused as long as there is another one.
+    {
+        std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> otherManager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+        std::pair<storm::expressions::Variable, storm::expressions::Variable> y = otherManager->addMetaVariable("y", 0, 7);
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> otherBdd = otherManager->getIdentity(y.first, y.second);
+        EXPECT_THROW(manager->triggerReordering(), storm::exceptions::NotSupportedException);
+        EXPECT_TRUE(otherBdd == otherManager->getIdentity(y.first, y.second));
+    }
+    
+    uint64_t numberOfReorderings = manager->getNumberOfReorderings();
+    ASSERT_NO_THROW(manager->triggerReordering());
+    EXPECT_EQ(numberOfReorderings + 1, manager->getNumberOfReorderings());
+}
+
 TEST(SylvanDd, MultiplyMatrixTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -835,6 +882,34 @@ TEST(SylvanDd, AddOddTest) {
     EXPECT_EQ(106ul, matrix.getNonzeroEntryCount());
 }
 
+TEST(SylvanDd, AddToLargeMatrixTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 299);
+    
+    // A dense matrix with 90000 entries, which is large enough for the translation to be parallelized.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd = manager->template getIdentity<double>(x.first) * manager->template getConstant<double>(1000) + manager->template getIdentity<double>(x.second) + manager->template getConstant<double>(1);
+    dd *= manager->getRange(x.first).template toAdd<double>() * manager->getRange(x.second).template toAdd<double>();
+    
+    storm::dd::Odd rowOdd = manager->getRange(x.first).template toAdd<double>().createOdd();
+    storm::dd::Odd columnOdd = manager->getRange(x.second).template toAdd<double>().createOdd();
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+    
+    ASSERT_EQ(300ul, matrix.getRowCount());
+    EXPECT_EQ(300ul, matrix.getColumnCount());
+    ASSERT_EQ(90000ul, matrix.getNonzeroEntryCount());
+    bool entriesCorrect = true;
+    for (uint_fast64_t row = 0; row < matrix.getRowCount(); ++row) {
+        uint_fast64_t column = 0;
+        for (auto const& entry : matrix.getRow(row)) {
+            entriesCorrect &= entry.getColumn() == column && entry.getValue() == static_cast<double>(row * 1000 + column + 1);
+            ++column;
+        }
+        entriesCorrect &= column == 300;
+    }
+    EXPECT_TRUE(entriesCorrect);
+}
+
 TEST(SylvanDd, AddSharpenTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 1, 9);
@@ -954,3 +1029,29 @@ TEST(SylvanDd, BddToExpressionTest) {
     
     auto result = bdd.toExpression(*manager);
 }
+
+TEST(SylvanDd, ExecuteConcurrentlyTest) {
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 99);
+    
+    // Every function creates the set of values that are multiples of its index.
+    std::vector<storm::dd::Bdd<storm::dd::DdType::Sylvan>> results(16);
+    std::vector<std::function<void()>> functions;
+    for (uint64_t index = 0; index < results.size(); ++index) {
+        functions.emplace_back([&manager, &x, &results, index] () {
+            results[index] = manager->getBddZero();
+            for (uint64_t value = 0; value < 100; value += index + 1) {
+                results[index] |= manager->getEncoding(x.first, value);
+            }
+        });
+    }
+    ASSERT_NO_THROW(manager->executeConcurrently(functions));
+    
+    for (uint64_t index = 0; index < results.size(); ++index) {
+        EXPECT_EQ((99 / (index + 1)) + 1, results[index].getNonZeroCount());
+    }
+    
+    // Exceptions are passed on to the caller.
+    functions.back() = [] () { throw storm::exceptions::InvalidArgumentException() << "Test."; };
+    EXPECT_THROW(manager->executeConcurrently(functions), storm::exceptions::InvalidArgumentException);
+}
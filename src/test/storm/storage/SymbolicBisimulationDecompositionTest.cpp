@@ -7,6 +7,10 @@
 #include "storm/builder/DdPrismModelBuilder.h"
 
 #include "storm/storage/dd/BisimulationDecomposition.h"
+#include "storm/storage/dd/bisimulation/Partition.h"
+#include "storm/storage/dd/bisimulation/PartitionRefiner.h"
+#include "storm/storage/dd/bisimulation/NondeterministicModelPartitionRefiner.h"
+#include "storm/storage/dd/bisimulation/QuotientExtractor.h"
 #include "storm/storage/SymbolicModelDescription.h"
 
 #include "storm/modelchecker/prctl/SymbolicDtmcPrctlModelChecker.h"
@@ -21,6 +25,7 @@
 #include "storm/logic/Formulas.h"
 #include "storm/parser/FormulaParser.h"
 
+#include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -467,3 +472,98 @@ TEST(SymbolicModelBisimulationDecomposition, AsynchronousLeader_Sylvan) {
     EXPECT_TRUE(quotient->isSymbolicModel());
     EXPECT_EQ(2152ul, (quotient->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan, double>>()->getNumberOfChoices()));
 }
+
+TEST(SymbolicModelBisimulationDecomposition, BlockGroups_Cudd) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    smd = smd.preprocess();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(smd.asPrismProgram());
+    
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::CUDD, double> preservationInformation(*model);
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::CUDD, double> refiner(*model, storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double>::create(*model, storm::storage::BisimulationType::Strong, preservationInformation));
+    refiner.setNumberOfBlockGroups(4);
+    refiner.setCollectStatistics(true);
+    uint64_t refinements = 0;
+    while (refiner.refine()) {
+        ++refinements;
+    }
+    
+    EXPECT_EQ(2007ul, refiner.getStatePartition().getNumberOfBlocks());
+    ASSERT_EQ(refinements + 1, refiner.getRefinementStatistics().size());
+    EXPECT_EQ(2007ul, refiner.getRefinementStatistics().back().numberOfBlocksAfter);
+    EXPECT_EQ(refiner.getRefinementStatistics().back().numberOfBlocksBefore, refiner.getRefinementStatistics().back().numberOfBlocksAfter);
+    for (auto const& statistics : refiner.getRefinementStatistics()) {
+        EXPECT_LE(1ul, statistics.numberOfSignatures);
+        EXPECT_LE(statistics.numberOfBlocksBefore, statistics.numberOfBlocksAfter);
+    }
+    // Once there are enough blocks, the signatures are computed for (at most) four groups.
+    EXPECT_LT(1ul, refiner.getRefinementStatistics().back().numberOfSignatures);
+    EXPECT_GE(4ul, refiner.getRefinementStatistics().back().numberOfSignatures);
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> mdp = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+    
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::CUDD, double> mdpPreservationInformation(*mdp);
+    storm::dd::bisimulation::NondeterministicModelPartitionRefiner<storm::dd::DdType::CUDD, double> mdpRefiner(*mdp->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>>(), storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double>::create(*mdp, storm::storage::BisimulationType::Strong, mdpPreservationInformation));
+    mdpRefiner.setNumberOfBlockGroups(8);
+    while (mdpRefiner.refine()) {
+        // Intentionally left empty.
+    }
+    
+    EXPECT_EQ(77ul, mdpRefiner.getStatePartition().getNumberOfBlocks());
+}
+
+TEST(SymbolicModelBisimulationDecomposition, BlockGroups_Sylvan) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    smd = smd.preprocess();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan, double>().build(smd.asPrismProgram());
+    
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::Sylvan, double> preservationInformation(*model);
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::Sylvan, double> refiner(*model, storm::dd::bisimulation::Partition<storm::dd::DdType::Sylvan, double>::create(*model, storm::storage::BisimulationType::Strong, preservationInformation));
+    refiner.setNumberOfBlockGroups(4);
+    while (refiner.refine()) {
+        // Intentionally left empty.
+    }
+    
+    EXPECT_EQ(2007ul, refiner.getStatePartition().getNumberOfBlocks());
+}
+
+TEST(SymbolicModelBisimulationDecomposition, SparseQuotient_Cudd) {
+    storm::storage::SymbolicModelDescription smd = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds5_5.pm");
+    smd = smd.preprocess();
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(smd.asPrismProgram());
+    
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::CUDD, double> preservationInformation(*model);
+    storm::dd::bisimulation::PartitionRefiner<storm::dd::DdType::CUDD, double> refiner(*model, storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double>::create(*model, storm::storage::BisimulationType::Strong, preservationInformation));
+    while (refiner.refine()) {
+        // Intentionally left empty.
+    }
+    
+    storm::dd::bisimulation::QuotientExtractor<storm::dd::DdType::CUDD, double> extractor(storm::settings::modules::BisimulationSettings::QuotientFormat::Sparse);
+    std::shared_ptr<storm::models::Model<double>> quotient = extractor.extract(*model, refiner.getStatePartition(), preservationInformation);
+    
+    EXPECT_EQ(2007ul, quotient->getNumberOfStates());
+    EXPECT_EQ(3738ul, quotient->getNumberOfTransitions());
+    EXPECT_EQ(storm::models::ModelType::Dtmc, quotient->getType());
+    EXPECT_TRUE(quotient->isSparseModel());
+    
+    // The transitions to the states of a block are aggregated, so the rows are still stochastic.
+    storm::storage::SparseMatrix<double> const& matrix = quotient->as<storm::models::sparse::Dtmc<double>>()->getTransitionMatrix();
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        EXPECT_NEAR(1.0, matrix.getRowSum(row), 1e-6);
+    }
+    
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::CUDD, double>> mdp = storm::builder::DdPrismModelBuilder<storm::dd::DdType::CUDD, double>().build(program);
+    
+    storm::dd::bisimulation::PreservationInformation<storm::dd::DdType::CUDD, double> mdpPreservationInformation(*mdp);
+    storm::dd::bisimulation::NondeterministicModelPartitionRefiner<storm::dd::DdType::CUDD, double> mdpRefiner(*mdp->as<storm::models::symbolic::Mdp<storm::dd::DdType::CUDD, double>>(), storm::dd::bisimulation::Partition<storm::dd::DdType::CUDD, double>::create(*mdp, storm::storage::BisimulationType::Strong, mdpPreservationInformation));
+    while (mdpRefiner.refine()) {
+        // Intentionally left empty.
+    }
+    
+    quotient = extractor.extract(*mdp, mdpRefiner.getStatePartition(), mdpPreservationInformation);
+    
+    EXPECT_EQ(77ul, quotient->getNumberOfStates());
+    EXPECT_EQ(storm::models::ModelType::Mdp, quotient->getType());
+    EXPECT_TRUE(quotient->isSparseModel());
+}
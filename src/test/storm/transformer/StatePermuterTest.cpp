@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm/api/transformation.h"
+#include "storm/api/verification.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/storage/jani/Property.h"
+
+namespace {
+    std::vector<double> checkAllStates(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::shared_ptr<storm::logic::Formula const> const& formula) {
+        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, false));
+        return result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+    }
+}
+
+TEST(StatePermuterTest, ResultsArePreserved) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"two\"];Pmax=? [F \"seven\"];Rmin=? [F \"done\"]", program));
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::api::buildSparseModel<double>(program, formulas);
+    ASSERT_EQ(169ul, model->getNumberOfStates());
+
+    std::vector<std::vector<double>> originalResults;
+    for (auto const& formula : formulas) {
+        originalResults.push_back(checkAllStates(model, formula));
+    }
+
+    storm::storage::BitVector targetStates = model->getStates("done");
+    for (auto order : {storm::utility::permutation::OrderKind::None, storm::utility::permutation::OrderKind::ReverseCuthillMcKee, storm::utility::permutation::OrderKind::Topological, storm::utility::permutation::OrderKind::BackwardBfs}) {
+        auto permuted = storm::api::permuteModelStates(model, order, targetStates);
+        ASSERT_EQ(model->getNumberOfStates(), permuted.model->getNumberOfStates());
+        EXPECT_EQ(model->getNumberOfChoices(), permuted.model->getNumberOfChoices());
+        EXPECT_EQ(model->getNumberOfTransitions(), permuted.model->getNumberOfTransitions());
+        EXPECT_EQ(model->getInitialStates().getNumberOfSetBits(), permuted.model->getInitialStates().getNumberOfSetBits());
+        EXPECT_EQ(permuted.oldToNewStateIndexMapping[*model->getInitialStates().begin()], *permuted.model->getInitialStates().begin());
+        for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+            EXPECT_EQ(state, permuted.newToOldStateIndexMapping[permuted.oldToNewStateIndexMapping[state]]);
+        }
+
+        for (uint64_t i = 0; i < formulas.size(); ++i) {
+            std::vector<double> restored = storm::transformer::StatePermuter<double>::restoreOriginalOrder(checkAllStates(permuted.model, formulas[i]), permuted);
+            ASSERT_EQ(originalResults[i].size(), restored.size());
+            for (uint64_t state = 0; state < restored.size(); ++state) {
+                EXPECT_NEAR(originalResults[i][state], restored[state], 1e-6);
+            }
+        }
+    }
+}
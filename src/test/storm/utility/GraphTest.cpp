@@ -15,6 +15,7 @@
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 #include "storm/storage/dd/DdManager.h"
+#include "storm/storage/dd/PartitionedTransitionRelation.h"
 
 TEST(GraphTest, SymbolicProb01_Cudd) {
     storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
@@ -209,6 +210,49 @@ TEST(GraphTest, SymbolicProb01MinMax_Sylvan) {
 
 #include "storm/utility/solver.h"
 
+TEST(GraphTest, SymbolicProb01Partitioned_Sylvan) {
+    storm::storage::SymbolicModelDescription modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+    storm::prism::Program program = modelDescription.preprocess().asPrismProgram();
+    storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>::Options options;
+    options.partitionTransitionRelation = true;
+    std::shared_ptr<storm::models::symbolic::Model<storm::dd::DdType::Sylvan>> model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Dtmc);
+    ASSERT_TRUE(model->hasPartitionedTransitionRelation());
+    EXPECT_LT(1ull, model->getPartitionedTransitionRelation().getNumberOfPartitions());
+    
+    {
+        // This block is necessary, so the BDDs get disposed before the manager (contained in the model).
+        std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>> statesWithProbability01;
+        
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> predecessors = model->getPartitionedTransitionRelation().preimage(model->getStates("observe0Greater1"));
+        EXPECT_EQ(predecessors, model->getStates("observe0Greater1").inverseRelationalProduct(model->getQualitativeTransitionMatrix(), model->getRowVariables(), model->getColumnVariables()));
+        storm::dd::Bdd<storm::dd::DdType::Sylvan> successors = model->getPartitionedTransitionRelation().image(model->getInitialStates());
+        EXPECT_EQ(successors, model->getInitialStates().relationalProduct(model->getQualitativeTransitionMatrix(), model->getRowVariables(), model->getColumnVariables()));
+        EXPECT_EQ(model->getQualitativeTransitionMatrix(false), model->getPartitionedTransitionRelation().toBdd());
+        
+        ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01(*model->as<storm::models::symbolic::Dtmc<storm::dd::DdType::Sylvan>>(), model->getReachableStates(), model->getStates("observe0Greater1")));
+        EXPECT_EQ(4409ull, statesWithProbability01.first.getNonZeroCount());
+        EXPECT_EQ(1316ull, statesWithProbability01.second.getNonZeroCount());
+    }
+    
+    modelDescription = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/mdp/leader3.nm");
+    program = modelDescription.preprocess().asPrismProgram();
+    model = storm::builder::DdPrismModelBuilder<storm::dd::DdType::Sylvan>().build(program, options);
+    
+    ASSERT_TRUE(model->getType() == storm::models::ModelType::Mdp);
+    ASSERT_TRUE(model->hasPartitionedTransitionRelation());
+    
+    {
+        // This block is necessary, so the BDDs get disposed before the manager (contained in the model).
+        std::pair<storm::dd::Bdd<storm::dd::DdType::Sylvan>, storm::dd::Bdd<storm::dd::DdType::Sylvan>> statesWithProbability01;
+        
+        ASSERT_NO_THROW(statesWithProbability01 = storm::utility::graph::performProb01Max(*model->as<storm::models::symbolic::Mdp<storm::dd::DdType::Sylvan>>(), model->getReachableStates(), model->getStates("elected")));
+        EXPECT_EQ(0ull, statesWithProbability01.first.getNonZeroCount());
+        EXPECT_EQ(364ull, statesWithProbability01.second.getNonZeroCount());
+    }
+}
+
 TEST(GraphTest, SymbolicProb01StochasticGameDieSmall) {
     storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
     